@@ -5,6 +5,8 @@
 #include <glm/gtx/euler_angles.hpp>
 
 #define USE_SERIALIZER
+// Measure how well animating many instances in parallel scales, for every animation of every scene which is opened via the file browser:
+//#define BENCHMARK_ANIMATION_BATCHES
 
 class orca_loader_app : public gvk::invokee
 {
@@ -29,17 +31,49 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		, mFileBrowser{ ImGuiFileBrowserFlags_EnterNewFilename }
 	{}
 
-	// Loads an ORCA scene from file by performing the following steps:
+	// Starts loading an ORCA scene from file on a worker thread. The currently loaded scene continues
+	// to be rendered until update() receives the loaded scene and passes it to create_resources_for_orca_scene.
+	// A load operation which is still in progress is cancelled.
+	void load_orca_scene(const std::string& aPathToOrcaScene)
+	{
+		mOrcaSceneLoadPath = aPathToOrcaScene;
+		mOrcaSceneLoad = gvk::orca_scene_t::load_from_file_async(aPathToOrcaScene);
+	}
+
+#ifdef BENCHMARK_ANIMATION_BATCHES
+	// Animates many instances of every animation of the scene's models, once serially and once in parallel, and logs the timings:
+	void benchmark_animation_batches(const gvk::orca_scene& aOrcaScene)
+	{
+		for (const auto& modelData : aOrcaScene->models()) {
+			const auto& model = modelData.mLoadedModel;
+			if (0 == model->num_animations()) {
+				continue;
+			}
+			auto animations = model->prepare_all_animations(model->select_all_meshes());
+			for (uint32_t ai = 0; ai < model->num_animations(); ++ai) {
+				const auto clip = model->load_animation_clip(ai, 0.0, std::numeric_limits<double>::max());
+				if (0.0 == clip.mTicksPerSecond) {
+					LOG_WARNING(fmt::format("Not benchmarking animation {} of model '{}', because its ticks per second are unknown.", ai, modelData.mFullPathName));
+					continue;
+				}
+				LOG_INFO(fmt::format("Benchmarking animation {} of model '{}':", ai, modelData.mFullPathName));
+				gvk::benchmark_animate_instances(animations[ai], clip);
+			}
+		}
+	}
+#endif
+
+	// Creates the resources for a loaded ORCA scene by performing the following steps:
 	//  - Destroy the resources representing the currently loaded scene in n frames
 	//    (where n is the number of frames in flight). The resources to be destroyed are:
 	//     - mDrawCalls
 	//     - mMaterialBuffer
 	//     - mImageSamplers
-	//  - Load ORCA scene from file, creating the resources anew:
+	//  - Create the resources anew from the given ORCA scene:
 	//     - mDrawCalls
 	//     - mMaterialBuffer
 	//     - mImageSamplers
-	void load_orca_scene(const std::string& aPathToOrcaScene)
+	void create_resources_for_orca_scene(gvk::orca_scene aOrcaScene)
 	{
 		// Clean up the current resources, before creating new ones:
 		mOldDrawCalls = std::move(mDrawCalls);
@@ -55,13 +89,11 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		float endPart = 0.0f;
 		std::vector<std::tuple<std::string, float>> times;
 
-		// Load an ORCA scene from file:
-		auto orca = gvk::orca_scene_t::load_from_file(aPathToOrcaScene);
 		// Get all the different materials from the whole scene:
-		auto distinctMaterialsOrca = orca->distinct_material_configs_for_all_models();
+		auto distinctMaterialsOrca = aOrcaScene->distinct_material_configs_for_all_models();
 
 		endPart = gvk::context().get_time();
-		times.emplace_back(std::make_tuple("load orca file", endPart - startPart));
+		times.emplace_back(std::make_tuple("get distinct materials", endPart - startPart));
 		startPart = gvk::context().get_time();
 
 		// The following loop gathers all the vertex and index data PER MATERIAL and constructs the buffers and materials.
@@ -75,7 +107,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			// The data in distinctMaterialsOrca encompasses all of the ORCA scene's models.
 			for (const auto& indices : pair.second) {
 				// However, we have to pay attention to the specific model's scene-properties,...
-				auto& modelData = orca->model_at_index(indices.mModelIndex);
+				auto& modelData = aOrcaScene->model_at_index(indices.mModelIndex);
 				// ... specifically, to its instances:
 				
 				// Get a buffer containing all positions, and one containing all indices for all submeshes with this material
@@ -174,17 +206,30 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		);
 	}
 
-	// Loads an ORCA scene from file or cache file by performing the following steps:
+	// Loads an ORCA scene from its cache file right away if one exists. Otherwise, starts loading the
+	// ORCA scene from file on a worker thread, and update() passes it to create_resources_for_orca_scene_cached once loaded.
+	void load_orca_scene_cached(const std::string& aPathToOrcaScene)
+	{
+		if (gvk::does_cache_file_exist(aPathToOrcaScene + ".cache")) {
+			mOrcaSceneLoad.reset();
+			create_resources_for_orca_scene_cached(aPathToOrcaScene, {});
+			return;
+		}
+		load_orca_scene(aPathToOrcaScene);
+	}
+
+	// Creates the resources for an ORCA scene from its cache file or, if there is none, from the given
+	// loaded ORCA scene while writing the cache file, by performing the following steps:
 	//  - Destroy the resources representing the currently loaded scene in n frames
 	//    (where n is the number of frames in flight). The resources to be destroyed are:
 	//     - mDrawCalls
 	//     - mMaterialBuffer
 	//     - mImageSamplers
-	//  - Load ORCA scene from file, creating the resources anew:
+	//  - Create the resources anew:
 	//     - mDrawCalls
 	//     - mMaterialBuffer
 	//     - mImageSamplers
-	void load_orca_scene_cached(const std::string& aPathToOrcaScene)
+	void create_resources_for_orca_scene_cached(const std::string& aPathToOrcaScene, gvk::orca_scene aOrcaScene)
 	{
 		// Clean up the current resources, before creating new ones:
 		mOldDrawCalls = std::move(mDrawCalls);
@@ -195,7 +240,6 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		// In update() it is not because the fence-wait that ensures that the resources are not used anymore, happens between update() and render().
 		mDestroyOldResourcesInFrame = gvk::context().main_window()->current_frame() + gvk::context().main_window()->number_of_frames_in_flight(); 
 		
-		gvk::orca_scene orca;
 		std::unordered_map<gvk::material_config, std::vector<gvk::model_and_mesh_indices>> distinctMaterialsOrca;
 
 		const std::string cacheFilePath(aPathToOrcaScene + ".cache");
@@ -209,15 +253,13 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		float endPart = 0.0f;
 		std::vector<std::tuple<std::string, float>> times;
 
-		// Load orca scene for usage and serialization, loading the scene is not required if a cache file exists, i.e. mode == deserialize
+		// The loaded orca scene is only required for serialization, it is not loaded if a cache file exists, i.e. mode == deserialize
 		if (serializer.mode() == gvk::serializer::mode::serialize) {
-			// Load an ORCA scene from file:
-			orca = gvk::orca_scene_t::load_from_file(aPathToOrcaScene);
 			// Get all the different materials from the whole scene:
-			distinctMaterialsOrca = orca->distinct_material_configs_for_all_models();
+			distinctMaterialsOrca = aOrcaScene->distinct_material_configs_for_all_models();
 
 			endPart = gvk::context().get_time();
-			times.emplace_back(std::make_tuple("no cache file, loading orca file", endPart - startPart));
+			times.emplace_back(std::make_tuple("no cache file, get distinct materials", endPart - startPart));
 			startPart = gvk::context().get_time();
 		}
 
@@ -247,7 +289,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 
 			for (int meshIndicesIndex = 0; meshIndicesIndex < numMeshIndices; ++meshIndicesIndex) {
 				// Convinience function to retrieve the model data via the mesh indices from the orca scene while in serialize mode
-				auto getModelData = [&]() -> gvk::model_data& { return orca->model_at_index(meshIndices[meshIndicesIndex].mModelIndex); };
+				auto getModelData = [&]() -> gvk::model_data& { return aOrcaScene->model_at_index(meshIndices[meshIndicesIndex].mModelIndex); };
 
 				// modelAndMeshes is only needed during serialization, otherwise the following buffers are filled by the
 				// serializer from the cache file in the repsective *_cached functions and modelAndMeshes may be empty.
@@ -379,9 +421,11 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		);
 		
 #ifdef USE_SERIALIZER
-		load_orca_scene_cached("assets/sponza_duo.fscene");
+		// Load the initial scene synchronously, s.t. there is something to render from the first frame on:
+		const std::string initialScene = "assets/sponza_duo.fscene";
+		create_resources_for_orca_scene_cached(initialScene, gvk::does_cache_file_exist(initialScene + ".cache") ? gvk::orca_scene{} : gvk::orca_scene_t::load_from_file(initialScene));
 #else
-		load_orca_scene("assets/sponza_duo.fscene");
+		create_resources_for_orca_scene(gvk::orca_scene_t::load_from_file("assets/sponza_duo.fscene"));
 #endif
 
 		// Add the camera to the composition (and let it handle the updates)
@@ -407,7 +451,14 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				ImGui::DragFloat3("Rotate Scene", glm::value_ptr(mRotateScene), 0.005f, -glm::pi<float>(), glm::pi<float>());
 				ImGui::Separator();
 
-	            if(ImGui::Button("Load ORCA scene...")) {
+				if (mOrcaSceneLoad.has_value()) {
+					ImGui::Text("Loading %s", mOrcaSceneLoadPath.c_str());
+					ImGui::ProgressBar(mOrcaSceneLoad->progress());
+					if (ImGui::Button("Cancel")) {
+						mOrcaSceneLoad->cancel();
+					}
+				}
+	            else if(ImGui::Button("Load ORCA scene...")) {
 	                mFileBrowser.Open();
 	            }		        
 		        mFileBrowser.Display();
@@ -440,6 +491,29 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			printf("Time from init to fourth frame: %d min, %lld sec %lf ms\n", int_min, int_sec - static_cast<decltype(int_sec)>(int_min) * 60, fp_ms - 1000.0 * int_sec);
 		}
 
+		// Poll the ORCA scene which is being loaded in the background, and create its resources once it has been loaded:
+		if (mOrcaSceneLoad.has_value() && mOrcaSceneLoad->is_ready()) {
+			auto orcaSceneLoad = std::move(mOrcaSceneLoad.value());
+			mOrcaSceneLoad.reset();
+			try {
+				auto orcaScene = orcaSceneLoad.get();
+#ifdef BENCHMARK_ANIMATION_BATCHES
+				benchmark_animation_batches(orcaScene);
+#endif
+#ifdef USE_SERIALIZER
+				create_resources_for_orca_scene_cached(mOrcaSceneLoadPath, std::move(orcaScene));
+#else
+				create_resources_for_orca_scene(std::move(orcaScene));
+#endif
+			}
+			catch (gvk::runtime_error& e) {
+				LOG_ERROR(fmt::format("Loading ORCA scene '{}' failed: {}", mOrcaSceneLoadPath, e.what()));
+			}
+			catch (std::exception& e) {
+				LOG_ERROR(fmt::format("Loading ORCA scene '{}' failed: {}", mOrcaSceneLoadPath, e.what()));
+			}
+		}
+
 		if (gvk::input().key_pressed(gvk::key_code::h)) {
 			// Log a message:
 			LOG_INFO_EM("Hello cg_base!");
@@ -548,6 +622,10 @@ private: // v== Member variables ==v
 	glm::vec3 mRotateScene;
 
 	ImGui::FileBrowser mFileBrowser;
+
+	// The ORCA scene which is currently being loaded in the background, if any:
+	std::optional<gvk::async_load<gvk::orca_scene>> mOrcaSceneLoad;
+	std::string mOrcaSceneLoadPath;
 	
 }; // model_loader_app
 
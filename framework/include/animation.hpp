@@ -55,6 +55,28 @@ namespace gvk
 		glm::vec3 mValue;
 	};
 
+	/**	All the keyframes of one animated node, i.e. one channel of an animation.
+	 *	This is a native copy of Assimp's aiNodeAnim, with normalized rotation keys.
+	 */
+	struct animation_channel
+	{
+		std::string mNodeName;
+		std::vector<position_key> mPositionKeys;
+		std::vector<rotation_key> mRotationKeys;
+		std::vector<scaling_key> mScalingKeys;
+	};
+
+	/**	All the channels of one animation of a model, which is a native copy of Assimp's aiAnimation.
+	 *	These are the source data which `model_t::prepare_animation` sets up an `animation` from.
+	 */
+	struct animation_tracks
+	{
+		std::string mName;
+		double mTicksPerSecond = 0.0;
+		double mDurationTicks = 0.0;
+		std::vector<animation_channel> mChannels;
+	};
+
 	/**	Struct which contains information about a particular bone w.r.t. a particular mesh
 	 *	during animation. I.e. when a certain mesh-specific(!) bone matrix shall be written
 	 *	to its target location, this struct contains the following information:
@@ -159,10 +181,9 @@ namespace gvk
 
 	};
 
-	/**	Struct containing data about one specific animated node.
-	 *	Class animation will contain multiple of such in most cases.
+	/**	The animation keys of one animated node for one specific animation clip, see `animation_track_set`.
 	 */
-	struct animated_node
+	struct animated_node_keys
 	{
 		/**	Animation keys for the positions of this node. */
 		std::vector<position_key> mPositionKeys;
@@ -177,19 +198,27 @@ namespace gvk
 		 *	number of elements and each element with the same index has
 		 *	the same mTime in both.
 		 */
-		bool mSameRotationAndPositionKeyTimes;
+		bool mSameRotationAndPositionKeyTimes = true;
 
 		/** True if the mPositionKeys and mScalingKeys contain the same
 		 *	number of elements and each element with the same index has
 		 *	the same mTime in both.
 		 */
-		bool mSameScalingAndPositionKeyTimes;
+		bool mSameScalingAndPositionKeyTimes = true;
+	};
 
-		/** The local transform of this node */
+	/**	Struct containing data about one specific animated node, i.e. one node of an `animation_skeleton`.
+	 *	Its animation keys are stored separately per animation clip, in `animation_track_set`.
+	 */
+	struct animated_node
+	{
+		/** The local transform of this node, which is used if an animation clip has no keys for it */
 		glm::mat4 mLocalTransform;
 		
-		/** The global transform of this node */
-		glm::mat4 mGlobalTransform;
+		/**	The global transform of this node in the model's original pose. The animated global transforms
+		 *	are not stored in the (shared) skeleton, but in `animation_playback_state::global_transform`.
+		 */
+		glm::mat4 mRestGlobalTransform;
 
 		/** Contains the index of a parent node IF this node HAS a parent
 		 *	node that is affected by animation.
@@ -218,6 +247,41 @@ namespace gvk
 		std::vector<bone_mesh_data> mBoneMeshTargets;
 	};
 
+	/**	All the animated nodes of a model for a selection of meshes: the nodes which are animated by (any of) the animation
+	 *	clips, and all the bones of the selected meshes. The nodes are ordered s.t. every node comes after its animated parent.
+	 *	A skeleton does not contain any keys, hence it can be shared by the animations of all the clips of a model
+	 *	(see `model_t::prepare_all_animations`), which store only their keys, in an `animation_track_set` each.
+	 */
+	struct animation_skeleton
+	{
+		/** Gets the number of bytes occupied by the nodes and their bone mesh targets */
+		size_t size_in_bytes() const;
+
+		/** The animated nodes */
+		std::vector<animated_node> mNodes;
+
+		/** Index of every animated node in the model's node table, i.e. of the last node with the animated node's name */
+		std::vector<size_t> mModelNodeIndices;
+
+		/** Number of bone matrices of all the selected meshes */
+		size_t mMaxNumBoneMatrices = 0;
+	};
+
+	/**	The keys of one animation clip for all nodes of an `animation_skeleton`, i.e. `mNodeKeys[i]` contains the keys
+	 *	of `animation_skeleton::mNodes[i]`. Nodes which the clip does not animate have no keys at all.
+	 */
+	struct animation_track_set
+	{
+		/** Gets the number of bytes occupied by the keys */
+		size_t size_in_bytes() const;
+
+		/** Assimp's animation index of the clip */
+		uint32_t mAnimationIndex = 0;
+
+		/** The keys of every node of the skeleton */
+		std::vector<animated_node_keys> mNodeKeys;
+	};
+
 	/** Represents possible spaces which the final bone matrices can be transformed into. */
 	enum struct bone_matrices_space
 	{
@@ -229,14 +293,110 @@ namespace gvk
 	};
 	
 	class model_t;
+	class animation;
+	struct animation_soa_tracks;
+	struct baked_animation_clip;
+
+	/** Positions of one animated node within its position, rotation, and scaling keys, as found during the previous evaluation. */
+	struct animation_key_cursor
+	{
+		uint32_t mPositionKey = 0;
+		uint32_t mRotationKey = 0;
+		uint32_t mScalingKey = 0;
+	};
+
+	/**	Playback state of one instance which is animated with a (shared) `animation`, i.e. everything that
+	 *	`animation::animate` modifies: the per-node key cursors, which make finding the keys to interpolate
+	 *	between O(1) while time advances monotonically, and the global transforms of all animated nodes.
+	 *	The state is set up for an animation during the first call to `animation::animate`; it can be used
+	 *	with a different animation afterwards, which is as costly as a seek.
+	 */
+	class animation_playback_state
+	{
+		friend class animation;
+
+	public:
+		animation_playback_state() = default;
+		animation_playback_state(animation_playback_state&&) noexcept = default;
+		animation_playback_state(const animation_playback_state&) = default;
+		animation_playback_state& operator=(animation_playback_state&&) noexcept = default;
+		animation_playback_state& operator=(const animation_playback_state&) = default;
+		~animation_playback_state() = default;
+
+		/** Creates a playback state which is already set up for the given animation */
+		explicit animation_playback_state(const animation& aAnimation);
+
+		/** Resets all key cursors to the first keys, as if the state had been newly created */
+		void reset();
+
+		/** Gets the number of animated nodes which this state has been set up for */
+		size_t number_of_animated_nodes() const { return mCursors.size(); }
+
+		/** Gets the global transform of the animated node at the given index, as it has been computed during the previous evaluation */
+		const glm::mat4& global_transform(size_t aNodeIndex) const { return mGlobalTransforms[aNodeIndex]; }
+
+		/** Gets the local transform of the animated node at the given index, as it has been computed during the previous evaluation */
+		const glm::mat4& local_transform(size_t aNodeIndex) const { return mLocalTransforms[aNodeIndex]; }
+
+	private:
+		std::vector<animation_key_cursor> mCursors;
+		std::vector<glm::mat4> mGlobalTransforms;
+		std::vector<glm::mat4> mLocalTransforms;
+	};
+
+	/**	One clip which is blended with other clips by the `animation::animate` overload which takes blend layers.
+	 *	The local transforms of all layers are blended per node, i.e. translations and scalings are averaged
+	 *	and rotations are averaged as quaternions, with the weights normalized to a sum of 1 per node.
+	 */
+	struct animation_blend_layer
+	{
+		/**	The animation to sample. All the layers which are blended together must share the skeleton of the
+		 *	animation which evaluates them (see `model_t::prepare_all_animations`).
+		 */
+		const animation* mAnimation = nullptr;
+
+		/** Animation clip to use for this layer */
+		animation_clip_data mClip;
+
+		/** Time in seconds to sample this layer's clip at */
+		double mTime = 0.0;
+
+		/** Weight of this layer; layers with a weight of 0 are not sampled at all */
+		float mWeight = 1.0f;
+
+		/**	Optional weight per node of the skeleton, which is multiplied with mWeight, e.g. 0 for the lower body
+		 *	and 1 for the upper body of a layer which shall only affect the upper body. If it is empty, all nodes
+		 *	are weighted with mWeight.
+		 */
+		std::span<const float> mNodeMask;
+
+		/**	Key cursors of this layer. Keep one state per layer across frames to find the keys in O(1).
+		 *	If it is not set, all the keys are looked up with binary search.
+		 */
+		animation_playback_state* mPlaybackState = nullptr;
+	};
 
 	/**	Class that represents one specific animation for one or multiple meshes
 	 */
 	class animation
 	{
 		friend class model_t;
+		friend struct baked_animation_clip;
 		
 	public:
+		animation() = default;
+		animation(animation&&) noexcept = default;
+		animation(const animation&) = default;
+		animation& operator=(animation&&) noexcept = default;
+		animation& operator=(const animation&) = default;
+		~animation() = default;
+
+		/**	Creates an animation from a (shared) skeleton and the keys of one of its clips
+		 *	@param	aSkeleton			The skeleton, which can be shared by many animations
+		 *	@param	aTracks				The keys of one clip, indexed by the skeleton's nodes
+		 */
+		animation(std::shared_ptr<const animation_skeleton> aSkeleton, std::shared_ptr<const animation_track_set> aTracks);
+
 		/**	Calculates the bone animation, calculates and writes all the bone matrices into their target storage.
 		 *
 		 *	@param	aClip				Animation clip to use for the animation
@@ -256,7 +416,7 @@ namespace gvk
 		 *								- const glm::mat4& aGlobalTransformMatrix: (mandatory) Represents the "node transformation matrix" that represents a bone-transformation, considering the whole parent hierarchy. That means, it contains the global transform, transforming from BONE SPACE into MODEL SPACE.
 		 *								- const glm::mat4& aInverseBindPoseMatrix: (mandatory) Represents the "inverse bind pose matrix" or "offset matrix" that transforms coordinates from MESH SPACE (i.e. that from the mesh with index aInfo.mMeshIndex) into BONE SPACE.
 		 *								- const glm::mat4& aLocalTransformMatrix:  (optional)  Contains the local bone transformation, i.e. the same data as aGlobalTransformationMatrix, but WITHOUT having the whole parent hierarchy applied to the transformation. I.e. this does NOT properly transform into MODEL SPACE.
-		 *								- const gvk::animated_node& aAnimatedNode: (optional)  Contains all the animation data from the the current (internal) animation-node-structure.
+		 *								- const gvk::animated_node& aAnimatedNode: (optional)  Contains the data of the current node of the (internal) animation skeleton.
 		 *								- size_t aBoneMeshTargetIndex:             (optional)  Contains the index into animated_node::mBoneMeshTargets that is the current one at the point in time when this callback is invoked.
 		 *								- double aAnimationTimeInTicks:            (optional)  Contains the animation time in ticks, at the point in time when this callback is invoked.
 		 *								
@@ -270,93 +430,60 @@ namespace gvk
 		template <typename F>
 		void animate(const animation_clip_data& aClip, double aTime, F&& aBoneMatrixCalc)
 		{
-			if (aClip.mTicksPerSecond == 0.0) {
-				throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
-			}
-			if (aClip.mAnimationIndex != mAnimationIndex) {
-				throw gvk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
-			}
-
-			double timeInTicks = aTime * aClip.mTicksPerSecond;
-
-			for (auto& anode : mAnimationData) {
-				// First, calculate the local transform
-				glm::mat4 localTransform = anode.mLocalTransform;
-
-				// The localTransform can only be different than the identity if there are animation keys.
-				if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() > 0) {
-					// Translation/position:
-					auto [tpos1, tpos2] = find_positions_in_keys(anode.mPositionKeys, timeInTicks);
-					auto tf = get_interpolation_factor(anode.mPositionKeys[tpos1], anode.mPositionKeys[tpos2], timeInTicks);
-					auto translation = glm::lerp(anode.mPositionKeys[tpos1].mValue, anode.mPositionKeys[tpos2].mValue, tf);
-
-					// Rotation:
-					size_t rpos1 = tpos1, rpos2 = tpos2;
-					if (!anode.mSameRotationAndPositionKeyTimes) {
-						std::tie(rpos1, rpos2) = find_positions_in_keys(anode.mRotationKeys, timeInTicks);
-					}
-					auto rf = get_interpolation_factor(anode.mRotationKeys[rpos1], anode.mRotationKeys[rpos2], timeInTicks);
-					auto rotation = glm::slerp(anode.mRotationKeys[rpos1].mValue, anode.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
-					rotation = glm::normalize(rotation); // normalize the resulting quaternion, just to be on the safe side
-
-					// Scaling:
-					size_t spos1 = tpos1, spos2 = tpos2;
-					if (!anode.mSameScalingAndPositionKeyTimes) {
-						std::tie(spos1, spos2) = find_positions_in_keys(anode.mScalingKeys, timeInTicks);
-					}
-					auto sf = get_interpolation_factor(anode.mScalingKeys[spos1], anode.mScalingKeys[spos2], timeInTicks);
-					auto scaling = glm::lerp(anode.mScalingKeys[spos1].mValue, anode.mScalingKeys[spos2].mValue, sf);
+			animate_nodes(mPlaybackState, aClip, aTime, aBoneMatrixCalc);
+		}
 
-					localTransform = matrix_from_transforms(translation, rotation, scaling);
-				}
+		/**	Same as the other `animate` overload, but evaluates the animation for one particular instance, whose playback
+		 *	state is stored in aPlaybackState. This animation is not modified, i.e. many instances can share one
+		 *	`animation` and can even be animated concurrently, as long as every one of them has its own playback state.
+		 *
+		 *	The global transforms of the instance are passed to aBoneMatrixCalc and are stored in aPlaybackState
+		 *	(see `animation_playback_state::global_transform`).
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated. It is set up for this animation during the first call.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aBoneMatrixCalc		Callback-function that receives the bone matrices, see the other `animate` overload for details.
+		 */
+		template <typename F>
+		void animate(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, F&& aBoneMatrixCalc) const
+		{
+			animate_nodes(aPlaybackState, aClip, aTime, aBoneMatrixCalc);
+		}
 
-				// Calculate the node's global transform, using its local transform and the transforms of its parents:
-				if (anode.mAnimatedParentIndex.has_value()) {
-					anode.mGlobalTransform = mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform * anode.mParentTransform * localTransform;
-				}
-				else {
-					anode.mGlobalTransform = anode.mParentTransform * localTransform;
-				}
+		/**	Same as the `animate` overload which takes a playback state, but takes the local transforms of all nodes from
+		 *	a clip which has been baked with `baked_pose_format::local_transforms` (see `baked_animation_clip::bake`).
+		 *	I.e. instead of searching and interpolating keys, the poses are looked up in O(1), and only the hierarchy is evaluated.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aBakedClip			Clip of this animation, baked into local transforms
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at, see `baked_animation_clip::frame_position`
+		 *	@param	aBoneMatrixCalc		Callback-function that receives the bone matrices, see the first `animate` overload for details.
+		 *	@param	aInterpolate		If true, the poses of the two frames closest to aTime are interpolated; otherwise, the nearest frame is used.
+		 */
+		template <typename F>
+		void animate(animation_playback_state& aPlaybackState, const baked_animation_clip& aBakedClip, double aTime, F&& aBoneMatrixCalc, bool aInterpolate = true) const
+		{
+			prepare_playback_state(aPlaybackState);
+			const auto timeInTicks = sample_baked_local_transforms(aPlaybackState, aBakedClip, aTime, aInterpolate);
+			compose_nodes(aPlaybackState, timeInTicks, aBoneMatrixCalc);
+		}
 
-				// Calculate the final bone matrices for this node, for each mesh that is affected; and write out the matrix into the target storage:
-				const auto n = anode.mBoneMeshTargets.size();
-				for (size_t i = 0; i < n; ++i) {
-					// The final (mesh-specific!) bone matrix will be created in and stored via the lambda:
-					if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 1: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix);
-					}
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 2: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation
-				    	//           (The first four parameters are the same as with Option 1. Parameter five is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 3: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node
-				    	//           (The first five parameters are the same as with Option 2. Parameter six is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index
-				    	//           (The first six parameters are the same as with Option 3. Parameter seven is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t, double)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index, animation time in ticks
-				    	//           (The first seven parameters are the same as with Option 4. Parameter eight is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i, timeInTicks);
-				    }
-					else {
-#if defined(_MSC_VER) && defined(__cplusplus)
-						static_assert(false);
-#else
-						assert(false);
-#endif
-						throw avk::logic_error("No lambda has been passed to animation::animate.");
-					}
-					
-				}
-			}
+		/**	Same as the `animate` overload which takes a playback state, but blends the given clips, see `animation_blend_layer`.
+		 *	Every layer's keys are sampled in local translation/rotation/scaling space and blended per node; then the
+		 *	hierarchy is evaluated once, s.t. blending costs little more than playing a single clip.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated, which receives the blended transforms
+		 *	@param	aLayers				The clips to blend. There must be at least one, and all of them must share this animation's skeleton.
+		 *	@param	aBoneMatrixCalc		Callback-function that receives the bone matrices, see the first `animate` overload for details.
+		 *								If it takes the animation time in ticks, it receives the time of the first layer.
+		 */
+		template <typename F>
+		void animate(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers, F&& aBoneMatrixCalc) const
+		{
+			prepare_playback_state(aPlaybackState);
+			const auto timeInTicks = blend_local_transforms(aPlaybackState, aLayers);
+			compose_nodes(aPlaybackState, timeInTicks, aBoneMatrixCalc);
 		}
 
 		/** Convenience-overload to animation::animate which calculates the bone animation s.t. a vertex transformed
@@ -415,18 +542,143 @@ namespace gvk
 		 */
 		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
 
-		/**	Returns all the unique keyframe time-values of the given animation.
+		/**	Same as the `animate_into_single_target_buffer` overload without a playback state, but animates one particular
+		 *	instance, whose playback state is stored in aPlaybackState. See the `animate` overload which takes a playback state.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, glm::mat4* aTargetMemory) const;
+
+		/**	Same as the `animate_into_single_target_buffer` overload without a playback state, but animates one particular
+		 *	instance, whose playback state is stored in aPlaybackState. See the `animate` overload which takes a playback state.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const;
+
+		/**	Same as the other `animate_into_strided_target_per_mesh` overloads, but writes the bone matrices in the given
+		 *	palette format (see `bone_palette_format`), which can be considerably smaller than glm::mat4.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aFormat				Format of every bone's entry
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone's entry shall be written to
+		 *	@param	aMeshStride			Offset in BYTES between the first memory target location for mesh i, and the first memory target location for mesh i+1
+		 *	@param	aMatricesStride		Offset in BYTES between two consecutive entries that are assigned to the same mesh. By default, it will be set to bytes_per_bone(aFormat)
+		 *	@param	aMaxMeshes			The maximum number of meshes to write out bone matrices for. That means, always the first #aMaxMeshes meshes w.r.t. mesh_bone_info::mMeshAnimationIndex will be written.
+		 *	@param	aMaxBonesPerMesh	The maximum number of bones to write out bone matrices for per mesh. Only the first #aMaxBonesPerMesh bone matrices w.r.t. mesh_bone_info::mMeshLocalBoneIndex will be written.
+		 */
+		void animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/**	Same as the other `animate_into_single_target_buffer` overloads, but writes the bone matrices in the given
+		 *	palette format (see `bone_palette_format`). The entry of mesh-local bone b of a mesh is written to byte offset
+		 *	`(mesh_bone_info::mGlobalBoneIndexOffset + b) * bytes_per_bone(aFormat)`.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aFormat				Format of every bone's entry
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone's entry shall be written to
+		 */
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory);
+
+		/**	Same as the previous overload, but animates one particular instance, whose playback state is stored in aPlaybackState.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aFormat				Format of every bone's entry
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone's entry shall be written to
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory) const;
+
+		/**	Blends the given clips like the `animate` overload which takes blend layers, and writes the bone matrices into one
+		 *	single target memory like the other `animate_into_single_target_buffer` overloads.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aLayers				The clips to blend, see `animation_blend_layer`
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const;
+
+		/**	Same as the previous overload, but writes every bone in the given palette format, see `bone_palette_format`.
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aLayers				The clips to blend, see `animation_blend_layer`
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aFormat				Format of every bone's entry
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone's entry shall be written to
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory) const;
+
+		/**	Writes the bone matrices of the given baked clip at the given time into one single target memory, like the other
+		 *	`animate_into_single_target_buffer` overloads. Clips baked into bone matrices are copied (or interpolated) directly,
+		 *	clips baked into local transforms are composed with the node hierarchy (see the `animate` overload for baked clips).
+		 *
+		 *	@param	aPlaybackState		Playback state of the instance to be animated
+		 *	@param	aBakedClip			Clip of this animation, baked with `baked_animation_clip::bake`
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at, see `baked_animation_clip::frame_position`
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices.
+		 *								Clips baked into bone matrices must have been baked for the same target space.
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@param	aInterpolate		If true, the poses of the two frames closest to aTime are interpolated; otherwise, the nearest frame is used.
+		 */
+		void animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const baked_animation_clip& aBakedClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, bool aInterpolate = true) const;
+
+		/**	Converts the keys of all animated nodes into a structure-of-arrays layout (see `animation_soa_tracks`),
+		 *	which all subsequent calls to `animate` use to evaluate the local transforms of four nodes at once,
+		 *	skipping static nodes. Key times are converted to float, and rotations are interpolated with an
+		 *	approximation of slerp, i.e. the results can differ slightly from the evaluation without SoA tracks.
+		 *	The tracks are shared by all copies of this animation, and they are not serialized.
+		 */
+		void build_soa_tracks();
+
+		/** Returns true if `build_soa_tracks` has been called, i.e. if `animate` evaluates SoA tracks */
+		bool has_soa_tracks() const { return static_cast<bool>(mSoaTracks); }
+
+		/**	Returns all the unique keyframe time-values of the given animation within the given clip, in ascending order.
+		 *	The clip's start and end are always contained, s.t. sampling at the returned times covers the whole clip,
+		 *	even if keys within the clip have been removed by keyframe reduction (see `model_t::prepare_animation`).
 		 *	@param	aClip				Animation clip which to extract the unique keyframe time-values from
 		 */
 		std::vector<double> animation_key_times_within_clip(const animation_clip_data& aClip) const;
 
+		/**	Returns the number of bone matrices of all the meshes which this animation has been prepared for, i.e. the
+		 *	number of matrices which `animate_into_single_target_buffer` writes (see `mesh_bone_info::mGlobalBoneIndexOffset`).
+		 */
+		size_t number_of_bone_matrices() const { return mSkeleton ? mSkeleton->mMaxNumBoneMatrices : 0; }
+
+		/** Returns Assimp's animation index of the clip which this animation has been created for */
+		uint32_t animation_index() const { return mTracks ? mTracks->mAnimationIndex : 0; }
+
+		/** Returns the skeleton, which may be shared with other animations */
+		const std::shared_ptr<const animation_skeleton>& skeleton() const { return mSkeleton; }
+
+		/** Returns the keys of the clip which this animation has been created for */
+		const std::shared_ptr<const animation_track_set>& tracks() const { return mTracks; }
+
+		/**	Returns the playback state which is used by the `animate` overloads which do not take a playback state,
+		 *	e.g. to get the global transforms of the animated nodes which have been computed during the previous call.
+		 */
+		const animation_playback_state& playback_state() const { return mPlaybackState; }
+
 		/** Returns the total number of animated nodes stored in an animation */
 		size_t number_of_animated_nodes() const;
 		
 		/** Returns the animated_node data structure at the given index
 		 *	@param	aNodeIndex			Index referring to the node that shall be returned
 		 */
-		std::reference_wrapper<animated_node> get_animated_node_at(size_t aNodeIndex);
+		std::reference_wrapper<const animated_node> get_animated_node_at(size_t aNodeIndex) const;
 		
 		/**	Returns the index of the parent node which is also animated by this animation for the given node index.
 		 *	@param	aNodeIndex			Index referring to the node of which the animated parent shall be returned for.
@@ -436,7 +688,7 @@ namespace gvk
 		/**	Returns a reference to the parent node which is also animated by this animation for the given node index.
 		 *	@param	aNodeIndex			Index referring to the node of which the animated parent shall be returned for.
 		 */
-		std::optional<std::reference_wrapper<animated_node>> get_animated_parent_node_of(size_t aNodeIndex);
+		std::optional<std::reference_wrapper<const animated_node>> get_animated_parent_node_of(size_t aNodeIndex) const;
 
 		/**	Returns the indices of all nodes that the given node index is an animated parent for within the context of this animation.
 		 *	@param	aNodeIndex			Index referring to the node of which the animated childs shall be returned for.
@@ -446,28 +698,141 @@ namespace gvk
 		/**	Returns references to all nodes that the given node index is an animated parent for within the context of this animation.
 		 *	@param	aNodeIndex			Index referring to the node of which the animated childs shall be returned for.
 		 */
-		std::vector<std::reference_wrapper<animated_node>> get_child_nodes_of(size_t aNodeIndex);
+		std::vector<std::reference_wrapper<const animated_node>> get_child_nodes_of(size_t aNodeIndex) const;
 		
 	private:
+		/**	Calculates the bone animation for the given playback state, see `animate`.
+		 */
+		template <typename F>
+		void animate_nodes(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, F& aBoneMatrixCalc) const
+		{
+			if (aClip.mTicksPerSecond == 0.0) {
+				throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+			}
+			if (aClip.mAnimationIndex != animation_index()) {
+				throw gvk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+			}
+
+			double timeInTicks = aTime * aClip.mTicksPerSecond;
+
+			prepare_playback_state(aPlaybackState);
+			if (mSoaTracks) {
+				evaluate_soa_local_transforms(aPlaybackState, timeInTicks);
+			}
+			else {
+				evaluate_local_transforms(aPlaybackState, timeInTicks);
+			}
+			compose_nodes(aPlaybackState, timeInTicks, aBoneMatrixCalc);
+		}
+
+		/**	Calculates the global transforms of all nodes from the local transforms in `animation_playback_state::mLocalTransforms`,
+		 *	and passes the bone matrices to aBoneMatrixCalc, see `animate`.
+		 */
+		template <typename F>
+		void compose_nodes(animation_playback_state& aPlaybackState, double aTimeInTicks, F& aBoneMatrixCalc) const
+		{
+			const auto& nodes = mSkeleton->mNodes;
+			const auto numNodes = nodes.size();
+			for (size_t nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex) {
+				const auto& anode = nodes[nodeIndex];
+				const auto& localTransform = aPlaybackState.mLocalTransforms[nodeIndex];
+
+				// Calculate the node's global transform, using its local transform and the transforms of its parents:
+				auto& globalTransform = aPlaybackState.mGlobalTransforms[nodeIndex];
+				if (anode.mAnimatedParentIndex.has_value()) {
+					globalTransform = aPlaybackState.mGlobalTransforms[anode.mAnimatedParentIndex.value()] * anode.mParentTransform * localTransform;
+				}
+				else {
+					globalTransform = anode.mParentTransform * localTransform;
+				}
+
+				// Calculate the final bone matrices for this node, for each mesh that is affected; and write out the matrix into the target storage:
+				const auto n = anode.mBoneMeshTargets.size();
+				for (size_t i = 0; i < n; ++i) {
+					// The final (mesh-specific!) bone matrix will be created in and stored via the lambda:
+					if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
+						// Option 1: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix
+						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, globalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix);
+					}
+				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
+						// Option 2: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation
+				    	//           (The first four parameters are the same as with Option 1. Parameter five is passed in addition.)
+						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, globalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform);
+				    }
+				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&)>, decltype(aBoneMatrixCalc)>::value) {
+						// Option 3: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node
+				    	//           (The first five parameters are the same as with Option 2. Parameter six is passed in addition.)
+						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, globalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode);
+				    }
+				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t)>, decltype(aBoneMatrixCalc)>::value) {
+						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index
+				    	//           (The first six parameters are the same as with Option 3. Parameter seven is passed in addition.)
+						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, globalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i);
+				    }
+				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t, double)>, decltype(aBoneMatrixCalc)>::value) {
+						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index, animation time in ticks
+				    	//           (The first seven parameters are the same as with Option 4. Parameter eight is passed in addition.)
+						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, globalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i, aTimeInTicks);
+				    }
+					else {
+#if defined(_MSC_VER) && defined(__cplusplus)
+						static_assert(false);
+#else
+						assert(false);
+#endif
+						throw avk::logic_error("No lambda has been passed to animation::animate.");
+					}
+					
+				}
+			}
+		}
+
+		/** Sets up the given playback state for this animation, unless it has been set up already */
+		void prepare_playback_state(animation_playback_state& aPlaybackState) const;
+
+		/** Evaluates the local transforms of all nodes from their keys into `animation_playback_state::mLocalTransforms` */
+		void evaluate_local_transforms(animation_playback_state& aPlaybackState, double aTimeInTicks) const;
+
+		/** Interpolates the given keys of one node at the given time, returns its translation, rotation, and scaling */
+		std::tuple<glm::vec3, glm::quat, glm::vec3> sample_node_keys(const animated_node_keys& aKeys, double aTimeInTicks, animation_key_cursor& aCursor) const;
+
+		/** Blends the local transforms of all nodes from the given layers into `animation_playback_state::mLocalTransforms`, returns the first layer's time in ticks */
+		double blend_local_transforms(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers) const;
+
+		/** Evaluates the local transforms of all nodes with mSoaTracks into `animation_playback_state::mLocalTransforms` */
+		void evaluate_soa_local_transforms(animation_playback_state& aPlaybackState, double aTimeInTicks) const;
+
+		/** Samples the local transforms of all nodes from a baked clip into `animation_playback_state::mLocalTransforms`, returns the time in ticks */
+		double sample_baked_local_transforms(animation_playback_state& aPlaybackState, const baked_animation_clip& aBakedClip, double aTime, bool aInterpolate) const;
+
 		/** Helper function used during animate() to find two positions of key-elements
-		 *	between which the given aTime lies.
+		 *	between which the given aTime lies. aCursor is the position which has been found for this
+		 *	collection during the previous call; it is updated to the new position.
+		 *	If time advances monotonically (i.e. during playback), the new position is found within a few steps from
+		 *	the previous one. Otherwise (i.e. for seeks and when a looping clip wraps around), binary search is used.
 		 */
 		template <typename T>
-		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime) const
+		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime, uint32_t& aCursor) const
 		{
+			// Number of keys to step over linearly before falling back to binary search:
+			constexpr size_t maxCursorSteps = 4;
 			const auto maxIndex = aCollection.size() - 1;
-			
-			size_t pos1 = 0;
-			while (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
-				++pos1;
+
+			size_t pos1 = std::min(static_cast<size_t>(aCursor), maxIndex);
+			bool found = false;
+			if (0 == pos1 || aCollection[pos1].mTime <= aTime) {
+				for (size_t step = 0; step < maxCursorSteps && pos1 < maxIndex && aCollection[pos1 + 1].mTime <= aTime; ++step) {
+					++pos1;
+				}
+				found = pos1 == maxIndex || aCollection[pos1 + 1].mTime > aTime;
 			}
-			
-			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
-			while (pos2 + 1 < maxIndex && aCollection[pos2 + 1].mTime < aTime) {
-				LOG_WARNING(fmt::format("Now that's strange: keys[{}].mTime {} < {}, despite keys[{}].mTime {} <= {}", pos2 + 1, aCollection[pos2 + 1].mTime, aTime, pos1, aCollection[pos1].mTime, aTime));
-				++pos2;
+			if (!found) {
+				const auto it = std::upper_bound(std::begin(aCollection), std::end(aCollection), aTime, [](double bTime, const auto& bKey) { return bTime < bKey.mTime; });
+				pos1 = std::begin(aCollection) == it ? 0 : static_cast<size_t>(std::distance(std::begin(aCollection), it)) - 1;
 			}
-			
+			aCursor = static_cast<uint32_t>(pos1);
+
+			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
 			return std::make_tuple(pos1, pos2);
 		}
 
@@ -486,18 +851,21 @@ namespace gvk
 			return static_cast<float>((aTime - key1.mTime) / timeDifferenceTicks);
 		}
 		
-		/**	All animated nodes, along with their animation data and target storage pointers
+		/**	All animated nodes along with their target storage information, which may be shared with other animations
 		 */
-		std::vector<animated_node> mAnimationData;
+		std::shared_ptr<const animation_skeleton> mSkeleton;
 
-		/**	ASSIMP's animation clip index that was used to create this animation instance.
+		/**	The keys of all animated nodes for the clip which this animation has been created for
 		 */
-		uint32_t mAnimationIndex;
-		
-		/** Maximum number of bone matrices to write into the target storage pointers.
-		 *  (Second tuple element of mMeshIndicesAndTargetStorage)
+		std::shared_ptr<const animation_track_set> mTracks;
+
+		/** Playback state which is used by the `animate` overloads which do not take a playback state.
+		 */
+		animation_playback_state mPlaybackState;
+
+		/** The keys in structure-of-arrays layout, if they have been built, see `build_soa_tracks`
 		 */
-		size_t mMaxNumBoneMatrices;
+		std::shared_ptr<const animation_soa_tracks> mSoaTracks;
 
 		/** Make serialize a friend, so the serializer can access private data members.
 		 *  (see custom serialization functions in serializer.hpp)
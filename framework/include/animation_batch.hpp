@@ -0,0 +1,79 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** One instance of a batch which is animated by `animate_instances_into_single_target_buffer` */
+	struct animation_instance
+	{
+		/** The animation to evaluate. Many instances can (and typically will) refer to the same animation. */
+		const animation* mAnimation = nullptr;
+
+		/** Animation clip to use for this instance */
+		animation_clip_data mClip;
+
+		/** Time in seconds to calculate this instance's bone matrices at */
+		double mTime = 0.0;
+
+		/**	Index of this instance's first bone matrix in the target memory, i.e. the bone matrix of mesh-local bone b of a mesh
+		 *	is written to index `mTargetOffset + mesh_bone_info::mGlobalBoneIndexOffset + b`. The slices of different instances
+		 *	must not overlap; typically, they are `animation::number_of_bone_matrices()` matrices apart.
+		 */
+		size_t mTargetOffset = 0;
+
+		/**	Playback state of this instance. Keep one state per instance across frames to find the keys in O(1).
+		 *	If it is not set, a temporary state is used, i.e. all the keys are looked up with binary search.
+		 */
+		animation_playback_state* mPlaybackState = nullptr;
+	};
+
+	/**	Animates many instances concurrently and writes the bone matrices of all of them into one single target memory, like
+	 *	`animation::animate_into_single_target_buffer` does for one instance. The instances are distributed across all
+	 *	hardware threads by the parallel STL algorithms, whose scheduler balances the load by work stealing.
+	 *	The target memory can be a persistently mapped, host-visible buffer, which is then read by the skinning shaders.
+	 *	All instances are validated before any of them is animated. If animating an instance throws nevertheless, the
+	 *	other instances are still animated, and the first exception is rethrown afterwards.
+	 *
+	 *	@param	aInstances			The instances to animate. No two instances may share a playback state.
+	 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+	 *	@param	aTargetMemory		Pointer to the memory location of the first bone matrix, i.e. where `mTargetOffset` 0 refers to
+	 */
+	extern void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
+
+	/**	Same as the other `animate_instances_into_single_target_buffer` overload, with the bone matrices in mesh space */
+	extern void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, glm::mat4* aTargetMemory);
+
+	/**	Same as the other `animate_instances_into_single_target_buffer` overloads, but writes every bone in the given palette
+	 *	format, see `bone_palette_format`. `animation_instance::mTargetOffset` counts entries of `bytes_per_bone(aFormat)` bytes.
+	 *	@param	aInstances			The instances to animate. No two instances may share a playback state.
+	 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+	 *	@param	aFormat				Format of every bone's entry
+	 *	@param	aTargetMemory		Pointer to the memory location of the first entry, i.e. where `mTargetOffset` 0 refers to
+	 */
+	extern void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory);
+
+	/** Timings measured by `benchmark_animate_instances` */
+	struct animation_batch_benchmark_result
+	{
+		size_t mNumInstances;
+		size_t mNumFrames;
+		size_t mNumHardwareThreads;
+		/** Average time per frame for animating the instances one after the other */
+		double mSerialMillisecondsPerFrame;
+		/** Average time per frame for animating the instances with `animate_instances_into_single_target_buffer` */
+		double mParallelMillisecondsPerFrame;
+
+		double speedup() const { return mSerialMillisecondsPerFrame / mParallelMillisecondsPerFrame; }
+		double parallel_efficiency() const { return speedup() / static_cast<double>(mNumHardwareThreads); }
+	};
+
+	/**	Measures how well `animate_instances_into_single_target_buffer` scales: animates the given number of instances of
+	 *	the given animation (at different points in time) for the given number of frames, once serially and once in parallel,
+	 *	and logs the results. Each instance has its own playback state, as recommended.
+	 *	@param	aAnimation		The animation to evaluate for all instances
+	 *	@param	aClip			Animation clip to use for all instances
+	 *	@param	aNumInstances	Number of instances
+	 *	@param	aNumFrames		Number of frames (of 1/60 second each) to animate
+	 */
+	extern animation_batch_benchmark_result benchmark_animate_instances(const animation& aAnimation, const animation_clip_data& aClip, size_t aNumInstances = 1000, size_t aNumFrames = 60);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	The keys of all the animated nodes of an `animation` in a structure-of-arrays layout, which
+	 *	`animation::animate` uses to evaluate the local transforms of many nodes at once (see `animation::build_soa_tracks`):
+	 *	 - The key times are stored as floats, in one contiguous array per channel (position, rotation, scaling).
+	 *	 - The key values are stored in one contiguous array per channel, in the same order as the times.
+	 *	 - The keys of node n are `[mXKeyOffsets[n], mXKeyOffsets[n + 1])` for every channel X.
+	 *	 - Channels whose keys all have the same value are collapsed to one key, and nodes whose channels all have
+	 *	   at most one key are static: their local transform is computed once and they are skipped during evaluation.
+	 */
+	struct animation_soa_tracks
+	{
+		/**	Converts the keys of the given track set, the resulting tracks are indexed by the skeleton's node indices.
+		 *	@param	aSkeleton	The skeleton which the track set has been created for, provides the local transforms of nodes without keys
+		 *	@param	aTracks		The keys of one animation clip
+		 */
+		static animation_soa_tracks create_from_tracks(const animation_skeleton& aSkeleton, const animation_track_set& aTracks);
+
+		/** Gets the number of animated nodes */
+		size_t number_of_nodes() const { return mIsStatic.size(); }
+
+		/** Returns true if the node at the given index is static, i.e. if its local transform does not depend on time */
+		bool is_static(size_t aNodeIndex) const { return 0 != mIsStatic[aNodeIndex]; }
+
+		/** Gets the number of nodes which are not static */
+		size_t number_of_dynamic_nodes() const { return mDynamicNodes.size(); }
+
+		/** Gets the total number of bytes occupied by the tracks */
+		size_t size_in_bytes() const;
+
+		/**	Evaluates the local transforms of all nodes at the given time. Four nodes are interpolated and composed
+		 *	at once, using SSE2 where it is available. Rotations are interpolated with a polynomial approximation of
+		 *	slerp, whose deviation from the exact slerp is in the order of 1e-4 radians. Times before a node's first
+		 *	key evaluate to the first key's value.
+		 *	@param	aTimeInTicks		Time in ticks to evaluate the tracks at
+		 *	@param	aCursors			One key cursor per node, which is used and updated like by `animation::animate`
+		 *	@param	aLocalTransforms	Receives one local transform per node
+		 */
+		void evaluate_local_transforms(double aTimeInTicks, std::span<animation_key_cursor> aCursors, std::span<glm::mat4> aLocalTransforms) const;
+
+		std::vector<uint32_t> mPositionKeyOffsets;
+		std::vector<float> mPositionTimes;
+		std::vector<glm::vec3> mPositionValues;
+
+		std::vector<uint32_t> mRotationKeyOffsets;
+		std::vector<float> mRotationTimes;
+		std::vector<glm::quat> mRotationValues;
+
+		std::vector<uint32_t> mScalingKeyOffsets;
+		std::vector<float> mScalingTimes;
+		std::vector<glm::vec3> mScalingValues;
+
+		/** One flag per node, non-zero for static nodes */
+		std::vector<uint8_t> mIsStatic;
+		/** Local transform of every static node (identity for all others) */
+		std::vector<glm::mat4> mStaticLocalTransforms;
+		/** Indices of all nodes which are not static, in ascending order */
+		std::vector<uint32_t> mDynamicNodes;
+	};
+}
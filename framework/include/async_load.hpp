@@ -0,0 +1,138 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Receives the progress of a load operation in the range [0, 1].
+	 *	Return false to cancel the load operation, which then fails with a gvk::runtime_error.
+	 */
+	using load_progress_callback = std::function<bool(float)>;
+
+	/**	Forwards Assimp's progress reports to a `load_progress_callback`.
+	 *	Assimp aborts the import if the callback returns false.
+	 */
+	class load_progress_handler : public Assimp::ProgressHandler
+	{
+	public:
+		explicit load_progress_handler(load_progress_callback aCallback)
+			: mCallback{ std::move(aCallback) }
+		{ }
+
+		bool Update(float aPercentage) override;
+
+		/** Returns true if the callback has requested to cancel the import */
+		bool was_cancelled() const { return mCancelled; }
+
+	private:
+		load_progress_callback mCallback;
+		float mLastProgress = 0.0f;
+		bool mCancelled = false;
+	};
+
+	/** State which is shared between a load operation running on a worker thread and its `async_load` handle */
+	struct async_load_state
+	{
+		std::atomic<float> mProgress{ 0.0f };
+		std::atomic<bool> mCancellationRequested{ false };
+		/** Optional user callback, invoked on the worker thread(s) */
+		std::function<void(float)> mOnProgress;
+
+		/** Stores the given progress, invokes the user callback, and returns false if cancellation has been requested. */
+		bool report(float aProgress);
+	};
+
+	/**	Handle to a load operation which runs on a `worker_pool`. Poll it, e.g. once per `invokee::update()`,
+	 *	and fetch the result via `get()` as soon as `is_ready()` returns true, so that the main loop keeps
+	 *	running while the asset is being loaded.
+	 *	Destroying a handle whose result has not been fetched requests cancellation of the load operation.
+	 *	@tparam	T	The type of the loaded asset, e.g. `gvk::model` or `gvk::orca_scene`
+	 */
+	template <typename T>
+	class async_load
+	{
+	public:
+		async_load() = default;
+		async_load(async_load&&) noexcept = default;
+		async_load(const async_load&) = delete;
+		async_load& operator=(async_load&& aOther) noexcept
+		{
+			if (this != &aOther) {
+				cancel();
+				mState = std::move(aOther.mState);
+				mFuture = std::move(aOther.mFuture);
+			}
+			return *this;
+		}
+		async_load& operator=(const async_load&) = delete;
+		~async_load() { cancel(); }
+
+		/**	Starts a load operation on the given worker pool.
+		 *	@param	aLoad		Copyable callable of the form T(const load_progress_callback&) which performs the load
+		 *						operation and regularly reports its progress to the given callback. If the callback
+		 *						returns false, the load operation should be aborted by throwing an exception.
+		 *	@param	aOnProgress	Optional callback which receives progress updates. It is invoked on worker threads!
+		 *	@param	aPool		The worker pool to run the load operation on
+		 */
+		template <typename F>
+		static async_load launch(F aLoad, std::function<void(float)> aOnProgress = {}, worker_pool& aPool = worker_pool::shared())
+		{
+			async_load result;
+			result.mState = std::make_shared<async_load_state>();
+			result.mState->mOnProgress = std::move(aOnProgress);
+			auto promise = std::make_shared<std::promise<T>>();
+			result.mFuture = promise->get_future();
+
+			aPool.submit([lState = result.mState, lPromise = std::move(promise), lLoad = std::move(aLoad)]() {
+				try {
+					if (lState->mCancellationRequested) {
+						throw gvk::runtime_error("The load operation has been cancelled before it has been started.");
+					}
+					lPromise->set_value(lLoad([lState](float bProgress) { return lState->report(bProgress); }));
+					lState->mProgress = 1.0f;
+				}
+				catch (...) {
+					lPromise->set_exception(std::current_exception());
+				}
+			});
+			return result;
+		}
+
+		/** Returns true if this handle refers to a load operation whose result has not been fetched yet */
+		bool valid() const { return mFuture.valid(); }
+
+		/** Returns true if the load operation has finished, i.e. `get()` will not block. */
+		bool is_ready() const
+		{
+			return mFuture.valid() && std::future_status::ready == mFuture.wait_for(std::chrono::seconds(0));
+		}
+
+		/** Gets the most recently reported progress in the range [0, 1] */
+		float progress() const { return mState ? mState->mProgress.load() : 0.0f; }
+
+		/**	Requests cancellation of the load operation. It is aborted at the next progress report,
+		 *	after which `get()` throws a gvk::runtime_error. Has no effect if it has already completed.
+		 */
+		void cancel()
+		{
+			if (mState) {
+				mState->mCancellationRequested = true;
+			}
+		}
+
+		/** Returns true if `cancel()` has been invoked */
+		bool cancellation_requested() const { return mState && mState->mCancellationRequested; }
+
+		/**	Gets the result, blocking until the load operation has finished. Can only be invoked once.
+		 *	Rethrows any exception which has been thrown by the load operation.
+		 */
+		T get()
+		{
+			auto state = std::move(mState);
+			return mFuture.get();
+		}
+
+	private:
+		std::shared_ptr<async_load_state> mState;
+		std::future<T> mFuture;
+	};
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** What `baked_animation_clip::bake` stores per frame */
+	enum struct baked_pose_format
+	{
+		/** The local transform (translation, rotation, scaling) of every animated node; the hierarchy is still evaluated during playback. */
+		local_transforms,
+		/** The final bone matrices of all meshes, i.e. what `animation::animate_into_single_target_buffer` writes. */
+		bone_matrices
+	};
+
+	/**	A clip of an `animation`, sampled at a fixed rate into a cache of poses. Playing back a baked clip does not
+	 *	search or interpolate any keys: the two frames around the requested time are found in O(1), and are either
+	 *	used as they are, or interpolated linearly. The frames are stored frame-major, i.e. all the values of one
+	 *	frame are contiguous in memory. The first frame is at the clip's start time, the last one at its end time.
+	 */
+	struct baked_animation_clip
+	{
+		/**	Samples the given clip at the given rate.
+		 *	The number of frames is chosen s.t. the clip's start and end are sampled exactly, at (at least) the given rate.
+		 *	Frames are sampled in parallel.
+		 *	@param	aAnimation			The animation which the clip belongs to
+		 *	@param	aClip				The clip to bake
+		 *	@param	aFramesPerSecond	Minimum number of frames per second of animation time
+		 *	@param	aFormat				What to store per frame
+		 *	@param	aTargetSpace		Space of the bone matrices, only used with `baked_pose_format::bone_matrices`
+		 */
+		static baked_animation_clip bake(const animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_pose_format aFormat = baked_pose_format::bone_matrices, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space);
+
+		/** Gets the number of frames */
+		size_t number_of_frames() const { return mNumFrames; }
+
+		/** Gets the number of values per frame, i.e. the number of animated nodes or bone matrices, depending on mFormat */
+		size_t pose_size() const { return mPoseSize; }
+
+		/** Gets the total number of bytes occupied by the baked frames */
+		size_t size_in_bytes() const;
+
+		/**	Gets the two frames which the given time lies between, and the interpolation factor between them.
+		 *	If mLooping is set, times outside of the clip wrap around; otherwise, they are clamped to the clip.
+		 *	@param	aTime		Time in seconds, in the same time frame as the time passed to `animation::animate`
+		 */
+		std::tuple<size_t, size_t, float> frame_position(double aTime) const;
+
+		/**	Gets the bone matrices of the given frame, only valid for clips baked with `baked_pose_format::bone_matrices`.
+		 *	The matrices are laid out like `animation::animate_into_single_target_buffer` writes them.
+		 */
+		std::span<const glm::mat4> bone_matrices_of_frame(size_t aFrame) const { return { mBoneMatrices.data() + aFrame * mPoseSize, mPoseSize }; }
+
+		/**	Writes the bone matrices at the given time into the target memory, like `animation::animate_into_single_target_buffer`.
+		 *	Only valid for clips baked with `baked_pose_format::bone_matrices`.
+		 *	@param	aTime			Time in seconds, see `frame_position`
+		 *	@param	aTargetMemory	Pointer to the memory location where the first bone matrix shall be written to
+		 *	@param	aInterpolate	If true, the matrices of the two closest frames are interpolated linearly; otherwise, the nearest frame is copied.
+		 */
+		void sample_bone_matrices(double aTime, glm::mat4* aTargetMemory, bool aInterpolate = true) const;
+
+		/**	Writes the local transforms of all animated nodes at the given time into aLocalTransforms.
+		 *	Only valid for clips baked with `baked_pose_format::local_transforms`.
+		 *	@param	aTime				Time in seconds, see `frame_position`
+		 *	@param	aLocalTransforms	Receives one local transform per animated node
+		 *	@param	aInterpolate		If true, the transforms of the two closest frames are interpolated (rotations along the
+		 *								shorter arc); otherwise, the nearest frame is used.
+		 */
+		void sample_local_transforms(double aTime, std::span<glm::mat4> aLocalTransforms, bool aInterpolate = true) const;
+
+		baked_pose_format mFormat = baked_pose_format::bone_matrices;
+		bone_matrices_space mTargetSpace = bone_matrices_space::mesh_space;
+		/** Animation index and ticks per second of the clip which has been baked */
+		unsigned int mAnimationIndex = 0;
+		double mTicksPerSecond = 0.0;
+		/** Start time and duration of the baked clip in seconds */
+		double mStartTime = 0.0;
+		double mDuration = 0.0;
+		/** Actual sampling rate, which is at least the requested one */
+		double mFramesPerSecond = 0.0;
+		size_t mNumFrames = 0;
+		size_t mPoseSize = 0;
+		/** If set, playback wraps around at the end of the clip, otherwise it stops at the last frame */
+		bool mLooping = true;
+
+		/** Local transforms of all nodes, `mNumFrames * mPoseSize` each, for `baked_pose_format::local_transforms` */
+		std::vector<glm::vec3> mTranslations;
+		std::vector<glm::quat> mRotations;
+		std::vector<glm::vec3> mScalings;
+		/** Bone matrices, `mNumFrames * mPoseSize`, for `baked_pose_format::bone_matrices` */
+		std::vector<glm::mat4> mBoneMatrices;
+	};
+
+	/** Deviation of a baked clip from the exact evaluation of its animation, see `measure_baking_error` */
+	struct baked_animation_error
+	{
+		/** Largest absolute difference of any bone matrix element */
+		float mMaxError = 0.0f;
+		/** Root mean square of the differences of all bone matrix elements */
+		float mRmsError = 0.0f;
+		/** Number of points in time which have been compared */
+		size_t mNumSamples = 0;
+	};
+
+	/**	Compares the bone matrices of a baked clip against the exact evaluation of the animation at points in time between
+	 *	the baked frames (i.e. where the error is the largest), and logs the result together with the baked clip's size.
+	 *	@param	aAnimation			The animation which the clip has been baked from
+	 *	@param	aClip				The clip which has been baked
+	 *	@param	aBakedClip			The baked clip
+	 *	@param	aSamplesPerFrame	Number of points in time to compare per baked frame
+	 *	@param	aInterpolate		Whether to compare the interpolated or the nearest baked frames
+	 */
+	extern baked_animation_error measure_baking_error(const animation& aAnimation, const animation_clip_data& aClip, const baked_animation_clip& aBakedClip, size_t aSamplesPerFrame = 4, bool aInterpolate = true);
+
+	/** Precision of the texels which `export_baked_palettes` writes */
+	enum struct baked_palette_precision
+	{
+		float32,
+		float16
+	};
+
+	/**	Bone matrices of a baked clip, packed for vertex animation on the GPU. The layout is the one of a 2D image with
+	 *	one row per frame and three RGBA texels per bone matrix, which are the first three rows of the (affine) matrix:
+	 *	the texel at (3 * b + r, f) contains row r of bone matrix b in frame f. Hence, a shader transforms a position p
+	 *	with `vec3(dot(row0, vec4(p, 1)), dot(row1, vec4(p, 1)), dot(row2, vec4(p, 1)))`, and can interpolate between
+	 *	two frames with a linear sampler. The same data can be bound as a buffer, at row pitch `mWidth * bytes_per_texel()`.
+	 */
+	struct baked_palette_gpu_data
+	{
+		/** Gets the number of bytes of one texel, i.e. of four values */
+		size_t bytes_per_texel() const { return baked_palette_precision::float16 == mPrecision ? 4 * sizeof(uint16_t) : 4 * sizeof(float); }
+
+		/** Gets the format of the image which the data is laid out for */
+		vk::Format texel_format() const { return baked_palette_precision::float16 == mPrecision ? vk::Format::eR16G16B16A16Sfloat : vk::Format::eR32G32B32A32Sfloat; }
+
+		/** Gets the total number of bytes of mData */
+		size_t size_in_bytes() const { return mData.size(); }
+
+		/** Image width in texels, i.e. three times the number of bone matrices */
+		uint32_t mWidth = 0;
+		/** Image height in texels, i.e. the number of frames */
+		uint32_t mHeight = 0;
+		/** Frame rate of the baked clip, to convert time into the v coordinate */
+		double mFramesPerSecond = 0.0;
+		baked_palette_precision mPrecision = baked_palette_precision::float32;
+		/** Largest absolute difference between any value and its quantized representation */
+		float mMaxQuantizationError = 0.0f;
+		std::vector<uint8_t> mData;
+	};
+
+	/**	Packs the bone matrices of a clip baked with `baked_pose_format::bone_matrices` into the layout of `baked_palette_gpu_data`,
+	 *	and logs its size and quantization error.
+	 *	@param	aBakedClip		The baked clip
+	 *	@param	aPrecision		Precision of the texels
+	 */
+	extern baked_palette_gpu_data export_baked_palettes(const baked_animation_clip& aBakedClip, baked_palette_precision aPrecision = baked_palette_precision::float32);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Memory layout of one bone's entry in a palette of bone matrices, which can be written by
+	 *	`animation::animate_into_single_target_buffer` and `animation::animate_into_strided_target_per_mesh`.
+	 *	The compact formats reduce the amount of data which has to be uploaded per frame.
+	 */
+	enum struct bone_palette_format
+	{
+		/** The full bone matrix as glm::mat4, i.e. 16 floats in column-major order (64 bytes) */
+		mat4,
+		/**	The first three rows of the affine bone matrix, i.e. 12 floats in row-major order (48 bytes).
+		 *	A shader reconstructs the matrix as `transpose(mat4(row0, row1, row2, vec4(0, 0, 0, 1)))`.
+		 */
+		affine_3x4,
+		/** Same as affine_3x4, with half precision floats (24 bytes) */
+		affine_3x4_half,
+		/**	A unit dual quaternion, i.e. the real part (x, y, z, w) followed by the dual part (x, y, z, w) (32 bytes).
+		 *	The real part's w is non-negative. Only rigid transformations can be represented: bone matrices which
+		 *	contain scaling or mirroring are rejected with an exception. Use one of the affine formats for those.
+		 */
+		dual_quaternion,
+		/** Same as dual_quaternion, with half precision floats (16 bytes) */
+		dual_quaternion_half
+	};
+
+	/** Gets the number of bytes which one bone occupies in the given palette format */
+	static constexpr size_t bytes_per_bone(bone_palette_format aFormat)
+	{
+		switch (aFormat) {
+		case bone_palette_format::affine_3x4:
+			return 12 * sizeof(float);
+		case bone_palette_format::affine_3x4_half:
+			return 12 * sizeof(uint16_t);
+		case bone_palette_format::dual_quaternion:
+			return 8 * sizeof(float);
+		case bone_palette_format::dual_quaternion_half:
+			return 8 * sizeof(uint16_t);
+		default:
+			return sizeof(glm::mat4);
+		}
+	}
+
+	/**	Returns true if the given bone matrix can be written in the given palette format, i.e. false for bone matrices which
+	 *	contain scaling or mirroring with one of the dual quaternion formats.
+	 */
+	extern bool is_representable_in_bone_palette(const glm::mat4& aBoneMatrix, bone_palette_format aFormat);
+
+	/**	Converts the given bone matrix into the given palette format and writes it to the given target.
+	 *	Throws if the bone matrix cannot be represented in the given format, see `is_representable_in_bone_palette`.
+	 *	Uses SSE2 for the transposition and the conversion to half precision where it is available.
+	 *	@param	aBoneMatrix		The (affine) bone matrix
+	 *	@param	aFormat			Format to write
+	 *	@param	aTarget			Memory location to write `bytes_per_bone(aFormat)` bytes to, which need not be aligned
+	 */
+	extern void write_bone_palette_entry(const glm::mat4& aBoneMatrix, bone_palette_format aFormat, void* aTarget);
+}
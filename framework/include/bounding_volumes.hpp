@@ -0,0 +1,53 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Axis-aligned bounding box. A default-constructed box is empty, i.e. mMin > mMax, and merging anything into it yields the other operand. */
+	struct bounding_box
+	{
+		glm::vec3 mMin{ std::numeric_limits<float>::max() };
+		glm::vec3 mMax{ std::numeric_limits<float>::lowest() };
+
+		bool is_empty() const { return mMin.x > mMax.x || mMin.y > mMax.y || mMin.z > mMax.z; }
+		glm::vec3 center() const { return (mMin + mMax) * 0.5f; }
+		glm::vec3 extent() const { return mMax - mMin; }
+
+		/** Returns the smallest box which contains this box and the given one */
+		bounding_box merged(const bounding_box& aOther) const { return bounding_box{ glm::min(mMin, aOther.mMin), glm::max(mMax, aOther.mMax) }; }
+
+		/** Returns the smallest axis-aligned box which contains this box after transforming it with the given (affine) matrix */
+		bounding_box transformed(const glm::mat4& aMatrix) const;
+	};
+
+	/** Bounding sphere. A default-constructed sphere is empty, i.e. has a negative radius. */
+	struct bounding_sphere
+	{
+		glm::vec3 mCenter{ 0.0f };
+		float mRadius = -1.0f;
+
+		bool is_empty() const { return mRadius < 0.0f; }
+
+		/** Returns the smallest sphere which contains this sphere and the given one */
+		bounding_sphere merged(const bounding_sphere& aOther) const;
+
+		/** Returns a sphere which contains this sphere after transforming it with the given (affine) matrix. Non-uniform scaling is handled conservatively. */
+		bounding_sphere transformed(const glm::mat4& aMatrix) const;
+	};
+
+	/** Computes the axis-aligned bounding box of the given positions. Uses SSE2 where available. */
+	extern bounding_box compute_bounding_box(const glm::vec3* aPositions, size_t aNumPositions);
+
+	/**	Computes a bounding sphere of the given positions with Ritter's algorithm, which is not minimal, but close to it.
+	 *	@param	aPositions		The positions to be enclosed
+	 *	@param	aNumPositions	Number of positions
+	 *	@param	aBox			The positions' bounding box as computed by `compute_bounding_box`. The sphere around it is returned instead if it is tighter.
+	 */
+	extern bounding_sphere compute_bounding_sphere(const glm::vec3* aPositions, size_t aNumPositions, const bounding_box& aBox);
+
+	/** Merges all the given boxes into one. Returns an empty box if the vector is empty. */
+	extern bounding_box merge_bounding_boxes(const std::vector<bounding_box>& aBoxes);
+
+	/** Merges all the given spheres into one. Returns an empty sphere if the vector is empty. */
+	extern bounding_sphere merge_bounding_spheres(const std::vector<bounding_sphere>& aSpheres);
+}
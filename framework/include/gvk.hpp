@@ -7,6 +7,7 @@
 #include <array>
 #include <string>
 #include <string_view>
+#include <span>
 #include <exception>
 #include <stdexcept>
 #include <unordered_map>
@@ -20,6 +21,8 @@
 #include <fstream>
 #include <queue>
 #include <algorithm>
+#include <numeric>
+#include <execution>
 #include <variant>
 #include <iomanip>
 #include <optional>
@@ -27,6 +30,8 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <future>
 #include <cstdlib>
 #include <typeindex>
 #include <type_traits>
@@ -36,6 +41,7 @@
 #include <filesystem>
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 // ----------------------- externals -----------------------
@@ -46,6 +52,9 @@
 #include <stb_image.h>
 
 #include <assimp/Importer.hpp>  // C++ importer interface
+#include <assimp/ProgressHandler.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/IOStream.hpp>
 #include <assimp/scene.h>       // Output data structure
 #include <assimp/postprocess.h> // Post processing flags
 #include <assimp/anim.h>
@@ -191,12 +200,33 @@ namespace gvk {
 #include "quake_camera.hpp"
 #include "material_config.hpp"
 #include "material_gpu_data.hpp"
+#include "material_config_table.hpp"
 #include "material.hpp"
 #include "lightsource.hpp"
 #include "lightsource_gpu_data.hpp"
 #include "model_types.hpp"
+#include "mesh_optimizer.hpp"
+#include "meshlet.hpp"
+#include "mesh_simplifier.hpp"
+#include "vertex_quantization.hpp"
+#include "bounding_volumes.hpp"
+#include "worker_pool.hpp"
+#include "async_load.hpp"
+#include "mapped_file.hpp"
+#include "pack_archive.hpp"
+#include "virtual_file_system.hpp"
+#include "mesh_store.hpp"
+#include "morph_targets.hpp"
+#include "tangent_space.hpp"
+#include "model_file_format.hpp"
+#include "bone_palette.hpp"
 #include "animation.hpp"
+#include "keyframe_reduction.hpp"
+#include "animation_soa_tracks.hpp"
+#include "animation_batch.hpp"
+#include "baked_animation.hpp"
 #include "model.hpp"
+#include "model_cache.hpp"
 #include "orca_scene.hpp"
 #include "serializer.hpp"
 #include "material_image_helpers.hpp"
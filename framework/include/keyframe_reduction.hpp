@@ -0,0 +1,49 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Error tolerances for `reduce_keyframes`. A key is removed if the interpolation between the keys which are
+	 *	kept reproduces its value within the tolerance of its channel. A tolerance of 0 keeps only keys which are
+	 *	reproduced exactly, e.g. the inner keys of constant runs.
+	 */
+	struct keyframe_reduction_config
+	{
+		/** Maximum distance between a removed position key and the interpolated position, in units of the node's parent space */
+		float mPositionTolerance = 1e-4f;
+		/** Maximum angle between a removed rotation key and the interpolated rotation, in radians */
+		float mRotationTolerance = 1e-4f;
+		/** Maximum difference of any component between a removed scaling key and the interpolated scaling */
+		float mScalingTolerance = 1e-4f;
+		/**	Maximum number of original keys which the interpolation between two kept keys may span. Keys are checked
+		 *	against every candidate segment, i.e. this bounds the cost of reducing n keys to O(n * mMaxKeysPerSegment).
+		 */
+		size_t mMaxKeysPerSegment = 64;
+	};
+
+	/** Statistics of one or multiple calls to `reduce_keyframes` */
+	struct keyframe_reduction_result
+	{
+		size_t mNumKeysBefore = 0;
+		size_t mNumKeysAfter = 0;
+		/** Bytes occupied by the keys before and after the reduction */
+		size_t mBytesBefore = 0;
+		size_t mBytesAfter = 0;
+		/** Largest deviations of any removed key from the interpolation of the kept keys */
+		float mMaxPositionError = 0.0f;
+		float mMaxRotationError = 0.0f;
+		float mMaxScalingError = 0.0f;
+
+		keyframe_reduction_result& operator+=(const keyframe_reduction_result& aOther);
+	};
+
+	/**	Removes the keys of the given node which linear interpolation (positions, scalings) or slerp (rotations) between
+	 *	the remaining keys can reconstruct within the given tolerances. The first and the last key of every channel are
+	 *	kept, unless all keys of a channel are within the tolerance of the first one, in which case only the first is kept.
+	 *	The remaining keys are a subset of the original ones, with unchanged times.
+	 *	Note: `animated_node_keys::mSameRotationAndPositionKeyTimes` and `mSameScalingAndPositionKeyTimes` are not updated.
+	 *	@param	aNode		The keys of one node to reduce
+	 *	@param	aConfig		Tolerances per channel
+	 */
+	extern keyframe_reduction_result reduce_keyframes(animated_node_keys& aNode, const keyframe_reduction_config& aConfig);
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	A whole file, mapped into this process' address space.
+	 *	The operating system loads the file's pages lazily on first access, i.e. mapping even a huge file is
+	 *	cheap, and only the parts which are actually read are paged in.
+	 *	The mapping is copy-on-write: modifications through `data()` are private to this process and are
+	 *	never written back to the file.
+	 */
+	class mapped_file
+	{
+	public:
+		mapped_file() = default;
+		mapped_file(mapped_file&&) noexcept;
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(mapped_file&&) noexcept;
+		mapped_file& operator=(const mapped_file&) = delete;
+		~mapped_file();
+
+		/**	Maps the file at the given path.
+		 *	@param	aPath	Path to an existing file
+		 *	Throws a gvk::runtime_error if the file can not be opened or mapped.
+		 */
+		static mapped_file map(const std::string& aPath);
+
+		/** Gets a pointer to the file's first byte, or nullptr for an empty file. */
+		const std::byte* data() const { return mData; }
+		std::byte* data() { return mData; }
+
+		/** Gets the size of the file in bytes */
+		size_t size() const { return mSize; }
+
+		/** Returns the path of the mapped file */
+		const std::string& path() const { return mPath; }
+
+	private:
+		void unmap();
+
+		std::string mPath;
+		std::byte* mData = nullptr;
+		size_t mSize = 0;
+#ifdef _WIN32
+		HANDLE mFile = INVALID_HANDLE_VALUE;
+		HANDLE mMapping = nullptr;
+#endif
+	};
+}
@@ -153,10 +153,10 @@ namespace gvk
 		if (left.mReflectiveColor				!= right.mReflectiveColor				) return false;
 		if (left.mAlbedo						!= right.mAlbedo						) return false;
 
-		if (left.mRefractionIndex				!= right.mRefractionIndex				) return false;
-		if (left.mReflectivity					!= right.mReflectivity					) return false;
-		if (left.mMetallic						!= right.mMetallic						) return false;
-		if (left.mSmoothness					!= right.mSmoothness					) return false;
+		if (left.mOpacity						!= right.mOpacity						) return false;
+		if (left.mBumpScaling					!= right.mBumpScaling					) return false;
+		if (left.mShininess						!= right.mShininess						) return false;
+		if (left.mShininessStrength				!= right.mShininessStrength				) return false;
 
 		if (left.mRefractionIndex				!= right.mRefractionIndex				) return false;
 		if (left.mReflectivity					!= right.mReflectivity					) return false;
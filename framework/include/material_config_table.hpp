@@ -0,0 +1,80 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Compact ID of an interned texture path, see `material_config_table::intern_texture_path` */
+	using texture_path_id = uint32_t;
+
+	/** Compact ID of an interned material config, see `material_config_table::intern` */
+	using material_id = uint32_t;
+
+	/** Number of texture paths per `material_config`, i.e. `mDiffuseTex` through `mExtraTex` */
+	inline constexpr size_t material_config_num_textures = 12;
+
+	/**	Interning table for `material_config`s: stores every distinct config once, together with its hash and the
+	 *	IDs of its texture paths, and hands out compact, consecutive IDs. Texture paths are interned as well, so that
+	 *	hashing a config only has to hash integer IDs instead of up to twelve strings.
+	 *
+	 *	Two configs get the same ID if and only if they are equal according to `operator==`, which depends on their
+	 *	`mIgnoreCpuOnlyDataForEquality` members, like the keys of an `std::unordered_map<material_config, ...>` do.
+	 *	Hence, once configs have been interned, checking them for equality is a comparison of their IDs, and
+	 *	grouping by config can be done with a bucket sort over the IDs (see `group_by_material_id`).
+	 */
+	class material_config_table
+	{
+	public:
+		/** The empty texture path is always interned with ID 0 */
+		material_config_table();
+		material_config_table(material_config_table&&) noexcept = default;
+		material_config_table(const material_config_table&) = default;
+		material_config_table& operator=(material_config_table&&) noexcept = default;
+		material_config_table& operator=(const material_config_table&) = default;
+		~material_config_table() = default;
+
+		/** Gets the ID of the given texture path, interns it if it has not been interned yet */
+		texture_path_id intern_texture_path(const std::string& aPath);
+
+		/** Gets the texture path with the given ID */
+		const std::string& texture_path(texture_path_id aId) const { return mTexturePaths[aId]; }
+
+		/** Gets the number of distinct texture paths, including the empty one */
+		size_t num_texture_paths() const { return mTexturePaths.size(); }
+
+		/** Gets the ID of the given config, interns it if no equal config has been interned yet */
+		material_id intern(const material_config& aConfig);
+
+		/** Gets the config with the given ID */
+		const material_config& config(material_id aId) const { return mEntries[aId].mConfig; }
+
+		/** Gets the cached hash of the config with the given ID */
+		size_t hash(material_id aId) const { return mEntries[aId].mHash; }
+
+		/** Gets the IDs of the texture paths of the config with the given ID, in the order of `mDiffuseTex` through `mExtraTex` */
+		const std::array<texture_path_id, material_config_num_textures>& texture_path_ids(material_id aId) const { return mEntries[aId].mTexturePathIds; }
+
+		/** Gets the number of distinct configs, i.e. all IDs are smaller than this number */
+		size_t size() const { return mEntries.size(); }
+
+	private:
+		struct entry
+		{
+			material_config mConfig;
+			size_t mHash;
+			std::array<texture_path_id, material_config_num_textures> mTexturePathIds;
+		};
+
+		std::vector<std::string> mTexturePaths;
+		std::unordered_map<std::string, texture_path_id> mTexturePathIds;
+		std::vector<entry> mEntries;
+		// IDs of all configs, by their hash:
+		std::unordered_multimap<size_t, material_id> mIdsByHash;
+	};
+
+	/**	Groups elements by their material IDs with a counting sort, i.e. in linear time and without any hashing.
+	 *	@param	aMaterialIds	One material ID per element, all smaller than aNumMaterialIds
+	 *	@param	aNumMaterialIds	Number of distinct IDs, e.g. `material_config_table::size()`
+	 *	@return	One vector per material ID, containing the indices of all elements with that ID in ascending order
+	 */
+	extern std::vector<std::vector<size_t>> group_by_material_id(const std::vector<material_id>& aMaterialIds, size_t aNumMaterialIds);
+}
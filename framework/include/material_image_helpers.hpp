@@ -84,7 +84,8 @@ namespace gvk
 			if (!aSerializer ||
 				(aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize)) {
 				if (!aAlreadyLoadedGliTexture.has_value()) {
-					aAlreadyLoadedGliTexture = gli::load(aPath);
+					const auto file = virtual_file_system::shared().open(aPath);
+					aAlreadyLoadedGliTexture = gli::load(reinterpret_cast<const char*>(file.data().data()), file.size());
 				}
 				auto& gliTex = aAlreadyLoadedGliTexture.value();
 
@@ -144,7 +145,8 @@ namespace gvk
 				}
 
 				int channelsInFile = 0;
-				pixels = stbi_load(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
+				const auto file = virtual_file_system::shared().open(aPath);
+				pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(file.data().data()), static_cast<int>(file.size()), &width, &height, &channelsInFile, desiredColorChannels);
 				imageSize = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(desiredColorChannels);
 
 				if (!pixels) {
@@ -197,7 +199,8 @@ namespace gvk
 				}
 
 				int channelsInFile = 0;
-				pixels = stbi_loadf(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
+				const auto file = virtual_file_system::shared().open(aPath);
+				pixels = stbi_loadf_from_memory(reinterpret_cast<const stbi_uc*>(file.data().data()), static_cast<int>(file.size()), &width, &height, &channelsInFile, desiredColorChannels);
 				imageSize = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(desiredColorChannels);
 
 				if (!pixels) {
@@ -348,7 +351,8 @@ namespace gvk
 		std::optional<gli::texture> gliTex = {};
 		if (!aSerializer ||
 			(aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize)) {
-			gliTex = gli::load(aPath);
+			const auto file = virtual_file_system::shared().open(aPath);
+			gliTex = gli::load(reinterpret_cast<const char*>(file.data().data()), file.size());
 			if (!gliTex.value().empty()) {
 
 				if (aFlip && (!gli::is_compressed(gliTex.value().format()) || gli::is_s3tc_compressed(gliTex.value().format()))) {
@@ -403,7 +407,7 @@ namespace gvk
 			}
 
 			if (!imFmt.has_value() && aLoadHdrIfPossible) {
-				if (stbi_is_hdr(aPath.c_str())) {
+				if (stbi_is_hdr_from_memory(reinterpret_cast<const stbi_uc*>(file.data().data()), static_cast<int>(file.size()))) {
 					switch (aPreferredNumberOfTextureComponents) {
 					case 4:
 						imFmt = default_rgb16f_4comp_format();
@@ -552,6 +556,13 @@ namespace gvk
 		add_tuple_or_indices(aResult, rest...);
 	}
 
+	template <typename... Rest>
+	void add_tuple_or_indices(std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aResult, const std::shared_ptr<const model_t>& aModel, const Rest&... rest)
+	{
+		aResult.emplace_back(avk::const_referenced(*aModel), std::vector<size_t>{});
+		add_tuple_or_indices(aResult, rest...);
+	}
+
 	template <typename... Rest>
 	void add_tuple_or_indices(std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aResult, size_t aMeshIndex, const Rest&... rest)
 	{
@@ -575,8 +586,134 @@ namespace gvk
 		return result;
 	}
 	
+	/** Describes where the data of one selected mesh is located within the concatenated vertex and index data of a whole selection. */
+	struct mesh_data_range
+	{
+		const model_t* mModel;
+		mesh_index_t mMeshIndex;
+		size_t mVertexOffset;
+		size_t mNumVertices;
+		size_t mIndexOffset;
+		size_t mNumIndices;
+		/** Level of detail which mIndexOffset and mNumIndices refer to, see `model_t::generate_lods` */
+		size_t mLodLevel;
+	};
+
+	/**	Computes the offsets of every selected mesh's data within the concatenated vertex and index data up front
+	 *	(i.e. an exclusive prefix sum over `number_of_vertices_for_mesh` and `number_of_indices_for_mesh`), so that
+	 *	the final data can be allocated once and all meshes can be written concurrently afterwards.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 *	@param	aLodLevel					Level of detail of the index data, see `model_t::generate_lods`
+	 *	@return	One entry per selected mesh, in the same order as in the selection.
+	 */
+	extern std::vector<mesh_data_range> compute_mesh_data_ranges(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel = 0);
+
+	/**	Writes the vertex data of all the given meshes into the given memory according to the given vertex layout,
+	 *	processing the meshes concurrently. See `model_t::write_vertex_data_for_mesh` for further details.
+	 *	@param	aMeshDataRanges		Meshes and their target offsets, as returned by `compute_mesh_data_ranges`
+	 *	@param	aLayout				Attributes, offsets, and stride of the vertex data
+	 *	@param	aDestination		Memory which must be large enough to hold all the vertices of all the meshes
+	 */
+	extern void write_vertex_data_parallel(const std::vector<mesh_data_range>& aMeshDataRanges, const vertex_layout& aLayout, void* aDestination);
+
+	/**	Writes the index data of all the given meshes into the given memory, processing the meshes concurrently.
+	 *	Every mesh's indices are rebased by its vertex offset, like `append_indices_and_vertex_data` does.
+	 *	@param	aMeshDataRanges		Meshes and their target offsets, as returned by `compute_mesh_data_ranges`
+	 *	@param	aDestination		Memory which must be large enough to hold all the indices of all the meshes
+	 */
+	extern void write_indices_parallel(const std::vector<mesh_data_range>& aMeshDataRanges, uint32_t* aDestination);
+
+	/**	Gets one vertex attribute of all the selected meshes, where the meshes are processed concurrently and the result is allocated only once.
+	 *	@tparam	T	Type of the attribute, its size must match `size_of(aAttribute)`, e.g. `glm::vec3` for `vertex_attribute::normal`.
+	 */
+	template <typename T>
+	std::vector<T> get_vertex_attribute_parallel(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vertex_attribute aAttribute, int aSet = 0)
+	{
+		assert(sizeof(T) == size_of(aAttribute));
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes);
+		std::vector<T> result(ranges.empty() ? 0 : ranges.back().mVertexOffset + ranges.back().mNumVertices);
+		write_vertex_data_parallel(ranges, vertex_layout{}.add(aAttribute, aSet), result.data());
+		return result;
+	}
+
+	/** Same as `get_vertices_and_indices`, but the meshes are processed concurrently and the results are allocated only once.
+	 *	The indices are taken from the given level of detail, see `model_t::generate_lods`.
+	 */
+	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices_parallel(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel = 0);
+
+	/**	Gets the indices of the given level of detail of all the selected meshes, see `model_t::generate_lods`.
+	 *	The indices refer to the same concatenated vertex data as the indices of level 0, i.e. all levels of detail
+	 *	can share the vertex buffers which have been created for the same selection, and only the index buffer has to be switched at draw time.
+	 */
+	extern std::vector<uint32_t> get_indices_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel);
+
+	/** Creates an index buffer containing the indices of the given level of detail of all the selected meshes, see `get_indices_for_lod`. */
+	extern avk::buffer create_index_buffer_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+
+	/**	Cuts all the selected meshes into meshlets, processing the meshes concurrently. See `build_meshlets` for details.
+	 *	The meshlets of all meshes are concatenated in the order of the selection, and their vertex indices refer
+	 *	to the concatenated vertex data, i.e. they match the buffers created by `create_vertex_and_index_buffers`
+	 *	and the other `create_*_buffer` functions for the same selection.
+	 *	`meshlet::mMeshIndexInSelection` is set to the index of the mesh within the flattened selection.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 *	@param	aMaxVertices				Maximum number of vertices per meshlet, at most 256
+	 *	@param	aMaxPrimitives				Maximum number of triangles per meshlet
+	 */
+	extern meshlet_data get_meshlets(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aMaxVertices = 64u, uint32_t aMaxPrimitives = 126u);
+
+	/**	Gets the bounding boxes of all the selected meshes, in the order of the selection (see `model_t::bounding_box_for_mesh`).
+	 *	Use `merge_bounding_boxes` to get the bounding box of the whole selection.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 *	@param	aApplyMeshRootMatrices		If true, the boxes are transformed by the meshes' root matrices, otherwise they are in mesh space.
+	 */
+	extern std::vector<bounding_box> get_bounding_boxes(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices = true);
+
+	/**	Gets the bounding spheres of all the selected meshes, in the order of the selection (see `model_t::bounding_sphere_for_mesh`).
+	 *	Use `merge_bounding_spheres` to get a bounding sphere of the whole selection.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 *	@param	aApplyMeshRootMatrices		If true, the spheres are transformed by the meshes' root matrices, otherwise they are in mesh space.
+	 */
+	extern std::vector<bounding_sphere> get_bounding_spheres(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices = true);
+
+	/**	Gets the sparse morph targets of all the selected meshes, grouped by vertex for evaluation on the GPU, see `morph_target_gpu_data`.
+	 *	The vertices are concatenated in the order of the selection, i.e. they match the buffers created by `create_vertex_and_index_buffers`
+	 *	and the other `create_*_buffer` functions for the same selection. Meshes without morph targets get empty delta ranges.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 */
+	extern morph_target_gpu_data get_morph_targets(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Creates two storage buffers which contain the sparse morph targets of all the selected meshes, see `get_morph_targets`:
+	 *	the first one contains `morph_target_gpu_data::mVertexDeltaOffsets` as uint values, the second one `morph_target_gpu_data::mDeltas`.
+	 *	The weights (one float per target) are to be provided by the application, e.g. in a further storage buffer which is updated every frame.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices, in order
+	 *	@param	aUsageFlags					Additional usage flags for the device buffers
+	 *	@param	aSyncHandler				Synchronization handler for the copies from the staging buffers into the device buffers
+	 *	@return	The offsets buffer, the deltas buffer, and the index of every selected mesh's first target within the weights
+	 */
+	extern std::tuple<avk::buffer, avk::buffer, std::vector<uint32_t>> create_morph_target_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+
+	/**	Creates a storage buffer which contains baked bone matrices for vertex animation on the GPU, laid out as described at `baked_palette_gpu_data`.
+	 *	@param	aPalettes					Baked bone matrices, see `export_baked_palettes`
+	 *	@param	aUsageFlags					Additional usage flags for the device buffer
+	 *	@param	aSyncHandler				Synchronization handler for the copy from the staging buffer into the device buffer
+	 */
+	extern avk::buffer create_baked_palette_buffer(const baked_palette_gpu_data& aPalettes, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+
 	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/** Same as `create_vertex_and_index_buffers`, but the index buffer contains the indices of the given level of detail, see `get_indices_for_lod`. */
+	extern std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern size_t number_of_vertices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Create a vertex buffer which contains interleaved vertex data of all the selected meshes, laid out according to the given vertex layout.
+	 *	The vertex data is written directly into mapped staging memory in one pass over each mesh (see `model_t::write_vertex_data_for_mesh`),
+	 *	i.e. without creating any intermediate vectors. The buffer's meta data describes all of the layout's members.
+	 *	@param	aModelsAndSelectedMeshes	Models and the mesh indices to write the vertex data of, in order
+	 *	@param	aLayout						Attributes, offsets, and stride of the interleaved vertex data
+	 *	@param	aUsageFlags					Additional usage flags for the device buffer
+	 *	@param	aSyncHandler				Synchronization handler for the copy from the staging buffer into the device buffer
+	 */
+	extern avk::buffer create_interleaved_vertex_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const vertex_layout& aLayout, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::vec3> get_normals(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern avk::buffer create_normals_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::vec3> get_tangents(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
@@ -590,6 +727,36 @@ namespace gvk
 	extern avk::buffer create_bone_weights_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
 	extern avk::buffer create_bone_indices_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/** Compact skinning data: normalized bone weights quantized to unorm8x4 or unorm16x4, and bone indices as uint8x4. See `model_t::bone_weights_for_mesh_unorm8` et al. */
+	extern std::vector<glm::u8vec4> get_bone_weights_unorm8(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+	extern avk::buffer create_bone_weights_unorm8_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<glm::u16vec4> get_bone_weights_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+	extern avk::buffer create_bone_weights_unorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<glm::u8vec4> get_bone_indices_u8(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
+	extern avk::buffer create_bone_indices_u8_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/** Compact normals and tangents: unit vectors encoded with the octahedral mapping into snorm16x2, see `encode_octahedral_snorm16`. Decode them in the shader. */
+	extern std::vector<glm::i16vec2> get_normals_octahedral_snorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+	extern avk::buffer create_normals_octahedral_snorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<glm::i16vec2> get_tangents_octahedral_snorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+	extern avk::buffer create_tangents_octahedral_snorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/** Compact texture coordinates: half floats (for any range, e.g. tiling textures) or unorm16 (for texture coordinates within [0, 1] only, values outside are clamped). */
+	extern std::vector<glm::u16vec2> get_2d_texture_coordinates_half(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped = false);
+	extern avk::buffer create_2d_texture_coordinates_half_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipped = false, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<glm::u16vec2> get_2d_texture_coordinates_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped = false);
+	extern avk::buffer create_2d_texture_coordinates_unorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipped = false, avk::sync aSyncHandler = avk::sync::wait_idle());
+
+	/**	Gets the positions of all the selected meshes quantized to unorm16x4 (the fourth component is 0), relative to each mesh's
+	 *	axis-aligned bounding box, or relative to the bounding box of the whole selection if aSharedBounds is true.
+	 *	@return	The quantized positions and one dequantization transform per selected mesh, in the order of the selection.
+	 *			`quantization_transform::to_mat4()` maps the positions which the vertex shader gets from the unorm16
+	 *			format (i.e. within [0, 1]) back to the mesh's original model space.
+	 */
+	extern std::tuple<std::vector<glm::u16vec4>, std::vector<quantization_transform>> get_positions_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds = false);
+
+	/** Same as `create_vertex_and_index_buffers`, but with positions quantized to unorm16x4. See `get_positions_unorm16` for the returned dequantization transforms. */
+	extern std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/** Same as `create_quantized_vertex_and_index_buffers`, but the index buffer contains the indices of the given level of detail, see `get_indices_for_lod`. */
+	extern std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, bool aSharedBounds = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset = 0u);
 	extern avk::buffer create_bone_indices_for_single_target_buffer_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices);
@@ -604,8 +771,19 @@ namespace gvk
 	/** *cached versions for serialization */
 	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_index_buffer_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_interleaved_vertex_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const vertex_layout& aLayout, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<bounding_box> get_bounding_boxes_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices = true);
+	extern std::vector<bounding_sphere> get_bounding_spheres_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices = true);
+	extern meshlet_data get_meshlets_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aMaxVertices = 64u, uint32_t aMaxPrimitives = 126u);
 	extern std::vector<glm::vec3> get_normals_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern avk::buffer create_normals_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	/**	Generates tangents for all the given meshes of the given model which do not contain tangents (see `model_t::generate_tangents`),
+	 *	and stores them in the cache file. When deserializing, the tangents are restored from the cache file and assigned to the model
+	 *	instead, i.e. they are not generated again.
+	 */
+	extern void generate_tangents_cached(gvk::serializer& aSerializer, model_t& aModel, const std::vector<mesh_index_t>& aMeshIndices, int aTexCoordSet = 0);
 	extern std::vector<glm::vec3> get_tangents_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern avk::buffer create_tangents_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::vec3> get_bitangents_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
@@ -617,6 +795,15 @@ namespace gvk
 	extern avk::buffer create_bone_weights_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
 	extern avk::buffer create_bone_indices_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_bone_weights_unorm8_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_bone_weights_unorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_bone_indices_u8_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_normals_octahedral_snorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_tangents_octahedral_snorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_2d_texture_coordinates_half_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipped = false, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern avk::buffer create_2d_texture_coordinates_unorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipped = false, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, bool aSharedBounds = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset = 0u);
 	extern avk::buffer create_bone_indices_for_single_target_buffer_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset = 0u, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices);
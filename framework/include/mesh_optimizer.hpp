@@ -0,0 +1,114 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Optimization steps which can be applied to a triangle mesh's index and vertex data */
+	enum struct mesh_optimization
+	{
+		none			= 0x00,
+		/** Reorder triangles for post-transform vertex cache locality (Forsyth's algorithm) */
+		vertex_cache	= 0x01,
+		/** Reorder clusters of triangles to reduce overdraw, while preserving most of the vertex cache locality */
+		overdraw		= 0x02,
+		/** Reorder vertices in the order of their first use for vertex fetch locality */
+		vertex_fetch	= 0x04,
+		/** All of the above */
+		all				= vertex_cache | overdraw | vertex_fetch
+	};
+
+	inline mesh_optimization operator| (mesh_optimization a, mesh_optimization b)
+	{
+		typedef std::underlying_type<mesh_optimization>::type EnumType;
+		return static_cast<mesh_optimization>(static_cast<EnumType>(a) | static_cast<EnumType>(b));
+	}
+
+	inline mesh_optimization operator& (mesh_optimization a, mesh_optimization b)
+	{
+		typedef std::underlying_type<mesh_optimization>::type EnumType;
+		return static_cast<mesh_optimization>(static_cast<EnumType>(a) & static_cast<EnumType>(b));
+	}
+
+	inline mesh_optimization& operator |= (mesh_optimization& a, mesh_optimization b)
+	{
+		return a = a | b;
+	}
+
+	inline mesh_optimization& operator &= (mesh_optimization& a, mesh_optimization b)
+	{
+		return a = a & b;
+	}
+
+	/** Result of simulating a FIFO post-transform vertex cache over an index buffer */
+	struct vertex_cache_statistics
+	{
+		/** Number of vertex shader invocations, i.e. cache misses */
+		size_t mVerticesTransformed = 0;
+		size_t mNumTriangles = 0;
+		size_t mNumUniqueVertices = 0;
+		/** Average cache miss ratio: transformed vertices per triangle. 0.5 is the optimum for large, regular meshes, 3.0 the worst case. */
+		float mAcmr = 0.0f;
+		/** Average transform to vertex ratio: transformed vertices per referenced vertex. 1.0 is the optimum. */
+		float mAtvr = 0.0f;
+	};
+
+	/** Before/after statistics of one optimized mesh, as returned by `model_t::optimize_meshes` */
+	struct mesh_optimization_statistics
+	{
+		mesh_index_t mMeshIndex;
+		vertex_cache_statistics mBefore;
+		vertex_cache_statistics mAfter;
+	};
+
+	/**	Simulates a FIFO post-transform vertex cache of the given size over the given triangle list.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices which are referenced by aIndices
+	 *	@param	aCacheSize		Number of entries of the simulated cache
+	 */
+	extern vertex_cache_statistics analyze_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices, uint32_t aCacheSize = 16u);
+
+	/**	Reorders the triangles of the given triangle list for post-transform vertex cache locality,
+	 *	using Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" algorithm.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices which are referenced by aIndices
+	 *	@return	Reordered triangle list indices, referring to the same vertices
+	 */
+	extern std::vector<uint32_t> optimize_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices);
+
+	/**	Reorders clusters of triangles of the given, already vertex cache-optimized triangle list so that
+	 *	triangles which are likely to occlude others are drawn first (Sander et al., "Fast Triangle Reordering
+	 *	for Vertex Locality and Reduced Overdraw"). Clusters are split such that the resulting ACMR degrades by
+	 *	at most the given threshold factor.
+	 *	@param	aIndices		Vertex cache-optimized triangle list indices
+	 *	@param	aPositions		Vertex positions, indexed by aIndices
+	 *	@param	aCacheSize		Number of entries of the simulated cache
+	 *	@param	aThreshold		Factor by which the ACMR is allowed to degrade, e.g. 1.05f
+	 *	@return	Reordered triangle list indices, referring to the same vertices
+	 */
+	extern std::vector<uint32_t> optimize_overdraw(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, uint32_t aCacheSize = 16u, float aThreshold = 1.05f);
+
+	/**	Computes a vertex remap table which orders vertices by their first use in the given triangle list,
+	 *	for vertex fetch locality. Vertices which are not referenced at all are moved to the end.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices
+	 *	@return	Remap table with aNumVertices entries: the new index for each old vertex index
+	 */
+	extern std::vector<uint32_t> optimize_vertex_fetch_remap(const std::vector<uint32_t>& aIndices, size_t aNumVertices);
+
+	/** Applies a remap table, as returned by `optimize_vertex_fetch_remap`, to the given indices. */
+	extern void remap_indices(std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aRemap);
+
+	/** Applies a remap table, as returned by `optimize_vertex_fetch_remap`, to one vertex attribute stream.
+	 *	Invoke this for each one of a mesh's attribute streams.
+	 */
+	template <typename T>
+	void remap_vertex_data(std::vector<T>& aVertexData, const std::vector<uint32_t>& aRemap)
+	{
+		assert(aVertexData.size() == aRemap.size());
+		std::vector<T> remapped(aVertexData.size());
+		for (size_t i = 0; i < aRemap.size(); ++i) {
+			remapped[aRemap[i]] = std::move(aVertexData[i]);
+		}
+		aVertexData = std::move(remapped);
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** One simplified level of detail of a mesh. Its indices refer to the original mesh's vertices. */
+	struct mesh_lod
+	{
+		/** Triangle list indices */
+		std::vector<uint32_t> mIndices;
+		/** Geometric error of this level, relative to the extent of the mesh, i.e. 0.01 means 1% of the mesh's size. */
+		float mError = 0.0f;
+	};
+
+	/** Target of one level of detail, see `model_t::generate_lods` */
+	struct lod_level_config
+	{
+		/** Target number of indices w.r.t. the original mesh, e.g. 0.25f */
+		float mTargetRatio;
+		/** Maximum error relative to the extent of the mesh, e.g. 0.01f */
+		float mTargetError = 0.01f;
+	};
+
+	/**	Simplifies a triangle list via edge collapses, prioritized by quadric error metrics (Garland and Heckbert).
+	 *	Only the index data is changed, i.e. the simplified triangle list refers to a subset of the original vertices,
+	 *	and no vertex data has to be created or modified.
+	 *	Vertices at attribute seams (i.e. multiple vertices sharing one position, but with different normals
+	 *	or texture coordinates) are never removed, and vertices on open borders are only collapsed along the border,
+	 *	so that neither seams nor silhouettes tear open.
+	 *	@param	aIndices			Triangle list indices
+	 *	@param	aPositions			Vertex positions, indexed by aIndices
+	 *	@param	aTargetIndexCount	Simplification stops when the number of indices has been reduced to this number...
+	 *	@param	aTargetError		...or if any further collapse would exceed this error, relative to the extent of the mesh.
+	 *	@return	The simplified triangle list and its error
+	 */
+	extern mesh_lod simplify_mesh(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, size_t aTargetIndexCount, float aTargetError = 0.01f);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Location of one vertex attribute stream of one mesh within `mesh_store::mVertexData` */
+	struct mesh_store_stream
+	{
+		/** Offset of the stream's first float */
+		uint64_t mOffset = 0;
+		/** Number of floats per vertex, 0 if the mesh does not have this attribute */
+		uint32_t mNumComponents = 0;
+	};
+
+	/** One bone of a mesh, its weights are stored in `mesh_store::mBoneWeights` */
+	struct mesh_store_bone
+	{
+		std::string mName;
+		glm::mat4 mOffsetMatrix;
+		uint64_t mWeightsOffset = 0;
+		uint32_t mNumWeights = 0;
+	};
+
+	/** One <vertex, weight> pair of a bone */
+	struct mesh_store_bone_weight
+	{
+		uint32_t mVertexId;
+		float mWeight;
+	};
+
+	/** Describes one mesh within a `mesh_store` */
+	struct mesh_store_mesh
+	{
+		std::string mName;
+		uint32_t mMaterialIndex = 0;
+		/** Combination of aiPrimitiveType flags */
+		uint32_t mPrimitiveTypes = 0;
+		uint32_t mNumVertices = 0;
+		uint64_t mIndicesOffset = 0;
+		uint32_t mNumIndices = 0;
+		mesh_store_stream mPositions;
+		mesh_store_stream mNormals;
+		mesh_store_stream mTangents;
+		mesh_store_stream mBitangents;
+		std::array<mesh_store_stream, AI_MAX_NUMBER_OF_COLOR_SETS> mColors;
+		std::array<mesh_store_stream, AI_MAX_NUMBER_OF_TEXTURECOORDS> mTextureCoordinates;
+		uint64_t mBonesOffset = 0;
+		uint32_t mNumBones = 0;
+	};
+
+	/**	Compact, structure-of-arrays copy of all the meshes of an Assimp scene.
+	 *	Every attribute stream of every mesh is stored tightly packed in one single float array, i.e. positions, normals,
+	 *	texture coordinates, etc. are each contiguous, and texture coordinates only occupy as many components as they have.
+	 *	All the indices are stored in one single index array, all the bones and their weights in two further arrays.
+	 *	This is what a `model_t` serves its data from after `model_t::release_scene` has been invoked, or after it
+	 *	has been loaded from a binary model file.
+	 *
+	 *	The bulk arrays are spans into memory which is owned by `mStorage`. That is either heap memory which has been
+	 *	allocated by `create_from_scene`, or a mapped binary model file (see `model_t::load_from_binary_file`).
+	 */
+	struct mesh_store
+	{
+		std::vector<mesh_store_mesh> mMeshes;
+		std::vector<mesh_store_bone> mBones;
+		std::span<float> mVertexData;
+		std::span<uint32_t> mIndices;
+		std::span<mesh_store_bone_weight> mBoneWeights;
+
+		/** Keeps the memory alive which the spans refer to */
+		std::shared_ptr<void> mStorage;
+
+		/** Converts all the meshes of the given scene. The meshes' data is copied in parallel. */
+		static mesh_store create_from_scene(const aiScene* aScene);
+
+		/** Gets a pointer to the first float of the given stream, or nullptr if the mesh does not have it */
+		const float* data(const mesh_store_stream& aStream) const { return 0 == aStream.mNumComponents ? nullptr : mVertexData.data() + aStream.mOffset; }
+		float* data(const mesh_store_stream& aStream) { return 0 == aStream.mNumComponents ? nullptr : mVertexData.data() + aStream.mOffset; }
+
+		/** Gets the total number of bytes occupied by this store's arrays */
+		size_t size_in_bytes() const;
+	};
+}
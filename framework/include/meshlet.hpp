@@ -0,0 +1,65 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** One meshlet, i.e. a small cluster of triangles which can be processed by one mesh shader workgroup.
+	 *	The struct is laid out in blocks of 16 bytes, so that it can be uploaded into a storage buffer and
+	 *	be used with std430 layout directly.
+	 */
+	struct meshlet
+	{
+		/** Offset of this meshlet's first entry in `meshlet_data::mVertexIndices` */
+		uint32_t mVertexOffset = 0;
+		/** Offset of this meshlet's first entry in `meshlet_data::mPrimitiveIndices` (three entries per triangle) */
+		uint32_t mPrimitiveOffset = 0;
+		/** Number of vertices of this meshlet */
+		uint32_t mVertexCount = 0;
+		/** Number of triangles of this meshlet */
+		uint32_t mPrimitiveCount = 0;
+
+		/** Bounding sphere of the meshlet's vertices, in the space of the mesh's vertex positions */
+		glm::vec3 mCenter{ 0.0f };
+		float mRadius = 0.0f;
+
+		/** Normal cone: A meshlet can be culled (all its triangles are back-facing) if
+		 *	`dot(normalize(mConeApex - cameraPosition), mConeAxis) >= mConeCutoff`.
+		 *	A cutoff of 1.0 means that the normal cone is too wide to be used for culling.
+		 */
+		glm::vec3 mConeAxis{ 0.0f, 0.0f, 1.0f };
+		float mConeCutoff = 1.0f;
+		glm::vec3 mConeApex{ 0.0f };
+
+		/** Index of the mesh within the selection this meshlet has been built from, see `get_meshlets`; 0 for `build_meshlets`. */
+		uint32_t mMeshIndexInSelection = 0;
+	};
+
+	/** Meshlets of one or multiple meshes, together with the index data they refer to */
+	struct meshlet_data
+	{
+		std::vector<meshlet> mMeshlets;
+		/** Vertex indices of all meshlets, i.e. each meshlet's local vertex i refers to the vertex at `mVertexIndices[mVertexOffset + i]` */
+		std::vector<uint32_t> mVertexIndices;
+		/** Meshlet-local vertex indices of all meshlets' triangles, three per triangle */
+		std::vector<uint8_t> mPrimitiveIndices;
+	};
+
+	/**	Cuts the given triangle list into meshlets, greedily in the order of the triangles. It is therefore recommended to
+	 *	optimize the triangle order for vertex cache locality beforehand, see `model_t::optimize_meshes`.
+	 *	Bounding spheres and normal cones are computed for every meshlet.
+	 *	@param	aIndices			Triangle list indices
+	 *	@param	aPositions			Vertex positions, indexed by aIndices
+	 *	@param	aMaxVertices		Maximum number of vertices per meshlet, at most 256
+	 *	@param	aMaxPrimitives		Maximum number of triangles per meshlet
+	 *	@return	The meshlets, with vertex indices referring to aPositions
+	 */
+	extern meshlet_data build_meshlets(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, uint32_t aMaxVertices = 64u, uint32_t aMaxPrimitives = 126u);
+
+	/**	Appends the meshlets of aSource to aTarget, adapting all the offsets.
+	 *	@param	aTarget						Meshlets to append to
+	 *	@param	aSource						Meshlets to be appended
+	 *	@param	aVertexIndexOffset			Value to be added to each one of aSource's vertex indices
+	 *	@param	aMeshIndexInSelection		Value to be assigned to `meshlet::mMeshIndexInSelection` of aSource's meshlets
+	 */
+	extern void append_meshlets(meshlet_data& aTarget, const meshlet_data& aSource, uint32_t aVertexIndexOffset, uint32_t aMeshIndexInSelection);
+}
@@ -17,11 +17,55 @@ namespace gvk
 		model_t& operator=(const model_t&) = delete;
 		~model_t() = default;
 
+		/** Gets Assimp's scene, or nullptr if it has been released via `release_scene`. */
 		const auto* handle() const { return mScene; }
 
-		static avk::owning_resource<model_t> load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
+		/**	Loads a model via Assimp.
+		 *	@param	aPath			Path to the model file
+		 *	@param	aAssimpFlags	Assimp's post processing flags
+		 *	@param	aReleaseScene	If true, the meshes are converted into a compact mesh store and Assimp's scene is released right away, see `release_scene`.
+		 *	@param	aProgressCallback	Optional callback which receives Assimp's import progress. If it returns false, the import is
+		 *								cancelled and a gvk::runtime_error is thrown.
+		 */
+		static avk::owning_resource<model_t> load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, bool aReleaseScene = false, const load_progress_callback& aProgressCallback = {});
+
+		/**	Loads a model via Assimp on the shared worker pool (see `worker_pool::shared`), without blocking the caller.
+		 *	Poll the returned handle, e.g. in `invokee::update()`, and fetch the model via `get()` once it `is_ready()`.
+		 *	Parameters are the same as for `load_from_file`, except for:
+		 *	@param	aOnProgress		Optional callback which receives the import progress in the range [0, 1]. It is invoked on a worker thread!
+		 */
+		static async_load<avk::owning_resource<model_t>> load_from_file_async(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, bool aReleaseScene = false, std::function<void(float)> aOnProgress = {});
 		
-		static avk::owning_resource<model_t> load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
+		static avk::owning_resource<model_t> load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, bool aReleaseScene = false);
+
+		/**	Loads a model from a binary model file which has been written by `save_to_binary_file` (see `model_file_format.hpp`).
+		 *	The file is mapped into memory, and vertex data, indices, and bone weights are served straight from its pages,
+		 *	i.e. there is no parsing and no copying of bulk data. Pages are loaded by the OS on first access.
+		 *	The resulting model has no Assimp scene (see `release_scene`), and contains neither lights nor cameras.
+		 *	@param	aPath			Path to the binary model file
+		 */
+		static avk::owning_resource<model_t> load_from_binary_file(const std::string& aPath);
+
+		/**	Writes this model into a versioned, page-aligned binary model file, which can be loaded via `load_from_binary_file`.
+		 *	Stores all the meshes' vertex attributes, indices, and bones, the node hierarchy, the material names and
+		 *	material configs (including modifications via `set_material_config_for_mesh`), and all animation tracks.
+		 *	Lights, cameras, and generated levels of detail are not stored.
+		 *	@param	aPath			Path to the binary model file to be written
+		 */
+		void save_to_binary_file(const std::string& aPath) const;
+
+		/**	Converts all the meshes into a compact structure-of-arrays mesh store (see `mesh_store`), converts the
+		 *	node table, the material configs, the lights and the cameras into native representations, and releases
+		 *	the Assimp importer and scene afterwards. All the getters are served from the compact data from then on.
+		 *	Modifications like `optimize_meshes` and `generate_lods` continue to work on the compact data.
+		 *	Animations have been converted right after loading and are not affected by releasing the scene.
+		 *	Only `select_meshes` requires the scene, since it passes aiMesh pointers.
+		 *	Does nothing if the scene has already been released.
+		 */
+		void release_scene();
+
+		/** Returns true if Assimp's scene is still available, i.e. `release_scene` has not been invoked. */
+		bool has_scene() const { return nullptr != mScene; }
 
 		/** Returns this model's path where it has been loaded from */
 		auto path() const { return mModelPath; }
@@ -37,6 +81,38 @@ namespace gvk
 		 */
 		glm::mat4 mesh_root_matrix(mesh_index_t aMeshIndex) const;
 
+		/** Gets the tight axis-aligned bounding box of the mesh at the given index, in the space of its vertex positions.
+		 *	Bounding volumes are computed once per mesh and cached afterwards.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		Reference to the cached bounding box, which stays valid for the lifetime of this model.
+		 */
+		const bounding_box& bounding_box_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the bounding sphere of the mesh at the given index, in the space of its vertex positions.
+		 *	Bounding volumes are computed once per mesh and cached afterwards.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		Reference to the cached bounding sphere, which stays valid for the lifetime of this model.
+		 */
+		const bounding_sphere& bounding_sphere_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the bounding box of the mesh at the given index, transformed by its mesh root matrix, i.e. relative to the model's root. */
+		bounding_box transformed_bounding_box_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the bounding sphere of the mesh at the given index, transformed by its mesh root matrix, i.e. relative to the model's root. */
+		bounding_sphere transformed_bounding_sphere_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the bounding box which encloses all the given meshes.
+		 *	@param		aMeshIndices				The indices of the meshes to be enclosed
+		 *	@param		aApplyMeshRootMatrices		If true, the meshes' bounding boxes are transformed by their mesh root matrices before merging them.
+		 */
+		bounding_box bounding_box_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, bool aApplyMeshRootMatrices = true) const;
+
+		/** Gets a bounding sphere which encloses all the given meshes' bounding spheres.
+		 *	@param		aMeshIndices				The indices of the meshes to be enclosed
+		 *	@param		aApplyMeshRootMatrices		If true, the meshes' bounding spheres are transformed by their mesh root matrices before merging them.
+		 */
+		bounding_sphere bounding_sphere_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, bool aApplyMeshRootMatrices = true) const;
+
 		/**	Gets the actual number of bones that are associated to the given mesh index.
 		 *	This number corresponds exactly to what ASSIMP's data structure reflects.
 		 */
@@ -93,8 +169,9 @@ namespace gvk
 		 *	@return		`material_config` struct, representing the "type of material". 
 		 *				To actually load all the resources it refers to, you'll have 
 		 *				to create a `material` based on it.
+		 *	Material configs are created lazily, guarded by a mutex, i.e. this may be invoked concurrently.
 		 */
-		material_config material_config_for_mesh(mesh_index_t aMeshIndex);
+		material_config material_config_for_mesh(mesh_index_t aMeshIndex) const;
 
 		/**	Sets some material config struct for the mesh at the given index.
 		 *	@param	aMeshIndex			The index corresponding to the mesh
@@ -102,6 +179,18 @@ namespace gvk
 		 */
 		void set_material_config_for_mesh(mesh_index_t aMeshIndex, const material_config& aMaterialConfig);
 
+		/**	Gets the compact ID of the material config of the mesh at the given index, as it is interned into `material_table`.
+		 *	Two meshes have the same ID if and only if their material configs are equal, including all the CPU-only data,
+		 *	i.e. checking meshes for identical materials is a comparison of their IDs.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		material_id material_id_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/**	Gets the table which all the material configs of this model are interned into, see `material_id_for_mesh`.
+		 *	Material configs are interned lazily => do not use the returned reference while other threads are querying material IDs.
+		 */
+		const material_config_table& material_table() const { return mMaterialTable; }
+
 		/**	Gets all distinct `material_config` structs foor this model and, as a bonus, so to say,
 		 *	also gets all the mesh indices which have the materials assigned to.
 		 *	@param	aAlsoConsiderCpuOnlyDataForDistinctMaterials	Setting this parameter to `true` means that for determining if a material is unique or not,
@@ -115,7 +204,7 @@ namespace gvk
 		 *	@return	A `std::unordered_map` containing the distinct `material_config` structs as the
 		 *			keys and a vector of mesh indices as the value type, i.e. `std::vector<size_t>`. 
 		 */
-		std::unordered_map<material_config, std::vector<mesh_index_t>> distinct_material_configs(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false);
+		std::unordered_map<material_config, std::vector<mesh_index_t>> distinct_material_configs(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false) const;
 			
 		/** Gets the number of vertices for the mesh at the given index.
 		 *	@param		aMeshIndex		The index corresponding to the mesh
@@ -124,7 +213,7 @@ namespace gvk
 		 *				`tangents_for_mesh`, `bitangents_for_mesh`, `colors_for_mesh`, 
 		 *				and `texture_coordinates_for_mesh`
 		 */
-		inline size_t number_of_vertices_for_mesh(mesh_index_t aMeshIndex) const;
+		size_t number_of_vertices_for_mesh(mesh_index_t aMeshIndex) const;
 
 		/** Gets all the positions for the mesh at the given index.
 		 *	@param		aMeshIndex		The index corresponding to the mesh
@@ -143,7 +232,8 @@ namespace gvk
 		std::vector<glm::vec3> normals_for_mesh(mesh_index_t aMeshIndex) const;
 
 		/** Gets all the tangents for the mesh at the given index.
-		 *	If the mesh has no tangents, a vector filled with values is
+		 *	If the mesh has no tangents, they are generated from its normals and texture coordinates once
+		 *	(see `generate_tangents`). If that is not possible either, a vector filled with values is
 		 *	returned regardless. All the values will be set to (1,0,0) in this case.
 		 *	@param		aMeshIndex		The index corresponding to the mesh
 		 *	@return		Vector of tangents, converted to `glm::vec3`
@@ -152,7 +242,8 @@ namespace gvk
 		std::vector<glm::vec3> tangents_for_mesh(mesh_index_t aMeshIndex) const;
 
 		/** Gets all the bitangents for the mesh at the given index.
-		 *	If the mesh has no bitangents, a vector filled with values is
+		 *	If the mesh has no tangents, they are generated from its normals and texture coordinates once
+		 *	(see `generate_tangents`). If that is not possible either, a vector filled with values is
 		 *	returned regardless. All the values will be set to (0,1,0) in this case.
 		 *	@param		aMeshIndex		The index corresponding to the mesh
 		 *	@return		Vector of bitangents, converted to `glm::vec3`
@@ -180,6 +271,40 @@ namespace gvk
 		 */
 		std::vector<glm::vec4> bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights = false) const;
 
+		/** Gets the four most important bone influences of every vertex of the mesh at the given index.
+		 *	They are computed once per mesh and cached afterwards, i.e. subsequent calls to this method,
+		 *	`bone_weights_for_mesh`, `bone_indices_for_mesh`, and their compact variants are cheap.
+		 *	Must not be invoked for meshes without bones.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		Reference to the cached bone influences, which stays valid for the lifetime of this model.
+		 */
+		const bone_influences& bone_influences_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets all the bone weights for the mesh at the given index, normalized and quantized to 8-bit unsigned normalized values,
+		 *	i.e. to be used with `vk::Format::eR8G8B8A8Unorm`. The quantized weights of each vertex add up to exactly 255.
+		 *	If the mesh has no bone weights, a vector filled with values is returned regardless. All the values will be set to (255,0,0,0) in this case.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		Vector of bone weights of length `number_of_vertices_for_mesh()`
+		 */
+		std::vector<glm::u8vec4> bone_weights_for_mesh_unorm8(mesh_index_t aMeshIndex) const;
+
+		/** Gets all the bone weights for the mesh at the given index, normalized and quantized to 16-bit unsigned normalized values,
+		 *	i.e. to be used with `vk::Format::eR16G16B16A16Unorm`. The quantized weights of each vertex add up to exactly 65535.
+		 *	If the mesh has no bone weights, a vector filled with values is returned regardless. All the values will be set to (65535,0,0,0) in this case.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		Vector of bone weights of length `number_of_vertices_for_mesh()`
+		 */
+		std::vector<glm::u16vec4> bone_weights_for_mesh_unorm16(mesh_index_t aMeshIndex) const;
+
+		/** Gets all the "mesh-local" bone indices for the mesh at the given index as 8-bit unsigned integers,
+		 *	i.e. to be used with `vk::Format::eR8G8B8A8Uint`. See `bone_indices_for_mesh` for further details.
+		 *	Throws if a resulting bone index does not fit into 8 bits.
+		 *	@param		aMeshIndex			The index corresponding to the mesh
+		 *	@param		aBoneIndexOffset	An offset to be added to every single bone index returned by this method.
+		 *	@return		Vector of bone indices, of length `number_of_vertices_for_mesh()`
+		 */
+		std::vector<glm::u8vec4> bone_indices_for_mesh_u8(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset = 0) const;
+
 		/** Gets all the "mesh-local" bone indices for the mesh at the given index.
 		 *	If the mesh has no bone indices, a vector filled with values is
 		 *	returned regardless. All the values will be set to (0,0,0,0) in this case.
@@ -233,6 +358,26 @@ namespace gvk
 		 */
 		std::vector<glm::uvec4> bone_indices_for_meshes_for_single_target_buffer(const std::vector<mesh_index_t>& aMeshIndices, uint32_t aInitialBoneIndexOffset = 0u) const;
 
+		/**	Generates tangents and bitangents (see `generate_tangent_space`) for all the given meshes which do not contain
+		 *	tangents, processing the meshes concurrently. This is a multithreaded alternative to `aiProcess_CalcTangentSpace`.
+		 *	The results are cached, i.e. `tangents_for_mesh`, `bitangents_for_mesh`, and all the functions which write vertex
+		 *	data serve them afterwards, also after `release_scene`. Tangents are generated lazily (from texture coordinates
+		 *	set 0) when they are requested for the first time anyways; use this method to generate them up front, or from a
+		 *	different set of texture coordinates. Meshes which do not consist of triangles, or which lack normals or the
+		 *	given set of texture coordinates, are skipped. See `generate_tangents_cached` for caching them across runs.
+		 *	@param	aMeshIndices	Indices of the meshes to generate tangents for
+		 *	@param	aTexCoordSet	Set of texture coordinates which the tangents shall be aligned with
+		 */
+		void generate_tangents(const std::vector<mesh_index_t>& aMeshIndices, int aTexCoordSet = 0);
+
+		/**	Gets the tangents and bitangents which have been generated for the mesh at the given index, or nullptr if none have been generated.
+		 *	The returned tangent space stays valid even if the mesh's tangents are generated anew or reordered (e.g. by `optimize_meshes`) afterwards.
+		 */
+		std::shared_ptr<const tangent_space> generated_tangents_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Assigns generated tangents and bitangents to the mesh at the given index, e.g. ones which have been restored from a cache file. */
+		void set_generated_tangents_for_mesh(mesh_index_t aMeshIndex, tangent_space aTangentSpace);
+
 		/** Gets the number of uv-components of a specific UV-set for the mesh at the given index
 		 *	@param		aMeshIndex		The index corresponding to the mesh
 		 *	@param		aSet			Index to a specific set of texture coordinates
@@ -291,30 +436,25 @@ namespace gvk
 		template <typename T> 
 		std::vector<T> indices_for_mesh(mesh_index_t aMeshIndex) const
 		{ 
-			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-			size_t indicesCount = number_of_indices_for_mesh(aMeshIndex);
-			std::vector<T> result;
-			result.reserve(indicesCount);
-			for (unsigned int i = 0; i < paiMesh->mNumFaces; ++i) {
-				// we're working with triangulated meshes only
-				const aiFace& paiFace = paiMesh->mFaces[i];
-				for (unsigned int f = 0; f < paiFace.mNumIndices; ++f) {
-					result.emplace_back(static_cast<T>(paiFace.mIndices[f]));
-				}
-			}
+			std::vector<T> result(static_cast<size_t>(number_of_indices_for_mesh(aMeshIndex)));
+			write_indices_for_mesh<T>(aMeshIndex, result.data());
 			return result;
 		}
 
 		/** Returns the number of meshes. */
-		mesh_index_t num_meshes() const { return mScene->mNumMeshes; }
+		mesh_index_t num_meshes() const { return has_scene() ? mScene->mNumMeshes : mMeshStore->mMeshes.size(); }
 
 		/** Return the indices of all meshes which the given predicate evaluates true for.
 		 *	Function-signature: bool(mesh_index_t, const aiMesh*) where the first parameter is the 
 		 *									mesh index and the second the pointer to the data
+		 *	Requires Assimp's scene, i.e. must not be invoked after `release_scene`.
 		 */
 		template <typename F>
 		std::vector<mesh_index_t> select_meshes(F aPredicate) const
 		{
+			if (!has_scene()) {
+				throw gvk::logic_error("select_meshes requires Assimp's scene, but it has been released already.");
+			}
 			std::vector<mesh_index_t> result;
 			for (mesh_index_t i = 0; i < mScene->mNumMeshes; ++i) {
 				const aiMesh* paiMesh = mScene->mMeshes[i];
@@ -337,6 +477,9 @@ namespace gvk
 		std::vector<glm::vec4> colors_for_meshes(std::vector<mesh_index_t> aMeshIndices, int aSet = 0) const;
 		std::vector<glm::vec4> bone_weights_for_meshes(std::vector<mesh_index_t> aMeshIndices, bool aNormalizeBoneWeights = false) const;
 		std::vector<glm::uvec4> bone_indices_for_meshes(std::vector<mesh_index_t> aMeshIndices) const;
+		std::vector<glm::u8vec4> bone_weights_for_meshes_unorm8(std::vector<mesh_index_t> aMeshIndices) const;
+		std::vector<glm::u16vec4> bone_weights_for_meshes_unorm16(std::vector<mesh_index_t> aMeshIndices) const;
+		std::vector<glm::u8vec4> bone_indices_for_meshes_u8(std::vector<mesh_index_t> aMeshIndices) const;
 
 		template <typename T>
 		std::vector<T> texture_coordinates_for_meshes(std::vector<mesh_index_t> aMeshIndices, int aSet = 0) const
@@ -360,12 +503,178 @@ namespace gvk
 			return result;
 		}
 
+		/** Gets the accumulated number of vertices of all the meshes at the given indices.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 *	@return		Sum of `number_of_vertices_for_mesh()` for each one of the given mesh indices.
+		 */
+		size_t number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/** Writes the vertex data of the mesh at the given index directly into the given memory, which
+		 *	is interpreted according to the given vertex layout. All the attributes of one vertex are
+		 *	written in one single pass over the mesh's vertices, without any intermediate allocations.
+		 *	This is intended to be used with mapped (staging) buffer memory.
+		 *	Missing attributes are filled with the same fallback values as the getters, like
+		 *	`normals_for_mesh`, `colors_for_mesh`, or `texture_coordinates_for_mesh`, would return.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@param		aLayout			Describes which attributes shall be written at which offsets, and the stride between vertices.
+		 *	@param		aDestination	Pointer to the memory to be written to. It must be large enough to hold
+		 *								`number_of_vertices_for_mesh()` * `aLayout.mStride` bytes.
+		 *	@return		Number of vertices written, i.e. `number_of_vertices_for_mesh()`
+		 */
+		size_t write_vertex_data_for_mesh(mesh_index_t aMeshIndex, const vertex_layout& aLayout, void* aDestination) const;
+
+		/** Writes the vertex data of all the meshes at the given indices consecutively into the given memory.
+		 *	See `write_vertex_data_for_mesh` for further details.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 *	@param		aLayout			Describes which attributes shall be written at which offsets, and the stride between vertices.
+		 *	@param		aDestination	Pointer to the memory to be written to. It must be large enough to hold
+		 *								`number_of_vertices_for_meshes()` * `aLayout.mStride` bytes.
+		 *	@return		Number of vertices written, i.e. `number_of_vertices_for_meshes()`
+		 */
+		size_t write_vertex_data_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, const vertex_layout& aLayout, void* aDestination) const;
+
+		/** Writes all the indices of the mesh at the given index directly into the given memory.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@param		aDestination	Pointer to the memory to be written to. It must be large enough to hold
+		 *								`number_of_indices_for_mesh()` elements of type `T`.
+		 *	@param		aOffset			A value to be added to every single index, e.g. the number of vertices which come before this mesh.
+		 *	@param		aLodLevel		Level of detail, see `generate_lods`. Level 0 is the original mesh.
+		 *	@return		Number of indices written, i.e. `number_of_indices_for_mesh_lod()`
+		 */
+		template <typename T>
+		size_t write_indices_for_mesh(mesh_index_t aMeshIndex, T* aDestination, T aOffset = T{ 0 }, size_t aLodLevel = 0) const
+		{
+			if (aLodLevel > 0 && !mLodsPerMesh[aMeshIndex].empty()) {
+				const auto& lodIndices = mLodsPerMesh[aMeshIndex][std::min(aLodLevel, mLodsPerMesh[aMeshIndex].size()) - 1].mIndices;
+				for (size_t i = 0; i < lodIndices.size(); ++i) {
+					aDestination[i] = static_cast<T>(lodIndices[i]) + aOffset;
+				}
+				return lodIndices.size();
+			}
+
+			if (!has_scene()) {
+				const auto& mesh = mMeshStore->mMeshes[aMeshIndex];
+				const auto* source = mMeshStore->mIndices.data() + mesh.mIndicesOffset;
+				for (uint32_t i = 0; i < mesh.mNumIndices; ++i) {
+					aDestination[i] = static_cast<T>(source[i]) + aOffset;
+				}
+				return static_cast<size_t>(mesh.mNumIndices);
+			}
+
+			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
+			size_t written = 0;
+			for (unsigned int i = 0; i < paiMesh->mNumFaces; ++i) {
+				const aiFace& paiFace = paiMesh->mFaces[i];
+				for (unsigned int f = 0; f < paiFace.mNumIndices; ++f) {
+					aDestination[written++] = static_cast<T>(paiFace.mIndices[f]) + aOffset;
+				}
+			}
+			return written;
+		}
+
+		/**	Optimizes the index and vertex data of the meshes at the given indices in place, so that all
+		 *	subsequently created buffers benefit from it. This is meant to be invoked once, directly after loading.
+		 *	The steps are applied in the order: vertex cache, overdraw, vertex fetch. The latter reorders ALL
+		 *	vertex attribute streams of a mesh, including its bone weights, morph targets, and generated (or assigned)
+		 *	tangents. Bone influences which have been cached before are invalidated.
+		 *	Meshes are processed in parallel. Meshes which do not consist of triangles only are skipped.
+		 *	@param		aMeshIndices		Indices of the meshes to be optimized
+		 *	@param		aSteps				Which optimization steps to apply
+		 *	@param		aCacheSize			Size of the simulated post-transform vertex cache, used for the statistics and for the overdraw step
+		 *	@param		aOverdrawThreshold	Factor by which the overdraw step is allowed to degrade the ACMR
+		 *	@return		Vertex cache statistics before and after the optimization for each one of the optimized meshes
+		 */
+		std::vector<mesh_optimization_statistics> optimize_meshes(const std::vector<mesh_index_t>& aMeshIndices, mesh_optimization aSteps = mesh_optimization::all, uint32_t aCacheSize = 16u, float aOverdrawThreshold = 1.05f);
+
+		/**	Generates a chain of simplified levels of detail for each one of the meshes at the given indices, see `simplify_mesh`.
+		 *	Only index data is generated, all levels of detail share the vertices of the original mesh.
+		 *	Level 0 is always the original mesh, the generated levels start at 1. Each level is simplified from the
+		 *	previous one, until its target ratio or its target error is reached, whichever comes first.
+		 *	Meshes are processed in parallel. Meshes which do not consist of triangles only are skipped.
+		 *	Previously generated levels of detail of these meshes are replaced.
+		 *	@param		aMeshIndices		Indices of the meshes to generate levels of detail for
+		 *	@param		aLevels				Target ratio (w.r.t. the original number of indices) and target error per level of detail
+		 */
+		void generate_lods(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<lod_level_config>& aLevels);
+
+		/**	Generates a chain of simplified levels of detail with the given target ratios, all sharing the same maximum error.
+		 *	Example: `generate_lods(meshIndices, { 0.5f, 0.25f, 0.125f })`
+		 */
+		void generate_lods(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<float>& aTargetRatios, float aTargetError = 0.01f);
+
+		/** Gets the number of levels of detail of the mesh at the given index, including the original mesh, i.e. at least 1. */
+		size_t number_of_lods_for_mesh(mesh_index_t aMeshIndex) const { return 1 + mLodsPerMesh[aMeshIndex].size(); }
+
+		/**	Gets the number of indices of the given level of detail of the mesh at the given index.
+		 *	Levels greater than the number of generated levels refer to the coarsest one.
+		 */
+		size_t number_of_indices_for_mesh_lod(mesh_index_t aMeshIndex, size_t aLodLevel) const;
+
+		/**	Gets the geometric error of the given level of detail of the mesh at the given index,
+		 *	relative to the mesh's extent. Use it to select a level at draw time, e.g. based on its projected size.
+		 *	Levels greater than the number of generated levels refer to the coarsest one.
+		 */
+		float lod_error_for_mesh(mesh_index_t aMeshIndex, size_t aLodLevel) const;
+
+		/**	Gets the indices of the given level of detail of the mesh at the given index.
+		 *	Levels greater than the number of generated levels refer to the coarsest one.
+		 */
+		template <typename T>
+		std::vector<T> indices_for_mesh_lod(mesh_index_t aMeshIndex, size_t aLodLevel) const
+		{
+			std::vector<T> result(number_of_indices_for_mesh_lod(aMeshIndex, aLodLevel));
+			write_indices_for_mesh<T>(aMeshIndex, result.data(), T{ 0 }, aLodLevel);
+			return result;
+		}
+
+		/** Returns the number of nodes in Assimp's node hierarchy. */
+		size_t num_nodes() const { return mNodeNames.size(); }
+
+		/** Gets the index of the first node with the given name (in depth-first order).
+		 *	Node indices are topologically ordered, i.e. a parent node always has a smaller index than its children.
+		 *	@param		aNodeName		Name of the node to find
+		 *	@return		The node's index, or an empty value if no node with the given name exists.
+		 */
+		std::optional<size_t> node_index_by_name(const std::string& aNodeName) const;
+
+		/** Gets the index of the first node which references the mesh at the given index.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		The node's index, or an empty value if no node references the mesh.
+		 */
+		std::optional<size_t> node_index_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the index of the parent of the node at the given index, or an empty value for the root node. */
+		std::optional<size_t> parent_node_index(size_t aNodeIndex) const { return mNodeParentIndices[aNodeIndex]; }
+
+		/** Gets the name of the node at the given index. */
+		std::string name_of_node(size_t aNodeIndex) const { return mNodeNames[aNodeIndex]; }
+
+		/** Gets the node's transformation matrix relative to its parent node. */
+		glm::mat4 local_transformation_matrix_for_node(size_t aNodeIndex) const { return mNodeLocalTransforms[aNodeIndex]; }
+
+		/** Gets the node's transformation matrix accumulated over all its parent nodes, i.e. relative to the model's root. */
+		glm::mat4 global_transformation_matrix_for_node(size_t aNodeIndex) const { return mNodeGlobalTransforms[aNodeIndex]; }
+
 		/** Returns all lightsources stored in the model file */
 		std::vector<lightsource> lights() const;
 
 		/** Returns all cameras stored in the model file */
 		std::vector<gvk::camera> cameras() const;
 
+		/** Returns true if the mesh at the given index has morph targets (a.k.a. blend shapes) */
+		bool has_morph_targets(mesh_index_t aMeshIndex) const { return !mMorphTargetsPerMesh[aMeshIndex].empty(); }
+
+		/**	Gets the morph targets (a.k.a. blend shapes) of the mesh at the given index, which are stored sparsely.
+		 *	They are extracted from Assimp's scene once after loading, i.e. they are also available after `release_scene`.
+		 *	Evaluate them on the CPU via `apply_morph_targets`, or on the GPU via `create_morph_target_buffers`.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		The mesh's morph targets, which contain no targets if the mesh has none.
+		 */
+		const morph_target_set& morph_targets_for_mesh(mesh_index_t aMeshIndex) const { return mMorphTargetsPerMesh[aMeshIndex]; }
+
+		/** Returns the number of animations */
+		uint32_t num_animations() const { return static_cast<uint32_t>(mAnimationTracks.size()); }
+
 		/** Load an animation clip's data */
 		animation_clip_data load_animation_clip(unsigned int aAnimationIndex, double aStartTimeTicks, double aEndTimeTicks) const;
 
@@ -375,29 +684,121 @@ namespace gvk
 		 *	
 		 *	@param	aAnimationIndex				The animation index to create the animation data for
 		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animation.
+		 *	@param	aKeyframeReduction			If set, the keys of every animated node are reduced with `reduce_keyframes`,
+		 *										i.e. keys which interpolation can reconstruct within the given tolerances are
+		 *										removed. The number of keys and their memory before and after are logged.
+		 */
+		animation prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices, std::optional<keyframe_reduction_config> aKeyframeReduction = {}) const;
+
+		/**	Prepare a skeleton for the given mesh indices which can be shared by the animations of all of this model's
+		 *	animation clips, i.e. it contains every node which is animated by any of the clips, and all bones of the meshes.
+		 *	Use it with the `prepare_animation` overload which takes a skeleton, or use `prepare_all_animations`.
+		 *	
+		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animations.
 		 */
-		animation prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices);
+		std::shared_ptr<const animation_skeleton> prepare_animation_skeleton(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/**	Prepare an animation data structure for the given animation index, which shares the given skeleton.
+		 *	Only the keys of the animation clip are created, indexed by the skeleton's nodes.
+		 *	
+		 *	@param	aAnimationIndex				The animation index to create the animation data for
+		 *	@param	aSkeleton					A skeleton which has been created by `prepare_animation_skeleton` of this model
+		 *	@param	aKeyframeReduction			If set, the keys of every animated node are reduced with `reduce_keyframes`.
+		 */
+		animation prepare_animation(uint32_t aAnimationIndex, std::shared_ptr<const animation_skeleton> aSkeleton, std::optional<keyframe_reduction_config> aKeyframeReduction = {}) const;
+
+		/**	Prepare the animation data structures of all animation clips for the given mesh indices. The skeleton is
+		 *	created once (see `prepare_animation_skeleton`) and shared by all the returned animations, the keys of the
+		 *	clips are created in parallel.
+		 *	
+		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animations.
+		 *	@param	aKeyframeReduction			If set, the keys of every animated node are reduced with `reduce_keyframes`.
+		 *	@return	One animation per animation index, i.e. `num_animations()` many.
+		 */
+		std::vector<animation> prepare_all_animations(const std::vector<mesh_index_t>& aMeshIndices, std::optional<keyframe_reduction_config> aKeyframeReduction = {}) const;
 		
 	private:
 		void initialize_materials();
-		aiNode* find_mesh_root_node(unsigned int aMeshIndexToFind) const;
-		aiNode* mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const;
-		std::optional<glm::mat4> transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* Node, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const;
+		void initialize_caches();
 
-		/** Helper function which adds the given node and all its child nodes to the given map
+		/** Builds the flat node table (see `mNodeNames`) by traversing Assimp's node hierarchy once.
+		 *	Must be invoked after the scene has been loaded.
 		 */
-		void add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode);
+		void initialize_node_table();
+
+		/** Derives global transforms and the lookup tables by name and by mesh from the flat node table. */
+		void initialize_node_lookups();
+
+		/** Gets the index of the last node with the given name (in depth-first order), which is the node animations and bones refer to. */
+		std::optional<size_t> last_node_index_by_name(const std::string& aNodeName) const;
+
+		/** Converts all of Assimp's animations into `mAnimationTracks`. Must be invoked after the scene has been loaded. */
+		void initialize_animations();
+
+		/** Extracts the morph targets of all meshes into `mMorphTargetsPerMesh`. Must be invoked after the scene has been loaded. */
+		void initialize_morph_targets();
+
+		/** Gets the cached bounding volumes of the mesh at the given index, computes them if they have not been computed yet. */
+		const std::tuple<bounding_box, bounding_sphere>& bounding_volumes_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Location of one vertex attribute stream of a mesh, either within Assimp's scene or within the compact mesh store */
+		struct vertex_stream
+		{
+			/** Pointer to the first vertex' components, nullptr if the mesh does not have this attribute */
+			const float* mData = nullptr;
+			/** Number of floats from one vertex to the next */
+			size_t mStride = 0;
+			/** Number of valid components per vertex */
+			size_t mNumComponents = 0;
+			/** Keeps generated data alive while the stream is in use, even if it is replaced in the meantime */
+			std::shared_ptr<const void> mOwner;
+		};
+
+		/** Gets the stream of the given attribute of the mesh at the given index, regardless of whether it is served from Assimp's scene or from the compact mesh store. */
+		vertex_stream vertex_stream_for_mesh(mesh_index_t aMeshIndex, vertex_attribute aAttribute, int aSet = 0) const;
+
+		/** Returns true if the mesh at the given index contains tangents, i.e. if they do not have to be generated */
+		bool has_source_tangents(mesh_index_t aMeshIndex) const;
+
+		/** Generates the tangent space of the mesh at the given index, or returns an empty optional if the mesh lacks the required data */
+		std::optional<tangent_space> compute_tangent_space(mesh_index_t aMeshIndex, int aTexCoordSet) const;
+
+		/** Gets the cached generated tangent space of the mesh at the given index, generates it from texture coordinates set 0 if it has not been generated yet */
+		std::shared_ptr<const tangent_space> tangent_space_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the combination of aiPrimitiveType flags of the mesh at the given index */
+		uint32_t primitive_types_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Gets the name of the given bone of the mesh at the given index */
+		std::string name_of_bone(mesh_index_t aMeshIndex, uint32_t aBoneIndex) const;
+
+		/** Gets the offset matrix (i.e. inverse bind pose matrix) of the given bone of the mesh at the given index */
+		glm::mat4 offset_matrix_of_bone(mesh_index_t aMeshIndex, uint32_t aBoneIndex) const;
+
+		/** Gets the indices of the nodes which are animated by the channels of the given animation, in the order of the channels */
+		std::vector<size_t> nodes_animated_by(uint32_t aAnimationIndex) const;
+
+		/**	Builds the skeleton for the given animated nodes and the bones of the given meshes, see `animation_skeleton`.
+		 *	@param	aAnimatedNodes		Indices of the nodes which are animated by channels; nodes which are contained multiple times are added once
+		 *	@param	aMeshIndices		The meshes whose bones shall receive bone matrices
+		 */
+		std::shared_ptr<const animation_skeleton> build_animation_skeleton(const std::vector<size_t>& aAnimatedNodes, const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/**	Builds the keys of the given animation for the nodes of the given skeleton, see `animation_track_set`.
+		 *	@param	aStatistics			Receives the statistics of the keyframe reduction, if aKeyframeReduction is set
+		 */
+		animation_track_set build_animation_track_set(const animation_skeleton& aSkeleton, uint32_t aAnimationIndex, const std::optional<keyframe_reduction_config>& aKeyframeReduction, keyframe_reduction_result& aStatistics) const;
+
+		/** Logs the statistics of a keyframe reduction */
+		void log_keyframe_reduction(std::string_view aAnimations, const keyframe_reduction_result& aStatistics) const;
 
-						
 		/** Helper function return true if the two given collections have the same size and
 		 *	contain keys with the same timestamp values.
 		 *	Each of the types must have a .size() member and must be accessible via an indexer.
 		 *	Each type's child element must have a .mTime member of type double.
 		 */
 		template <typename T1, typename T2>
-		bool have_same_key_times(const T1& aCollection1, const T2& aCollection2)
+		bool have_same_key_times(const T1& aCollection1, const T2& aCollection2) const
 		{
 			if (aCollection1.size() != aCollection2.size()) {
 				return false;
@@ -412,8 +813,48 @@ namespace gvk
 
 		std::unique_ptr<Assimp::Importer> mImporter;
 		std::string mModelPath;
-		const aiScene* mScene;
-		std::vector<std::optional<material_config>> mMaterialConfigPerMesh;
+		const aiScene* mScene = nullptr;
+		// Material configs are created lazily by const getters, guarded by mMaterialMutex (which is recursive, since the getters build upon each other):
+		std::unique_ptr<std::recursive_mutex> mMaterialMutex;
+		mutable std::vector<std::optional<material_config>> mMaterialConfigPerMesh;
+		// Interned material configs (with all the CPU-only data) and every mesh's ID therein, assigned lazily by material_id_for_mesh:
+		mutable material_config_table mMaterialTable;
+		mutable std::vector<std::optional<material_id>> mMaterialIdPerMesh;
+
+		// Compact copy of all the meshes, which all the getters are served from after release_scene:
+		std::optional<mesh_store> mMeshStore;
+		// Data which is converted from Assimp's scene in release_scene:
+		std::vector<std::string> mMaterialNames;
+		std::vector<lightsource> mLights;
+		std::vector<gvk::camera> mCameras;
+
+		// All the keyframes of all the animations, converted from Assimp's scene once after loading:
+		std::vector<animation_tracks> mAnimationTracks;
+
+		// Sparse morph targets of every mesh, extracted from Assimp's scene once after loading (indexed by mesh index):
+		std::vector<morph_target_set> mMorphTargetsPerMesh;
+
+		// Flat node table, topologically ordered (i.e. every parent comes before its children), built once after loading.
+		// All the following vectors are indexed by the same node index:
+		std::vector<std::string> mNodeNames;
+		std::vector<glm::mat4> mNodeLocalTransforms;
+		std::vector<std::optional<size_t>> mNodeParentIndices;
+		std::vector<std::vector<mesh_index_t>> mNodeMeshIndices;
+		std::vector<glm::mat4> mNodeGlobalTransforms;
+		// Node index of the first node which references a given mesh (indexed by mesh index):
+		std::vector<std::optional<size_t>> mMeshNodeIndices;
+		// Node indices of the first and of the last node with a given name (in depth-first order):
+		std::unordered_map<std::string, std::pair<size_t, size_t>> mNodeIndicesByName;
+
+		// Data which is computed lazily by const getters and cached afterwards (indexed by mesh index).
+		// Filling a cache entry is guarded by mCacheMutex:
+		std::unique_ptr<std::mutex> mCacheMutex;
+		mutable std::vector<std::unique_ptr<bone_influences>> mBoneInfluencesPerMesh;
+		mutable std::vector<std::optional<std::tuple<bounding_box, bounding_sphere>>> mBoundingVolumesPerMesh;
+		mutable std::vector<std::shared_ptr<const tangent_space>> mTangentSpacePerMesh;
+
+		// Generated levels of detail per mesh, starting with level 1:
+		std::vector<std::vector<mesh_lod>> mLodsPerMesh;
 	};
 
 	using model = avk::owning_resource<model_t>;
@@ -422,33 +863,32 @@ namespace gvk
 	template <>
 	inline std::vector<glm::vec2> model_t::texture_coordinates_for_mesh<glm::vec2>(glm::vec2(*aTransformFunc)(const glm::vec2&), mesh_index_t aMeshIndex, int aSet) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::texture_coordinates_2d, aSet);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec2> result;
 		result.reserve(n);
-		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
-		if (nullptr == paiMesh->mTextureCoords[aSet]) {
+		if (nullptr == stream.mData) {
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain a texture coordinates at index {}. Will return (0,0) for each vertex.", aMeshIndex, aSet));
-			for (decltype(n) i = 0; i < n; ++i) {
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(0.f, 0.f);
 			}
 		}
 		else {
-			const auto nuv = num_uv_components_for_mesh(aMeshIndex, aSet);
-			switch (nuv) {
+			switch (stream.mNumComponents) {
 			case 1:
-				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], 0.f }));
+				for (size_t i = 0; i < n; ++i) {
+					result.emplace_back(aTransformFunc(glm::vec2{ stream.mData[i * stream.mStride], 0.f }));
 				}
 				break;
 			case 2:
 			case 3:
-				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1] }));
+				for (size_t i = 0; i < n; ++i) {
+					result.emplace_back(aTransformFunc(glm::vec2{ stream.mData[i * stream.mStride], stream.mData[i * stream.mStride + 1] }));
 				}
 				break;
 			default:
-				throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, aMeshIndex, aSet));
+				throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", stream.mNumComponents, aMeshIndex, aSet));
 			}
 		}
 		return result;
@@ -457,37 +897,36 @@ namespace gvk
 	template <>
 	inline std::vector<glm::vec3> model_t::texture_coordinates_for_mesh<glm::vec3>(mesh_index_t aMeshIndex, int aSet) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::texture_coordinates_3d, aSet);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec3> result;
 		result.reserve(n);
-		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
-		if (nullptr == paiMesh->mTextureCoords[aSet]) {
+		if (nullptr == stream.mData) {
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain a texture coordinates at index {}. Will return (0,0,0) for each vertex.", aMeshIndex, aSet));
-			for (decltype(n) i = 0; i < n; ++i) {
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(0.f, 0.f, 0.f);
 			}
 		}
 		else {
-			const auto nuv = num_uv_components_for_mesh(aMeshIndex, aSet);
-			switch (nuv) {
+			switch (stream.mNumComponents) {
 			case 1:
-				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], 0.f, 0.f);
+				for (size_t i = 0; i < n; ++i) {
+					result.emplace_back(stream.mData[i * stream.mStride], 0.f, 0.f);
 				}
 				break;
 			case 2:
-				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], 0.f);
+				for (size_t i = 0; i < n; ++i) {
+					result.emplace_back(stream.mData[i * stream.mStride], stream.mData[i * stream.mStride + 1], 0.f);
 				}
 				break;
 			case 3:
-				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], paiMesh->mTextureCoords[aSet][i][2]);
+				for (size_t i = 0; i < n; ++i) {
+					result.emplace_back(stream.mData[i * stream.mStride], stream.mData[i * stream.mStride + 1], stream.mData[i * stream.mStride + 2]);
 				}
 				break;
 			default:
-				throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, aMeshIndex, aSet));
+				throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", stream.mNumComponents, aMeshIndex, aSet));
 			}
 		}
 		return result;
@@ -0,0 +1,67 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Shares loaded models between all their users. Models are identified by their cleaned-up path
+	 *	(see `avk::clean_up_path`) and Assimp's post processing flags, and every model is only imported
+	 *	once for as long as there is at least one handle to it. Concurrent requests for the same model
+	 *	wait for the one import which is already in progress. A model is evicted from the cache as soon
+	 *	as its last handle is released.
+	 *
+	 *	Since all handles refer to the very same model_t instance, which might be used by multiple threads,
+	 *	they are const. Models which are to be modified (e.g. via `set_material_config_for_mesh` or
+	 *	`optimize_meshes`) have to be loaded via `model_t::load_from_file` instead.
+	 */
+	class model_cache
+	{
+	public:
+		model_cache();
+		model_cache(model_cache&&) noexcept = delete;
+		model_cache(const model_cache&) = delete;
+		model_cache& operator=(model_cache&&) noexcept = delete;
+		model_cache& operator=(const model_cache&) = delete;
+		~model_cache() = default;
+
+		/**	Gets a handle to the model at the given path which has been imported with the given flags.
+		 *	Imports the model via `model_t::load_from_file` if it is not in the cache yet.
+		 *	@param	aPath				Path to the model file
+		 *	@param	aAssimpFlags		Assimp's post processing flags
+		 *	@param	aProgressCallback	Optional callback which receives the import progress. It only receives the final
+		 *								progress of 1 if the model has been in the cache already or has been imported by
+		 *								another request. If it returns false, the import is cancelled, see `model_t::load_from_file`.
+		 *	Throws a gvk::runtime_error if the import fails, which is also thrown for all concurrent requests of the same model.
+		 *	If the import is cancelled, only its own request fails, and the first concurrent request imports the model anew.
+		 */
+		std::shared_ptr<const model_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, const load_progress_callback& aProgressCallback = {});
+
+		/** Gets a handle to the given model if it is in the cache and has been imported completely, or nullptr otherwise. */
+		std::shared_ptr<const model_t> find(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate) const;
+
+		/** Gets the number of models which are currently in the cache, including those which are being imported */
+		size_t size() const;
+
+		/** Gets the process-wide model cache */
+		static model_cache& shared();
+
+	private:
+		struct entry
+		{
+			/** Valid while the model is being imported, yields nullptr if the import has been cancelled */
+			std::shared_future<std::shared_ptr<const model_t>> mImport;
+			/** Refers to the model once it has been imported */
+			std::weak_ptr<const model_t> mModel;
+		};
+
+		/** Lives as long as the cache or any of its models, s.t. models can evict themselves even if they outlive the cache */
+		struct cache_data
+		{
+			mutable std::mutex mMutex;
+			std::unordered_map<std::string, entry> mEntries;
+		};
+
+		static std::string make_key(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags);
+
+		std::shared_ptr<cache_data> mData;
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Layout of Gears-Vk's native binary model files, which are written by `model_t::save_to_binary_file`
+	 *	and read by `model_t::load_from_binary_file`.
+	 *
+	 *	A file starts with a `model_file_header`, which is followed by a table of `model_file_section` entries.
+	 *	Every section starts at a multiple of `model_file_page_size`, so that the bulk data sections can be
+	 *	served straight from the mapped file's pages, without any parsing or copying:
+	 *	 - vertex_data:  All vertex attribute streams as tightly packed floats (see `mesh_store::mVertexData`)
+	 *	 - indices:      All indices as uint32_t values (see `mesh_store::mIndices`)
+	 *	 - bone_weights: All <vertex id, weight> pairs (see `mesh_store::mBoneWeights`)
+	 *	 - metadata:     Meshes, bones, nodes, material names, material configs, animation tracks, and the sparse
+	 *	                 morph targets, which
+	 *	                 are small compared to the bulk data and are decoded into their native types.
+	 *	All values are stored in the host's (i.e. little endian) byte order.
+	 *
+	 *	Whenever the layout changes, `model_file_version` must be incremented. Files with a different version
+	 *	are rejected, so that they can be converted again from their source assets.
+	 */
+	inline constexpr std::array<char, 8> model_file_magic{ 'G', 'V', 'K', 'M', 'O', 'D', 'E', 'L' };
+	inline constexpr uint32_t model_file_version = 2u;
+	inline constexpr uint64_t model_file_page_size = 4096u;
+
+	enum struct model_file_section_type : uint32_t
+	{
+		metadata = 1,
+		vertex_data = 2,
+		indices = 3,
+		bone_weights = 4
+	};
+
+	struct model_file_header
+	{
+		std::array<char, 8> mMagic;
+		uint32_t mVersion;
+		uint32_t mNumSections;
+		/** Size of each of `model_file_section`, `mesh_store_bone_weight`, and `avk::cfg::color_blending_config`, to detect incompatible builds */
+		uint32_t mSectionEntrySize;
+		uint32_t mBoneWeightSize;
+		uint32_t mBlendConfigSize;
+		uint32_t mReserved;
+	};
+
+	struct model_file_section
+	{
+		model_file_section_type mType;
+		uint32_t mReserved;
+		/** Offset from the beginning of the file in bytes, a multiple of `model_file_page_size` */
+		uint64_t mOffset;
+		/** Size in bytes */
+		uint64_t mSize;
+	};
+
+	static_assert(std::is_trivially_copyable_v<model_file_header> && std::is_trivially_copyable_v<model_file_section>);
+}
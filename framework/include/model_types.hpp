@@ -36,4 +36,106 @@ namespace gvk
 		return std::string(aAssimpString.C_Str());
 	}
 
+	/** The (up to) four most important bone influences of every vertex of a mesh,
+	 *	as computed by `model_t::bone_influences_for_mesh`.
+	 *	All vectors have the length `model_t::number_of_vertices_for_mesh()`.
+	 */
+	struct bone_influences
+	{
+		/** Mesh-local bone indices, ordered descending by weight. Unused entries are set to 0. */
+		std::vector<glm::uvec4> mIndices;
+		/** Bone weights as stored in the model file, ordered descending. Unused entries are set to 0. */
+		std::vector<glm::vec4> mWeights;
+		/** Sum of ALL the weights which influence a vertex, i.e. also including those which did not make it into the top four. */
+		std::vector<float> mWeightSums;
+	};
+
+	/** Vertex attributes which can be written into interleaved memory via
+	 *	`model_t::write_vertex_data_for_mesh` and `model_t::write_vertex_data_for_meshes`.
+	 *	Every attribute is written as 32-bit floats; the comments state the type which it occupies.
+	 */
+	enum struct vertex_attribute
+	{
+		position,						// glm::vec3
+		normal,							// glm::vec3
+		tangent,						// glm::vec3
+		bitangent,						// glm::vec3
+		color,							// glm::vec4
+		texture_coordinates_2d,			// glm::vec2
+		texture_coordinates_2d_flipped,	// glm::vec2, with v flipped to 1 - v
+		texture_coordinates_3d			// glm::vec3
+	};
+
+	/** Gets the number of float components which the given vertex attribute occupies in memory */
+	static size_t num_components_of(vertex_attribute aAttribute)
+	{
+		switch (aAttribute) {
+		case vertex_attribute::color:
+			return 4;
+		case vertex_attribute::texture_coordinates_2d:
+		case vertex_attribute::texture_coordinates_2d_flipped:
+			return 2;
+		default:
+			return 3;
+		}
+	}
+
+	/** Gets the size in bytes which the given vertex attribute occupies in memory */
+	static size_t size_of(vertex_attribute aAttribute)
+	{
+		return num_components_of(aAttribute) * sizeof(float);
+	}
+
+	/** Location of one vertex attribute within an interleaved vertex */
+	struct vertex_attribute_location
+	{
+		vertex_attribute mAttribute;
+		size_t mOffset;
+		int mSet;
+	};
+
+	/** Describes the memory layout of interleaved vertex data, i.e. which attributes are
+	 *	stored at which offsets within one vertex, and the stride between two consecutive vertices.
+	 *	A layout with only one attribute and a custom stride can be used to write a single
+	 *	attribute into strided memory.
+	 *
+	 *	Example:
+	 *	`gvk::vertex_layout{}.add(gvk::vertex_attribute::position).add(gvk::vertex_attribute::normal).add(gvk::vertex_attribute::texture_coordinates_2d)`
+	 *	describes a tightly packed vertex of 32 bytes.
+	 */
+	struct vertex_layout
+	{
+		/** Append an attribute directly after the current end of the vertex, increasing the stride accordingly.
+		 *	@param	aAttribute	The attribute to be added
+		 *	@param	aSet		Index of the color set or UV-set, respectively. Ignored for the other attributes.
+		 */
+		vertex_layout& add(vertex_attribute aAttribute, int aSet = 0)
+		{
+			return add_at_offset(aAttribute, mStride, aSet);
+		}
+
+		/** Add an attribute at the given offset within the vertex. The stride is increased if the attribute would not fit into it.
+		 *	@param	aAttribute	The attribute to be added
+		 *	@param	aOffset		Offset in bytes from the start of the vertex
+		 *	@param	aSet		Index of the color set or UV-set, respectively. Ignored for the other attributes.
+		 */
+		vertex_layout& add_at_offset(vertex_attribute aAttribute, size_t aOffset, int aSet = 0)
+		{
+			mAttributes.push_back(vertex_attribute_location{ aAttribute, aOffset, aSet });
+			mStride = std::max(mStride, aOffset + size_of(aAttribute));
+			return *this;
+		}
+
+		/** Set a custom stride, e.g. to add padding at the end of each vertex or to leave room for data written by other means. */
+		vertex_layout& with_stride(size_t aStride)
+		{
+			assert(aStride >= mStride);
+			mStride = aStride;
+			return *this;
+		}
+
+		std::vector<vertex_attribute_location> mAttributes;
+		size_t mStride = 0;
+	};
+
 }
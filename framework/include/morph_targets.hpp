@@ -0,0 +1,95 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	One morph target (a.k.a. blend shape) of a mesh, stored sparsely: only the vertices whose position or
+	 *	normal differ from the base mesh are stored, each one as its vertex index and its deltas to the base mesh.
+	 */
+	struct morph_target
+	{
+		std::string mName;
+		/** Indices of the affected vertices, in ascending order */
+		std::vector<uint32_t> mVertexIndices;
+		/** Position deltas, one per entry of mVertexIndices */
+		std::vector<glm::vec3> mPositionDeltas;
+		/** Normal deltas, one per entry of mVertexIndices, or empty if the target does not affect normals */
+		std::vector<glm::vec3> mNormalDeltas;
+		/** Weight which the target is applied with by default (i.e. if not animated) */
+		float mDefaultWeight = 0.0f;
+	};
+
+	/** All the morph targets of one mesh */
+	struct morph_target_set
+	{
+		/** Number of vertices of the mesh which the targets belong to */
+		uint32_t mNumVertices = 0;
+		std::vector<morph_target> mTargets;
+
+		/**	Extracts the morph targets from the given mesh's `aiMesh::mAnimMeshes`. Assimp stores every target
+		 *	densely with absolute attribute values; only the deltas to the base mesh which exceed the given
+		 *	threshold in any component are kept.
+		 *	@param	aMesh		The mesh, must be a triangle or polygon mesh with positions
+		 *	@param	aThreshold	Deltas whose components are all within [-aThreshold, aThreshold] are dropped
+		 */
+		static morph_target_set create_from_mesh(const aiMesh* aMesh, float aThreshold = 0.0f);
+
+		bool empty() const { return mTargets.empty(); }
+
+		/** Gets the total number of deltas of all targets */
+		size_t num_deltas() const;
+
+		/** Gets the total number of bytes occupied by the targets' deltas */
+		size_t size_in_bytes() const;
+
+		/**	Applies a vertex reordering to all targets, as it is computed by `optimize_vertex_fetch_remap`.
+		 *	@param	aRemap	New index of each vertex, indexed by its old index
+		 */
+		void remap_vertices(const std::vector<uint32_t>& aRemap);
+	};
+
+	/**	Evaluates morph targets on the CPU: writes the base positions plus the weighted position deltas of all targets
+	 *	into aPositions. The base positions are copied once, and only the deltas of targets with a non-zero weight are
+	 *	accumulated on top of them, four components at a time where SSE2 is available.
+	 *	@param	aTargets			The morph targets of one mesh
+	 *	@param	aWeights			One weight per target
+	 *	@param	aBasePositions		The mesh's positions, of length `morph_target_set::mNumVertices`
+	 *	@param	aPositions			Receives the morphed positions, same length as aBasePositions. May be the same memory
+	 *								as aBasePositions, in which case the deltas are added in place.
+	 */
+	extern void apply_morph_targets(const morph_target_set& aTargets, std::span<const float> aWeights, std::span<const glm::vec3> aBasePositions, std::span<glm::vec3> aPositions);
+
+	/**	Same as the other `apply_morph_targets` overload, but also morphs normals. The affected normals are normalized
+	 *	again afterwards; targets without normal deltas leave the normals unchanged.
+	 */
+	extern void apply_morph_targets(const morph_target_set& aTargets, std::span<const float> aWeights, std::span<const glm::vec3> aBasePositions, std::span<glm::vec3> aPositions, std::span<const glm::vec3> aBaseNormals, std::span<glm::vec3> aNormals);
+
+	/** One delta of the sparse morph target data for GPU evaluation, laid out to be used in std430 storage buffers */
+	struct morph_target_gpu_delta
+	{
+		glm::vec3 mDeltaPosition;
+		/** Index into the weights of all targets of the selection, see `morph_target_gpu_data` */
+		uint32_t mTargetIndex;
+		glm::vec3 mDeltaNormal;
+		uint32_t mReserved;
+	};
+
+	static_assert(sizeof(morph_target_gpu_delta) == 32);
+
+	/**	Sparse morph target data of multiple meshes for evaluation on the GPU, grouped by vertex so that every vertex
+	 *	can be morphed independently (i.e. in a vertex or compute shader, without any atomics):
+	 *	the deltas of the concatenated vertex v are `mDeltas[mVertexDeltaOffsets[v]]` up to (excluding)
+	 *	`mDeltas[mVertexDeltaOffsets[v + 1]]`, and every delta is to be scaled by `weights[mTargetIndex]`,
+	 *	where `weights` contains the weights of all targets of all meshes in the order of the selection.
+	 */
+	struct morph_target_gpu_data
+	{
+		/** Offsets into mDeltas, one per vertex plus one at the end */
+		std::vector<uint32_t> mVertexDeltaOffsets;
+		std::vector<morph_target_gpu_delta> mDeltas;
+		/** Index of every selected mesh's first target within the weights, one per mesh in the order of the selection */
+		std::vector<uint32_t> mFirstTargetIndices;
+		/** Total number of targets, i.e. the required number of weights */
+		uint32_t mNumTargets = 0;
+	};
+}
@@ -23,7 +23,8 @@ namespace gvk
 		std::string mName;
 		std::vector<model_instance_data> mInstances;
 		std::string mFullPathName;
-		gvk::model mLoadedModel;
+		/** Shared with all other users of the same model file, see `model_cache` */
+		std::shared_ptr<const model_t> mLoadedModel;
 	};
 
 	struct direct_light_data
@@ -134,7 +135,23 @@ namespace gvk
 		 */
 		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> distinct_material_configs_for_all_models(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false);
 
-		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices);
+		/**	Loads an ORCA scene and all of its models. The models are imported in parallel, and are taken from
+		 *	the shared model cache (see `model_cache::shared`), i.e. every model file is only imported once.
+		 *	@param	aPath				Path to the ORCA scene file
+		 *	@param	aAssimpFlags		Assimp's post processing flags, which are used for all models
+		 *	@param	aProgressCallback	Optional callback which receives the progress over all the models. It is invoked
+		 *								by one thread at a time. If it returns false, loading is cancelled and a
+		 *								gvk::runtime_error is thrown.
+		 */
+		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, const load_progress_callback& aProgressCallback = {});
+
+		/**	Loads an ORCA scene on the shared worker pool (see `worker_pool::shared`), without blocking the caller.
+		 *	Poll the returned handle, e.g. in `invokee::update()`, and fetch the scene via `get()` once it `is_ready()`.
+		 *	@param	aPath			Path to the ORCA scene file
+		 *	@param	aAssimpFlags	Assimp's post processing flags, which are used for all models
+		 *	@param	aOnProgress		Optional callback which receives the progress in the range [0, 1]. It is invoked on a worker thread!
+		 */
+		static async_load<avk::owning_resource<orca_scene_t>> load_from_file_async(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, std::function<void(float)> aOnProgress = {});
 
 	private:
 		std::string mLoadPath;
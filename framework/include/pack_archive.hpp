@@ -0,0 +1,144 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Layout of Gears-Vk's pack archives, which bundle many asset files into one file (see `pack_archive`).
+	 *
+	 *	A pack archive starts with a `pack_archive_header`. It is followed by the entries' data, and every entry
+	 *	starts at a multiple of `pack_archive_page_size`, so that uncompressed entries can be served straight from
+	 *	the mapped archive's pages. The index is stored at the end of the file and consists of one
+	 *	`pack_archive_index_entry` per entry, each directly followed by the entry's path (without terminating zero).
+	 *	Paths are stored normalized, see `pack_archive::normalize_path`.
+	 *	All values are stored in the host's (i.e. little endian) byte order.
+	 */
+	inline constexpr std::array<char, 8> pack_archive_magic{ 'G', 'V', 'K', 'P', 'A', 'C', 'K', '\0' };
+	inline constexpr uint32_t pack_archive_version = 1u;
+	inline constexpr uint64_t pack_archive_page_size = 4096u;
+
+	enum struct pack_entry_compression : uint32_t
+	{
+		/** Stored as is, served without copying */
+		none = 0,
+		/** Compressed in the LZ4 block format, decompressed into memory on every read */
+		lz4_block = 1
+	};
+
+	struct pack_archive_header
+	{
+		std::array<char, 8> mMagic;
+		uint32_t mVersion;
+		uint32_t mNumEntries;
+		/** Offset of the index from the beginning of the file in bytes */
+		uint64_t mIndexOffset;
+		/** Size of the index in bytes */
+		uint64_t mIndexSize;
+	};
+
+	struct pack_archive_index_entry
+	{
+		/** Offset from the beginning of the file in bytes, a multiple of `pack_archive_page_size` */
+		uint64_t mOffset;
+		/** Size of the stored, i.e. possibly compressed, data in bytes */
+		uint64_t mStoredSize;
+		/** Size of the original file in bytes */
+		uint64_t mSize;
+		pack_entry_compression mCompression;
+		/** Length of the path which directly follows this entry */
+		uint32_t mPathLength;
+	};
+
+	static_assert(std::is_trivially_copyable_v<pack_archive_header> && std::is_trivially_copyable_v<pack_archive_index_entry>);
+
+	/**	The contents of a file which has been opened through a `pack_archive` or the `virtual_file_system`.
+	 *	The data is either served straight from a mapped file, or from memory which is owned by this object.
+	 *	Either way, it stays valid for as long as this object (or a copy of it) lives.
+	 */
+	class vfs_file
+	{
+	public:
+		vfs_file() = default;
+		vfs_file(std::string aPath, std::span<const std::byte> aData, std::shared_ptr<const void> aStorage)
+			: mPath{ std::move(aPath) }
+			, mData{ aData }
+			, mStorage{ std::move(aStorage) }
+		{ }
+
+		/** Gets the (normalized) path of this file */
+		const std::string& path() const { return mPath; }
+
+		/** Gets the file's contents */
+		std::span<const std::byte> data() const { return mData; }
+
+		/** Gets the file's size in bytes */
+		size_t size() const { return mData.size(); }
+
+	private:
+		std::string mPath;
+		std::span<const std::byte> mData;
+		/** Keeps the memory which mData refers to alive */
+		std::shared_ptr<const void> mStorage;
+	};
+
+	/**	A pack archive, which bundles many files into one file which is mapped into memory as a whole.
+	 *	Create pack archives via `pack_archive::create`, and mount them into the `virtual_file_system` to use them.
+	 */
+	class pack_archive : public std::enable_shared_from_this<pack_archive>
+	{
+	public:
+		pack_archive() = default;
+		pack_archive(pack_archive&&) noexcept = delete;
+		pack_archive(const pack_archive&) = delete;
+		pack_archive& operator=(pack_archive&&) noexcept = delete;
+		pack_archive& operator=(const pack_archive&) = delete;
+		~pack_archive() = default;
+
+		/**	Maps the pack archive at the given path into memory and reads its index.
+		 *	Throws a gvk::runtime_error if the file is not a valid pack archive.
+		 */
+		static std::shared_ptr<pack_archive> open(const std::string& aPath);
+
+		/**	Writes a new pack archive which contains the given files.
+		 *	@param	aArchivePath	Path of the pack archive to be written
+		 *	@param	aFilePaths		Paths of the files to be stored. They are stored under their normalized path, i.e. the
+		 *							files must be referred to by the same paths (relative to the same working directory) later.
+		 *	@param	aCompress		If true, entries are compressed if it saves at least an eighth of their size.
+		 *							Compressed entries must be decompressed on every read; store already compressed
+		 *							formats (e.g. PNG or JPEG) or frequently read files uncompressed to get zero-copy reads.
+		 */
+		static void create(const std::string& aArchivePath, const std::vector<std::string>& aFilePaths, bool aCompress = true);
+
+		/** Normalizes a path as used for looking up entries: lexically normalized, with forward slashes, and lowercase on Windows. */
+		static std::string normalize_path(const std::string& aPath);
+
+		/** Returns true if this archive contains an entry for the given (not necessarily normalized) path */
+		bool contains(const std::string& aPath) const;
+
+		/**	Opens the entry for the given (not necessarily normalized) path, or returns an empty optional if there is none.
+		 *	Uncompressed entries are served straight from the mapped archive, compressed ones are decompressed.
+		 */
+		std::optional<vfs_file> open_entry(const std::string& aPath) const;
+
+		/** Returns the path of the pack archive */
+		const std::string& path() const { return mFile.path(); }
+
+		/** Returns the number of entries */
+		size_t num_entries() const { return mEntries.size(); }
+
+	private:
+		mapped_file mFile;
+		std::unordered_map<std::string, pack_archive_index_entry> mEntries;
+	};
+
+	/**	Compresses the given data in the LZ4 block format.
+	 *	@return	The compressed data, which can be decompressed via `lz4_block_decompress`
+	 */
+	extern std::vector<std::byte> lz4_block_compress(std::span<const std::byte> aData);
+
+	/**	Decompresses data in the LZ4 block format.
+	 *	@param	aCompressed		The compressed data
+	 *	@param	aDestination	Receives the decompressed data, must have exactly the original data's size
+	 *	Throws a gvk::runtime_error if the data is malformed or does not decompress to exactly aDestination's size.
+	 */
+	extern void lz4_block_decompress(std::span<const std::byte> aCompressed, std::span<std::byte> aDestination);
+}
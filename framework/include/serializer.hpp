@@ -516,16 +516,23 @@ namespace gvk {
 	}
 
 	template<typename Archive>
-	void serialize(Archive& aArchive, gvk::animated_node& aValue)
+	void serialize(Archive& aArchive, gvk::animated_node_keys& aValue)
 	{
 		aArchive(
 			aValue.mPositionKeys,
 			aValue.mRotationKeys,
 			aValue.mScalingKeys,
 			aValue.mSameRotationAndPositionKeyTimes,
-			aValue.mSameScalingAndPositionKeyTimes,
+			aValue.mSameScalingAndPositionKeyTimes
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::animated_node& aValue)
+	{
+		aArchive(
 			aValue.mLocalTransform,
-			aValue.mGlobalTransform,
+			aValue.mRestGlobalTransform,
 			aValue.mAnimatedParentIndex,
 			aValue.mParentTransform,
 			aValue.mBoneMeshTargets
@@ -533,12 +540,98 @@ namespace gvk {
 	}
 
 	template<typename Archive>
-	void serialize(Archive& aArchive, gvk::animation& aValue)
+	void serialize(Archive& aArchive, gvk::animation_skeleton& aValue)
 	{
 		aArchive(
-			aValue.mAnimationData,
-			aValue.mAnimationIndex,
+			aValue.mNodes,
+			aValue.mModelNodeIndices,
 			aValue.mMaxNumBoneMatrices
 		);
 	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::animation_track_set& aValue)
+	{
+		aArchive(
+			aValue.mAnimationIndex,
+			aValue.mNodeKeys
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::animation& aValue)
+	{
+		// A skeleton which is shared by multiple animations is stored only once per archive (cereal tracks shared_ptrs):
+		auto skeleton = std::const_pointer_cast<gvk::animation_skeleton>(aValue.mSkeleton);
+		auto tracks = std::const_pointer_cast<gvk::animation_track_set>(aValue.mTracks);
+		aArchive(
+			skeleton,
+			tracks
+		);
+		aValue.mSkeleton = std::move(skeleton);
+		aValue.mTracks = std::move(tracks);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::bounding_box& aValue)
+	{
+		aArchive(
+			aValue.mMin,
+			aValue.mMax
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::bounding_sphere& aValue)
+	{
+		aArchive(
+			aValue.mCenter,
+			aValue.mRadius
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::quantization_transform& aValue)
+	{
+		aArchive(
+			aValue.mOffset,
+			aValue.mScale
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::meshlet& aValue)
+	{
+		aArchive(
+			aValue.mVertexOffset,
+			aValue.mPrimitiveOffset,
+			aValue.mVertexCount,
+			aValue.mPrimitiveCount,
+			aValue.mCenter,
+			aValue.mRadius,
+			aValue.mConeAxis,
+			aValue.mConeCutoff,
+			aValue.mConeApex,
+			aValue.mMeshIndexInSelection
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::meshlet_data& aValue)
+	{
+		aArchive(
+			aValue.mMeshlets,
+			aValue.mVertexIndices,
+			aValue.mPrimitiveIndices
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::tangent_space& aValue)
+	{
+		aArchive(
+			aValue.mTangents,
+			aValue.mBitangents
+		);
+	}
 }
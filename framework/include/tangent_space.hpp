@@ -0,0 +1,30 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Per-vertex tangents and bitangents of one mesh, as generated by `generate_tangent_space` */
+	struct tangent_space
+	{
+		std::vector<glm::vec3> mTangents;
+		std::vector<glm::vec3> mBitangents;
+	};
+
+	/**	Generates per-vertex tangents and bitangents for the given triangle mesh, following MikkTSpace's conventions:
+	 *	every triangle contributes its texture space derivatives, projected into the tangent plane of each corner's
+	 *	normal and weighted by the corner's angle; the bitangent is `sign * cross(normal, tangent)`, where the sign
+	 *	is the handedness of the texture mapping. Unlike MikkTSpace, vertices are never split, i.e. vertices which
+	 *	are shared across mirrored texture space seams get the tangent frame of the majority of their triangles.
+	 *
+	 *	Triangles are processed concurrently, and so are vertices afterwards. The result is deterministic.
+	 *	Vertices without any valid contribution (e.g. only degenerate texture coordinates) get an arbitrary
+	 *	tangent frame which is orthonormal to their normal.
+	 *
+	 *	@param	aIndices			Triangle list indices
+	 *	@param	aPositions			Vertex positions, indexed by aIndices
+	 *	@param	aNormals			Vertex normals, same length as aPositions
+	 *	@param	aTexCoords			Vertex texture coordinates, same length as aPositions
+	 *	@return	Tangents and bitangents, each of the same length as aPositions
+	 */
+	extern tangent_space generate_tangent_space(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords);
+}
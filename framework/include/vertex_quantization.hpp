@@ -0,0 +1,50 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Transformation which maps quantized unorm values (i.e. in the range [0, 1] after the
+	 *	hardware's format conversion) back to their original range: `original = mOffset + quantized * mScale`
+	 */
+	struct quantization_transform
+	{
+		glm::vec3 mOffset{ 0.0f };
+		glm::vec3 mScale{ 1.0f };
+
+		/** Dequantizes one value on the CPU */
+		glm::vec3 dequantize(const glm::vec3& aQuantized) const { return mOffset + aQuantized * mScale; }
+
+		/** Gets the dequantization as matrix, e.g. to be multiplied from the right onto a model matrix */
+		glm::mat4 to_mat4() const { return glm::translate(glm::mat4{ 1.0f }, mOffset) * glm::scale(glm::mat4{ 1.0f }, mScale); }
+	};
+
+	/**	Computes the transformation which maps the given positions' axis-aligned bounding box to [0, 1]^3, and back.
+	 *	Degenerate extents (e.g. of planar meshes) are handled gracefully.
+	 */
+	extern quantization_transform compute_quantization_transform(const glm::vec3* aPositions, size_t aNumPositions);
+
+	/** Encodes a unit vector into two snorm16 values, using the octahedral mapping (Meyer et al., "On Floating-Point Normal Vectors") */
+	extern glm::i16vec2 encode_octahedral_snorm16(const glm::vec3& aUnitVector);
+
+	/** Decodes a unit vector which has been encoded with `encode_octahedral_snorm16` */
+	extern glm::vec3 decode_octahedral_snorm16(const glm::i16vec2& aEncoded);
+
+	/** Encodes many unit vectors via `encode_octahedral_snorm16`, uses SSE2 where available. Vectors of zero length are encoded as (0,0,1). */
+	extern void encode_octahedral_snorm16(const glm::vec3* aSource, glm::i16vec2* aDestination, size_t aCount);
+
+	/**	Quantizes float vectors to unorm16: `round(clamp((value - offset) * scale, 0, 1) * 65535)`, separately for each component.
+	 *	Uses SSE2 where available.
+	 *	@param	aSource				Source values, aNumVectors * aNumComponents floats
+	 *	@param	aDestination		Destination values, aNumVectors * aNumComponents uint16s
+	 *	@param	aNumVectors			Number of vectors to be converted
+	 *	@param	aNumComponents		Number of components per vector, 1 to 4
+	 *	@param	aOffsets			One offset per component
+	 *	@param	aScales				One scale per component
+	 */
+	extern void quantize_unorm16(const float* aSource, uint16_t* aDestination, size_t aNumVectors, size_t aNumComponents, const float* aOffsets, const float* aScales);
+
+	/**	Converts floats to IEEE 754 half precision floats with round-to-nearest-even, uses SSE2 where available.
+	 *	Values which are out of range turn into infinity.
+	 */
+	extern void convert_to_half(const float* aSource, uint16_t* aDestination, size_t aNumValues);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Resolves file paths to file contents. Files are looked up in all mounted pack archives first (see
+	 *	`pack_archive`), where archives which have been mounted later take precedence. Files which are not
+	 *	contained in any archive are read from the file system by mapping them into memory.
+	 *
+	 *	Model loading (see `model_t::load_from_file`), ORCA scene loading, and image loading (see
+	 *	`create_image_from_file_cached`) read all their files through `virtual_file_system::shared()`.
+	 */
+	class virtual_file_system
+	{
+	public:
+		virtual_file_system() = default;
+		virtual_file_system(virtual_file_system&&) noexcept = delete;
+		virtual_file_system(const virtual_file_system&) = delete;
+		virtual_file_system& operator=(virtual_file_system&&) noexcept = delete;
+		virtual_file_system& operator=(const virtual_file_system&) = delete;
+		~virtual_file_system() = default;
+
+		/**	Opens the pack archive at the given path and mounts it.
+		 *	Throws a gvk::runtime_error if it is not a valid pack archive.
+		 */
+		void mount(const std::string& aArchivePath);
+
+		/** Mounts an already opened pack archive */
+		void mount(std::shared_ptr<pack_archive> aArchive);
+
+		/** Unmounts all pack archives. Files which have been opened from them stay valid. */
+		void unmount_all();
+
+		/** Returns true if the file at the given path is contained in a mounted pack archive or exists in the file system */
+		bool exists(const std::string& aPath) const;
+
+		/**	Opens the file at the given path, see the class description for the lookup order.
+		 *	Throws a gvk::runtime_error if the file can be found neither in a pack archive nor in the file system.
+		 */
+		vfs_file open(const std::string& aPath) const;
+
+		/** Gets the process-wide virtual file system */
+		static virtual_file_system& shared();
+
+	private:
+		std::vector<std::shared_ptr<pack_archive>> archives() const;
+
+		mutable std::mutex mMutex;
+		std::vector<std::shared_ptr<pack_archive>> mArchives;
+	};
+
+	/**	Assimp IO system which reads all files through a `virtual_file_system`, i.e. from mapped pack archives
+	 *	or mapped files, and never copies uncompressed data before Assimp reads it. Writing is not supported.
+	 */
+	class vfs_io_system : public Assimp::IOSystem
+	{
+	public:
+		explicit vfs_io_system(const virtual_file_system& aFileSystem)
+			: mFileSystem{ &aFileSystem }
+		{ }
+
+		bool Exists(const char* pFile) const override;
+		char getOsSeparator() const override { return '/'; }
+		Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override;
+		void Close(Assimp::IOStream* pFile) override;
+
+	private:
+		const virtual_file_system* mFileSystem;
+	};
+
+	/** Assimp IO stream which reads from a `vfs_file` */
+	class vfs_io_stream : public Assimp::IOStream
+	{
+	public:
+		explicit vfs_io_stream(vfs_file aFile)
+			: mFile{ std::move(aFile) }
+		{ }
+
+		size_t Read(void* pvBuffer, size_t pSize, size_t pCount) override;
+		size_t Write(const void* pvBuffer, size_t pSize, size_t pCount) override { return 0; }
+		aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+		size_t Tell() const override { return mPosition; }
+		size_t FileSize() const override { return mFile.size(); }
+		void Flush() override { }
+
+	private:
+		vfs_file mFile;
+		size_t mPosition = 0;
+	};
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	A fixed number of worker threads which execute submitted tasks in FIFO order.
+	 *	Intended for long-running background work like loading assets, which must not block the
+	 *	main loop. Short, fine-grained parallel work should rather use the parallel STL algorithms.
+	 */
+	class worker_pool
+	{
+	public:
+		/** Creates a pool with the given number of threads (at least one) */
+		explicit worker_pool(size_t aNumThreads);
+		worker_pool(worker_pool&&) noexcept = delete;
+		worker_pool(const worker_pool&) = delete;
+		worker_pool& operator=(worker_pool&&) noexcept = delete;
+		worker_pool& operator=(const worker_pool&) = delete;
+		/** Discards all tasks which have not been started yet and waits for the running ones to finish. */
+		~worker_pool();
+
+		/**	Enqueues a task which will be executed on one of the worker threads.
+		 *	Exceptions must be handled by the task itself; if one escapes nevertheless, it is logged and dropped.
+		 */
+		void submit(std::function<void()> aTask);
+
+		/** Returns the number of worker threads */
+		size_t num_threads() const { return mThreads.size(); }
+
+		/**	Gets the process-wide pool which is used for asynchronous loading. It is created on first use
+		 *	and has one thread less than there are hardware threads, leaving one for the main loop.
+		 */
+		static worker_pool& shared();
+
+	private:
+		void work();
+
+		std::vector<std::thread> mThreads;
+		std::deque<std::function<void()>> mTasks;
+		std::mutex mMutex;
+		std::condition_variable mTaskAvailable;
+		bool mStopping = false;
+	};
+}
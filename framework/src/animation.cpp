@@ -3,6 +3,47 @@
 
 namespace gvk
 {
+	animation_playback_state::animation_playback_state(const animation& aAnimation)
+		: mCursors(aAnimation.number_of_animated_nodes())
+		, mGlobalTransforms(aAnimation.number_of_animated_nodes(), glm::mat4{ 1.0f })
+		, mLocalTransforms(aAnimation.number_of_animated_nodes(), glm::mat4{ 1.0f })
+	{
+	}
+
+	size_t animation_skeleton::size_in_bytes() const
+	{
+		size_t result = mNodes.size() * sizeof(animated_node) + mModelNodeIndices.size() * sizeof(size_t);
+		for (const auto& anode : mNodes) {
+			result += anode.mBoneMeshTargets.size() * sizeof(bone_mesh_data);
+		}
+		return result;
+	}
+
+	size_t animation_track_set::size_in_bytes() const
+	{
+		size_t result = mNodeKeys.size() * sizeof(animated_node_keys);
+		for (const auto& keys : mNodeKeys) {
+			result += keys.mPositionKeys.size() * sizeof(position_key) + keys.mRotationKeys.size() * sizeof(rotation_key) + keys.mScalingKeys.size() * sizeof(scaling_key);
+		}
+		return result;
+	}
+
+	animation::animation(std::shared_ptr<const animation_skeleton> aSkeleton, std::shared_ptr<const animation_track_set> aTracks)
+		: mSkeleton{ std::move(aSkeleton) }
+		, mTracks{ std::move(aTracks) }
+	{
+		if (!mSkeleton || !mTracks) {
+			throw gvk::logic_error("An animation requires a skeleton and a track set.");
+		}
+		if (mTracks->mNodeKeys.size() != mSkeleton->mNodes.size()) {
+			throw gvk::logic_error("The track set has not been created for the given skeleton: it contains keys for " + std::to_string(mTracks->mNodeKeys.size()) + " nodes, but the skeleton has " + std::to_string(mSkeleton->mNodes.size()) + " nodes.");
+		}
+	}
+
+	void animation_playback_state::reset()
+	{
+		std::fill(std::begin(mCursors), std::end(mCursors), animation_key_cursor{});
+	}
 
 	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
 	{
@@ -72,56 +113,366 @@ namespace gvk
 		}
 	}
 
-	std::vector<double> animation::animation_key_times_within_clip(const animation_clip_data& aClip) const
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, glm::mat4* aTargetMemory) const
 	{
-		std::set<double> mUniqueKeys;
-		for (auto& anode : mAnimationData) {
-			for (const auto& pk : anode.mPositionKeys) {
-				if (pk.mTime >= aClip.mStartTicks && pk.mTime <= aClip.mEndTicks) {
-					mUniqueKeys.insert(pk.mTime);
-				}
+		return animate_into_single_target_buffer(aPlaybackState, aClip, aTime, bone_matrices_space::mesh_space, aTargetMemory);
+	}
+
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const
+	{
+		switch (aTargetSpace) {
+		case bone_matrices_space::mesh_space:
+			animate(aPlaybackState, aClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix;
+			});
+			break;
+		case bone_matrices_space::model_space:
+			animate(aPlaybackState, aClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aTransformMatrix * aInverseBindPoseMatrix;
+			});
+			break;
+		default:
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+	}
+
+	/**	Writes the bone matrices in the given palette format. aAnimate is invoked with the callback which receives the bone
+	 *	matrices (see `animation::animate`), aWrite is invoked with each bone's mesh_bone_info and bone matrix.
+	 *	For formats which cannot represent every bone matrix, all bone matrices are checked before the first one is
+	 *	written, s.t. the target memory is never left partly written if one of them is rejected.
+	 */
+	template <typename A, typename W>
+	static void write_bone_palette(bone_matrices_space aTargetSpace, bone_palette_format aFormat, A aAnimate, W aWrite)
+	{
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+		const bool toMeshSpace = bone_matrices_space::mesh_space == aTargetSpace;
+		auto boneMatrixOf = [toMeshSpace](const glm::mat4& bInverseMeshRootMatrix, const glm::mat4& bTransformMatrix, const glm::mat4& bInverseBindPoseMatrix) {
+			return toMeshSpace ? bInverseMeshRootMatrix * bTransformMatrix * bInverseBindPoseMatrix : bTransformMatrix * bInverseBindPoseMatrix;
+		};
+
+		if (bone_palette_format::dual_quaternion != aFormat && bone_palette_format::dual_quaternion_half != aFormat) {
+			aAnimate([&](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aWrite(aInfo, boneMatrixOf(aInverseMeshRootMatrix, aTransformMatrix, aInverseBindPoseMatrix));
+			});
+			return;
+		}
+
+		thread_local std::vector<std::tuple<mesh_bone_info, glm::mat4>> tBoneMatrices;
+		tBoneMatrices.clear();
+		aAnimate([&](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+			tBoneMatrices.emplace_back(aInfo, boneMatrixOf(aInverseMeshRootMatrix, aTransformMatrix, aInverseBindPoseMatrix));
+		});
+		for (const auto& [info, boneMatrix] : tBoneMatrices) {
+			if (!is_representable_in_bone_palette(boneMatrix, aFormat)) {
+				throw gvk::runtime_error(fmt::format("Bone matrix {} of mesh {} contains scaling or mirroring, which a dual quaternion cannot represent. Use bone_palette_format::affine_3x4 instead.", info.mMeshLocalBoneIndex, info.mMeshIndexInModel));
 			}
-			for (const auto& rk : anode.mRotationKeys) {
-				if (rk.mTime >= aClip.mStartTicks && rk.mTime <= aClip.mEndTicks) {
-					mUniqueKeys.insert(rk.mTime);
+		}
+		for (const auto& [info, boneMatrix] : tBoneMatrices) {
+			aWrite(info, boneMatrix);
+		}
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		write_bone_palette(aTargetSpace, aFormat,
+			[&](auto&& bBoneMatrixCalc) { animate(aClip, aTime, bBoneMatrixCalc); },
+			[target = static_cast<uint8_t*>(aTargetMemory), format = aFormat, meshStride = aMeshStride, matStride = aMatricesStride.value_or(bytes_per_bone(aFormat)), maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max())]
+			(mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+				if (aInfo.mMeshAnimationIndex < maxMeshes && aInfo.mMeshLocalBoneIndex < maxBones) {
+					write_bone_palette_entry(aBoneMatrix, format, target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * matStride);
 				}
 			}
-			for (const auto& sk : anode.mScalingKeys) {
-				if (sk.mTime >= aClip.mStartTicks && sk.mTime <= aClip.mEndTicks) {
-					mUniqueKeys.insert(sk.mTime);
+		);
+	}
+
+	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory)
+	{
+		write_bone_palette(aTargetSpace, aFormat,
+			[&](auto&& bBoneMatrixCalc) { animate(aClip, aTime, bBoneMatrixCalc); },
+			[target = static_cast<uint8_t*>(aTargetMemory), format = aFormat, entrySize = bytes_per_bone(aFormat)](mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+				write_bone_palette_entry(aBoneMatrix, format, target + (aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex) * entrySize);
+			}
+		);
+	}
+
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory) const
+	{
+		write_bone_palette(aTargetSpace, aFormat,
+			[&](auto&& bBoneMatrixCalc) { animate(aPlaybackState, aClip, aTime, bBoneMatrixCalc); },
+			[target = static_cast<uint8_t*>(aTargetMemory), format = aFormat, entrySize = bytes_per_bone(aFormat)](mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+				write_bone_palette_entry(aBoneMatrix, format, target + (aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex) * entrySize);
+			}
+		);
+	}
+
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const
+	{
+		switch (aTargetSpace) {
+		case bone_matrices_space::mesh_space:
+			animate(aPlaybackState, aLayers, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix;
+			});
+			break;
+		case bone_matrices_space::model_space:
+			animate(aPlaybackState, aLayers, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aTransformMatrix * aInverseBindPoseMatrix;
+			});
+			break;
+		default:
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+	}
+
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory) const
+	{
+		write_bone_palette(aTargetSpace, aFormat,
+			[&](auto&& bBoneMatrixCalc) { animate(aPlaybackState, aLayers, bBoneMatrixCalc); },
+			[target = static_cast<uint8_t*>(aTargetMemory), format = aFormat, entrySize = bytes_per_bone(aFormat)](mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+				write_bone_palette_entry(aBoneMatrix, format, target + (aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex) * entrySize);
+			}
+		);
+	}
+
+	void animation::animate_into_single_target_buffer(animation_playback_state& aPlaybackState, const baked_animation_clip& aBakedClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, bool aInterpolate) const
+	{
+		if (baked_pose_format::bone_matrices == aBakedClip.mFormat) {
+			if (aBakedClip.mAnimationIndex != animation_index()) {
+				throw gvk::runtime_error("The animation index of the passed baked_animation_clip is not the same that was used to create this animation.");
+			}
+			if (aBakedClip.mTargetSpace != aTargetSpace) {
+				throw gvk::logic_error("The baked_animation_clip has been baked into bone matrices of a different target space.");
+			}
+			if (aBakedClip.pose_size() != number_of_bone_matrices()) {
+				throw gvk::logic_error("The baked_animation_clip has not been baked into the bone matrices of this animation's skeleton.");
+			}
+			aBakedClip.sample_bone_matrices(aTime, aTargetMemory, aInterpolate);
+			return;
+		}
+
+		switch (aTargetSpace) {
+		case bone_matrices_space::mesh_space:
+			animate(aPlaybackState, aBakedClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix;
+			}, aInterpolate);
+			break;
+		case bone_matrices_space::model_space:
+			animate(aPlaybackState, aBakedClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aTransformMatrix * aInverseBindPoseMatrix;
+			}, aInterpolate);
+			break;
+		default:
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+	}
+
+	void animation::build_soa_tracks()
+	{
+		mSoaTracks = std::make_shared<const animation_soa_tracks>(animation_soa_tracks::create_from_tracks(*mSkeleton, *mTracks));
+	}
+
+	void animation::prepare_playback_state(animation_playback_state& aPlaybackState) const
+	{
+		const auto numNodes = number_of_animated_nodes();
+		if (aPlaybackState.mCursors.size() != numNodes) {
+			aPlaybackState.mCursors.assign(numNodes, animation_key_cursor{});
+			aPlaybackState.mGlobalTransforms.resize(numNodes);
+			aPlaybackState.mLocalTransforms.resize(numNodes);
+		}
+	}
+
+	void animation::evaluate_local_transforms(animation_playback_state& aPlaybackState, double aTimeInTicks) const
+	{
+		const auto numNodes = mSkeleton->mNodes.size();
+		for (size_t nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex) {
+			const auto& anode = mTracks->mNodeKeys[nodeIndex];
+			auto& cursor = aPlaybackState.mCursors[nodeIndex];
+			auto& localTransform = aPlaybackState.mLocalTransforms[nodeIndex];
+
+			// The localTransform can only be different than the local transform of the node if there are animation keys.
+			if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() == 0) {
+				localTransform = mSkeleton->mNodes[nodeIndex].mLocalTransform;
+				continue;
+			}
+
+			const auto [translation, rotation, scaling] = sample_node_keys(anode, aTimeInTicks, cursor);
+			localTransform = matrix_from_transforms(translation, rotation, scaling);
+		}
+	}
+
+	std::tuple<glm::vec3, glm::quat, glm::vec3> animation::sample_node_keys(const animated_node_keys& aKeys, double aTimeInTicks, animation_key_cursor& aCursor) const
+	{
+		// Translation/position:
+		auto [tpos1, tpos2] = find_positions_in_keys(aKeys.mPositionKeys, aTimeInTicks, aCursor.mPositionKey);
+		auto tf = get_interpolation_factor(aKeys.mPositionKeys[tpos1], aKeys.mPositionKeys[tpos2], aTimeInTicks);
+		auto translation = glm::lerp(aKeys.mPositionKeys[tpos1].mValue, aKeys.mPositionKeys[tpos2].mValue, tf);
+
+		// Rotation:
+		size_t rpos1 = tpos1, rpos2 = tpos2;
+		if (!aKeys.mSameRotationAndPositionKeyTimes) {
+			std::tie(rpos1, rpos2) = find_positions_in_keys(aKeys.mRotationKeys, aTimeInTicks, aCursor.mRotationKey);
+		}
+		auto rf = get_interpolation_factor(aKeys.mRotationKeys[rpos1], aKeys.mRotationKeys[rpos2], aTimeInTicks);
+		auto rotation = glm::slerp(aKeys.mRotationKeys[rpos1].mValue, aKeys.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
+		rotation = glm::normalize(rotation); // normalize the resulting quaternion, just to be on the safe side
+
+		// Scaling:
+		size_t spos1 = tpos1, spos2 = tpos2;
+		if (!aKeys.mSameScalingAndPositionKeyTimes) {
+			std::tie(spos1, spos2) = find_positions_in_keys(aKeys.mScalingKeys, aTimeInTicks, aCursor.mScalingKey);
+		}
+		auto sf = get_interpolation_factor(aKeys.mScalingKeys[spos1], aKeys.mScalingKeys[spos2], aTimeInTicks);
+		auto scaling = glm::lerp(aKeys.mScalingKeys[spos1].mValue, aKeys.mScalingKeys[spos2].mValue, sf);
+
+		return std::make_tuple(translation, rotation, scaling);
+	}
+
+	double animation::blend_local_transforms(animation_playback_state& aPlaybackState, std::span<const animation_blend_layer> aLayers) const
+	{
+		if (aLayers.empty()) {
+			throw gvk::logic_error("At least one animation_blend_layer is required for blending.");
+		}
+		const auto numNodes = number_of_animated_nodes();
+
+		// The time in ticks of every layer, reused across calls:
+		thread_local std::vector<double> tTimesInTicks;
+		tTimesInTicks.resize(aLayers.size());
+		for (size_t l = 0; l < aLayers.size(); ++l) {
+			const auto& layer = aLayers[l];
+			if (nullptr == layer.mAnimation || layer.mAnimation->mSkeleton != mSkeleton) {
+				throw gvk::logic_error("Every animation_blend_layer must refer to an animation which shares the skeleton of the animation that blends them, see model_t::prepare_all_animations.");
+			}
+			if (layer.mClip.mTicksPerSecond == 0.0) {
+				throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+			}
+			if (layer.mClip.mAnimationIndex != layer.mAnimation->animation_index()) {
+				throw gvk::runtime_error("The animation index of an animation_blend_layer's clip is not the same that was used to create the layer's animation.");
+			}
+			if (!layer.mNodeMask.empty() && layer.mNodeMask.size() != numNodes) {
+				throw gvk::logic_error("The node mask of an animation_blend_layer must contain one weight per animated node.");
+			}
+			if (nullptr != layer.mPlaybackState) {
+				layer.mAnimation->prepare_playback_state(*layer.mPlaybackState);
+			}
+			tTimesInTicks[l] = layer.mTime * layer.mClip.mTicksPerSecond;
+		}
+
+		for (size_t nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex) {
+			const auto& restTransform = mSkeleton->mNodes[nodeIndex].mLocalTransform;
+			auto& localTransform = aPlaybackState.mLocalTransforms[nodeIndex];
+
+			glm::vec3 translation{ 0.0f };
+			glm::quat rotation{ 0.0f, 0.0f, 0.0f, 0.0f };
+			glm::vec3 scaling{ 0.0f };
+			float weightSum = 0.0f;
+			bool anyKeys = false;
+			std::optional<std::tuple<glm::vec3, glm::quat, glm::vec3>> restTransforms;
+			for (size_t l = 0; l < aLayers.size(); ++l) {
+				const auto& layer = aLayers[l];
+				const auto weight = layer.mNodeMask.empty() ? layer.mWeight : layer.mWeight * layer.mNodeMask[nodeIndex];
+				if (weight <= 0.0f) {
+					continue;
+				}
+
+				const auto& keys = layer.mAnimation->mTracks->mNodeKeys[nodeIndex];
+				std::tuple<glm::vec3, glm::quat, glm::vec3> sample;
+				if (keys.mPositionKeys.size() + keys.mRotationKeys.size() + keys.mScalingKeys.size() == 0) {
+					// Same as animation::animate: this layer keeps the node's local transform
+					if (!restTransforms.has_value()) {
+						restTransforms = transforms_from_matrix(restTransform);
+					}
+					sample = restTransforms.value();
+				}
+				else {
+					animation_key_cursor temporaryCursor;
+					auto& cursor = nullptr != layer.mPlaybackState ? layer.mPlaybackState->mCursors[nodeIndex] : temporaryCursor;
+					sample = sample_node_keys(keys, tTimesInTicks[l], cursor);
+					anyKeys = true;
+				}
+
+				auto [t, r, s] = sample;
+				// Average the rotations within one hemisphere, i.e. along the shortest arcs:
+				if (weightSum > 0.0f && glm::dot(rotation, r) < 0.0f) {
+					r = -r;
 				}
+				translation += weight * t;
+				rotation = rotation + r * weight;
+				scaling += weight * s;
+				weightSum += weight;
 			}
+
+			// Nodes which none of the (weighted) layers animates keep their local transform:
+			if (!anyKeys) {
+				localTransform = restTransform;
+				continue;
+			}
+			localTransform = matrix_from_transforms(translation / weightSum, glm::normalize(rotation), scaling / weightSum);
+		}
+
+		return tTimesInTicks.front();
+	}
+
+	void animation::evaluate_soa_local_transforms(animation_playback_state& aPlaybackState, double aTimeInTicks) const
+	{
+		mSoaTracks->evaluate_local_transforms(aTimeInTicks, aPlaybackState.mCursors, aPlaybackState.mLocalTransforms);
+	}
+
+	double animation::sample_baked_local_transforms(animation_playback_state& aPlaybackState, const baked_animation_clip& aBakedClip, double aTime, bool aInterpolate) const
+	{
+		if (aBakedClip.mAnimationIndex != animation_index()) {
+			throw gvk::runtime_error("The animation index of the passed baked_animation_clip is not the same that was used to create this animation.");
 		}
-		std::vector<double> result;
-		for (auto entry : mUniqueKeys) {
-			result.push_back(entry);
+		if (baked_pose_format::local_transforms != aBakedClip.mFormat || aBakedClip.pose_size() != number_of_animated_nodes()) {
+			throw gvk::logic_error("The baked_animation_clip has not been baked into the local transforms of this animation's nodes.");
 		}
+		aBakedClip.sample_local_transforms(aTime, aPlaybackState.mLocalTransforms, aInterpolate);
+		return aTime * aBakedClip.mTicksPerSecond;
+	}
+
+	std::vector<double> animation::animation_key_times_within_clip(const animation_clip_data& aClip) const
+	{
+		std::vector<double> result{ aClip.mStartTicks, aClip.mEndTicks };
+		auto addKeyTimes = [&](const auto& bKeys) {
+			for (const auto& key : bKeys) {
+				if (key.mTime >= aClip.mStartTicks && key.mTime <= aClip.mEndTicks) {
+					result.push_back(key.mTime);
+				}
+			}
+		};
+		for (auto& anode : mTracks->mNodeKeys) {
+			addKeyTimes(anode.mPositionKeys);
+			addKeyTimes(anode.mRotationKeys);
+			addKeyTimes(anode.mScalingKeys);
+		}
+		std::sort(std::begin(result), std::end(result));
+		result.erase(std::unique(std::begin(result), std::end(result)), std::end(result));
 		return result;
 	}
 
 	size_t animation::number_of_animated_nodes() const
 	{
-		return mAnimationData.size();
+		return mSkeleton ? mSkeleton->mNodes.size() : 0;
 	}
 	
-	std::reference_wrapper<animated_node> animation::get_animated_node_at(size_t aNodeIndex)
+	std::reference_wrapper<const animated_node> animation::get_animated_node_at(size_t aNodeIndex) const
 	{
-		assert(aNodeIndex < mAnimationData.size());
-		return std::ref(mAnimationData[aNodeIndex]);
+		assert(aNodeIndex < number_of_animated_nodes());
+		return std::cref(mSkeleton->mNodes[aNodeIndex]);
 	}
 
 	std::optional<size_t> animation::get_animated_parent_index_of(size_t aNodeIndex) const
 	{
-		assert(aNodeIndex < mAnimationData.size());
-		return mAnimationData[aNodeIndex].mAnimatedParentIndex;
+		assert(aNodeIndex < number_of_animated_nodes());
+		return mSkeleton->mNodes[aNodeIndex].mAnimatedParentIndex;
 	}
 
-	std::optional<std::reference_wrapper<animated_node>> animation::get_animated_parent_node_of(size_t aNodeIndex)
+	std::optional<std::reference_wrapper<const animated_node>> animation::get_animated_parent_node_of(size_t aNodeIndex) const
 	{
 		auto parentIndex = get_animated_parent_index_of(aNodeIndex);
 		if (parentIndex.has_value()) {
-			assert(parentIndex.value() < mAnimationData.size());
-			return std::ref(mAnimationData[parentIndex.value()]);
+			assert(parentIndex.value() < number_of_animated_nodes());
+			return std::cref(mSkeleton->mNodes[parentIndex.value()]);
 		}
 		return {};
 	}
@@ -129,25 +480,22 @@ namespace gvk
 	std::vector<size_t> animation::get_child_indices_of(size_t aNodeIndex) const
 	{
 		std::vector<size_t> result;
-		const auto n = mAnimationData.size();
-		assert(aNodeIndex < mAnimationData.size());
+		const auto& nodes = mSkeleton->mNodes;
+		const auto n = nodes.size();
+		assert(aNodeIndex < n);
 		for (size_t i = aNodeIndex + 1; i < n; ++i) {
-			if (mAnimationData[i].mAnimatedParentIndex.has_value() && mAnimationData[i].mAnimatedParentIndex.value() == aNodeIndex) {
+			if (nodes[i].mAnimatedParentIndex.has_value() && nodes[i].mAnimatedParentIndex.value() == aNodeIndex) {
 				result.push_back(i);
 			}
 		}
 		return result;
 	}
 
-	std::vector<std::reference_wrapper<animated_node>> animation::get_child_nodes_of(size_t aNodeIndex)
+	std::vector<std::reference_wrapper<const animated_node>> animation::get_child_nodes_of(size_t aNodeIndex) const
 	{
-		std::vector<std::reference_wrapper<animated_node>> result;
-		const auto n = mAnimationData.size();
-		assert(aNodeIndex < mAnimationData.size());
-		for (size_t i = aNodeIndex + 1; i < n; ++i) {
-			if (mAnimationData[i].mAnimatedParentIndex.has_value() && mAnimationData[i].mAnimatedParentIndex.value() == aNodeIndex) {
-				result.push_back(std::ref(mAnimationData[i]));
-			}
+		std::vector<std::reference_wrapper<const animated_node>> result;
+		for (auto i : get_child_indices_of(aNodeIndex)) {
+			result.push_back(std::cref(mSkeleton->mNodes[i]));
 		}
 		return result;
 	}
@@ -0,0 +1,125 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Animates all the instances in parallel, aAnimateInstance is invoked with the instance and the playback state to use */
+	template <typename F>
+	static void animate_instances_in_parallel(std::span<const animation_instance> aInstances, bone_matrices_space aTargetSpace, F aAnimateInstance)
+	{
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+		// Validate all instances up front, because an exception which escapes a parallel algorithm terminates the program:
+		for (const auto& instance : aInstances) {
+			if (nullptr == instance.mAnimation) {
+				throw gvk::logic_error("Every animation_instance must refer to an animation.");
+			}
+			if (instance.mClip.mTicksPerSecond == 0.0) {
+				throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+			}
+			if (instance.mClip.mAnimationIndex != instance.mAnimation->animation_index()) {
+				throw gvk::runtime_error("The animation index of an animation_instance's clip is not the same that was used to create the instance's animation.");
+			}
+		}
+
+		// Anything else which throws while animating (e.g. a bone which the palette format cannot represent) is rethrown after all instances have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::vector<size_t> indices(aInstances.size());
+		std::iota(std::begin(indices), std::end(indices), size_t{ 0 });
+		std::for_each(std::execution::par, std::begin(indices), std::end(indices), [&](size_t i) {
+			const auto& instance = aInstances[i];
+			// Instances without a playback state of their own use one per thread, which is only valid during this call:
+			thread_local animation_playback_state tTemporaryState;
+			auto& state = nullptr != instance.mPlaybackState ? *instance.mPlaybackState : tTemporaryState;
+			if (nullptr == instance.mPlaybackState) {
+				state.reset();
+			}
+			try {
+				aAnimateInstance(instance, state);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+	{
+		animate_instances_in_parallel(aInstances, aTargetSpace, [&](const animation_instance& bInstance, animation_playback_state& bState) {
+			bInstance.mAnimation->animate_into_single_target_buffer(bState, bInstance.mClip, bInstance.mTime, aTargetSpace, aTargetMemory + bInstance.mTargetOffset);
+		});
+	}
+
+	void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, glm::mat4* aTargetMemory)
+	{
+		animate_instances_into_single_target_buffer(aInstances, bone_matrices_space::mesh_space, aTargetMemory);
+	}
+
+	void animate_instances_into_single_target_buffer(std::span<const animation_instance> aInstances, bone_matrices_space aTargetSpace, bone_palette_format aFormat, void* aTargetMemory)
+	{
+		const auto entrySize = bytes_per_bone(aFormat);
+		animate_instances_in_parallel(aInstances, aTargetSpace, [&](const animation_instance& bInstance, animation_playback_state& bState) {
+			bInstance.mAnimation->animate_into_single_target_buffer(bState, bInstance.mClip, bInstance.mTime, aTargetSpace, aFormat, static_cast<uint8_t*>(aTargetMemory) + bInstance.mTargetOffset * entrySize);
+		});
+	}
+
+	animation_batch_benchmark_result benchmark_animate_instances(const animation& aAnimation, const animation_clip_data& aClip, size_t aNumInstances, size_t aNumFrames)
+	{
+		constexpr double frameTime = 1.0 / 60.0;
+		const auto paletteSize = aAnimation.number_of_bone_matrices();
+		const auto clipDuration = std::max(aClip.end_time() - aClip.start_time(), frameTime);
+
+		std::vector<glm::mat4> boneMatrices(aNumInstances * paletteSize);
+		std::vector<animation_playback_state> states(aNumInstances);
+		std::vector<animation_instance> instances(aNumInstances);
+		for (size_t i = 0; i < aNumInstances; ++i) {
+			instances[i].mAnimation = &aAnimation;
+			instances[i].mClip = aClip;
+			instances[i].mTargetOffset = i * paletteSize;
+			instances[i].mPlaybackState = &states[i];
+		}
+		// Let every instance play the clip in a loop, starting at a different point in time:
+		auto setTimes = [&](size_t bFrame) {
+			for (size_t i = 0; i < aNumInstances; ++i) {
+				instances[i].mTime = aClip.start_time() + std::fmod(static_cast<double>(i) * 0.137 + static_cast<double>(bFrame) * frameTime, clipDuration);
+			}
+		};
+
+		auto measure = [&](auto bAnimateFrame) {
+			for (auto& state : states) {
+				state.reset();
+			}
+			const auto start = std::chrono::steady_clock::now();
+			for (size_t f = 0; f < aNumFrames; ++f) {
+				setTimes(f);
+				bAnimateFrame();
+			}
+			const auto end = std::chrono::steady_clock::now();
+			return std::chrono::duration<double, std::milli>(end - start).count() / static_cast<double>(std::max(aNumFrames, size_t{ 1 }));
+		};
+
+		animation_batch_benchmark_result result;
+		result.mNumInstances = aNumInstances;
+		result.mNumFrames = aNumFrames;
+		result.mNumHardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+		result.mSerialMillisecondsPerFrame = measure([&]() {
+			for (const auto& instance : instances) {
+				instance.mAnimation->animate_into_single_target_buffer(*instance.mPlaybackState, instance.mClip, instance.mTime, boneMatrices.data() + instance.mTargetOffset);
+			}
+		});
+		result.mParallelMillisecondsPerFrame = measure([&]() {
+			animate_instances_into_single_target_buffer(instances, boneMatrices.data());
+		});
+
+		LOG_INFO(fmt::format("Animating {} instances with {} bone matrices each took {:.3f} ms per frame serially and {:.3f} ms per frame in parallel, i.e. a speedup of {:.2f} on {} hardware threads.",
+			aNumInstances, paletteSize, result.mSerialMillisecondsPerFrame, result.mParallelMillisecondsPerFrame, result.speedup(), result.mNumHardwareThreads));
+		return result;
+	}
+}
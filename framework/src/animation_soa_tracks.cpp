@@ -0,0 +1,277 @@
+#include <gvk.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GVK_ANIMATION_SOA_TRACKS_SSE2
+#endif
+
+namespace gvk
+{
+	/** Appends the given keys to the given SoA arrays, collapses them to one key if all of them have the same value */
+	template <typename K, typename V>
+	static void append_keys(const std::vector<K>& aKeys, std::vector<uint32_t>& aOffsets, std::vector<float>& aTimes, std::vector<V>& aValues)
+	{
+		const bool allEqual = std::all_of(std::begin(aKeys), std::end(aKeys), [&aKeys](const K& bKey) { return bKey.mValue == aKeys.front().mValue; });
+		const size_t n = allEqual ? std::min(aKeys.size(), size_t{ 1 }) : aKeys.size();
+		for (size_t i = 0; i < n; ++i) {
+			aTimes.push_back(static_cast<float>(aKeys[i].mTime));
+			aValues.push_back(aKeys[i].mValue);
+		}
+		aOffsets.push_back(static_cast<uint32_t>(aTimes.size()));
+	}
+
+	animation_soa_tracks animation_soa_tracks::create_from_tracks(const animation_skeleton& aSkeleton, const animation_track_set& aTracks)
+	{
+		animation_soa_tracks result;
+		const auto numNodes = aTracks.mNodeKeys.size();
+		assert(numNodes == aSkeleton.mNodes.size());
+		result.mPositionKeyOffsets.reserve(numNodes + 1);
+		result.mRotationKeyOffsets.reserve(numNodes + 1);
+		result.mScalingKeyOffsets.reserve(numNodes + 1);
+		result.mPositionKeyOffsets.push_back(0u);
+		result.mRotationKeyOffsets.push_back(0u);
+		result.mScalingKeyOffsets.push_back(0u);
+		result.mIsStatic.resize(numNodes, 0);
+		result.mStaticLocalTransforms.resize(numNodes, glm::mat4{ 1.0f });
+
+		for (size_t n = 0; n < numNodes; ++n) {
+			const auto& anode = aTracks.mNodeKeys[n];
+			append_keys(anode.mPositionKeys, result.mPositionKeyOffsets, result.mPositionTimes, result.mPositionValues);
+			append_keys(anode.mRotationKeys, result.mRotationKeyOffsets, result.mRotationTimes, result.mRotationValues);
+			append_keys(anode.mScalingKeys, result.mScalingKeyOffsets, result.mScalingTimes, result.mScalingValues);
+
+			const auto numPositionKeys = result.mPositionKeyOffsets[n + 1] - result.mPositionKeyOffsets[n];
+			const auto numRotationKeys = result.mRotationKeyOffsets[n + 1] - result.mRotationKeyOffsets[n];
+			const auto numScalingKeys = result.mScalingKeyOffsets[n + 1] - result.mScalingKeyOffsets[n];
+			if (0 == numPositionKeys + numRotationKeys + numScalingKeys) {
+				// Same as animation::animate: nodes without any keys keep their local transform
+				result.mIsStatic[n] = 1;
+				result.mStaticLocalTransforms[n] = aSkeleton.mNodes[n].mLocalTransform;
+			}
+			else if (numPositionKeys <= 1 && numRotationKeys <= 1 && numScalingKeys <= 1) {
+				result.mIsStatic[n] = 1;
+				result.mStaticLocalTransforms[n] = matrix_from_transforms(
+					numPositionKeys > 0 ? result.mPositionValues.back() : glm::vec3{ 0.0f },
+					numRotationKeys > 0 ? glm::normalize(result.mRotationValues.back()) : glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f },
+					numScalingKeys > 0 ? result.mScalingValues.back() : glm::vec3{ 1.0f }
+				);
+			}
+			else {
+				result.mDynamicNodes.push_back(static_cast<uint32_t>(n));
+			}
+		}
+		return result;
+	}
+
+	size_t animation_soa_tracks::size_in_bytes() const
+	{
+		return (mPositionKeyOffsets.size() + mRotationKeyOffsets.size() + mScalingKeyOffsets.size() + mDynamicNodes.size()) * sizeof(uint32_t)
+			+ (mPositionTimes.size() + mRotationTimes.size() + mScalingTimes.size()) * sizeof(float)
+			+ (mPositionValues.size() + mScalingValues.size()) * sizeof(glm::vec3)
+			+ mRotationValues.size() * sizeof(glm::quat)
+			+ mIsStatic.size() * sizeof(uint8_t)
+			+ mStaticLocalTransforms.size() * sizeof(glm::mat4);
+	}
+
+	/**	Finds the two keys between which aTime lies, in the same way as animation::find_positions_in_keys,
+	 *	and returns the index of the first one (relative to aTimes) and the interpolation factor.
+	 */
+	static std::tuple<uint32_t, uint32_t, float> find_keys_and_factor(const float* aTimes, uint32_t aNumKeys, float aTime, uint32_t& aCursor)
+	{
+		constexpr uint32_t maxCursorSteps = 4;
+		const uint32_t maxIndex = aNumKeys - 1;
+
+		uint32_t pos1 = std::min(aCursor, maxIndex);
+		bool found = false;
+		if (0 == pos1 || aTimes[pos1] <= aTime) {
+			for (uint32_t step = 0; step < maxCursorSteps && pos1 < maxIndex && aTimes[pos1 + 1] <= aTime; ++step) {
+				++pos1;
+			}
+			found = pos1 == maxIndex || aTimes[pos1 + 1] > aTime;
+		}
+		if (!found) {
+			const auto it = std::upper_bound(aTimes, aTimes + aNumKeys, aTime);
+			pos1 = aTimes == it ? 0u : static_cast<uint32_t>(it - aTimes) - 1u;
+		}
+		aCursor = pos1;
+
+		const uint32_t pos2 = pos1 + (pos1 < maxIndex ? 1u : 0u);
+		const float timeDifference = aTimes[pos2] - aTimes[pos1];
+		// Unlike animation::animate without SoA tracks, times before the first key do not extrapolate, but hold the first key:
+		const float factor = std::abs(timeDifference) < std::numeric_limits<float>::epsilon() ? 1.0f : glm::clamp((aTime - aTimes[pos1]) / timeDifference, 0.0f, 1.0f);
+		return std::make_tuple(pos1, pos2, factor);
+	}
+
+	// Four floats, one per node, and the few operations which the evaluation needs:
+#if defined(GVK_ANIMATION_SOA_TRACKS_SSE2)
+	struct soa_lanes { __m128 v; };
+	static inline soa_lanes soa_load(const float* aSrc) { return { _mm_load_ps(aSrc) }; }
+	static inline void soa_store(float* aDst, soa_lanes aValue) { _mm_store_ps(aDst, aValue.v); }
+	static inline soa_lanes soa_set1(float aValue) { return { _mm_set1_ps(aValue) }; }
+	static inline soa_lanes operator+(soa_lanes a, soa_lanes b) { return { _mm_add_ps(a.v, b.v) }; }
+	static inline soa_lanes operator-(soa_lanes a, soa_lanes b) { return { _mm_sub_ps(a.v, b.v) }; }
+	static inline soa_lanes operator*(soa_lanes a, soa_lanes b) { return { _mm_mul_ps(a.v, b.v) }; }
+	static inline soa_lanes operator/(soa_lanes a, soa_lanes b) { return { _mm_div_ps(a.v, b.v) }; }
+	static inline soa_lanes soa_sqrt(soa_lanes a) { return { _mm_sqrt_ps(a.v) }; }
+	static inline soa_lanes soa_abs(soa_lanes a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+	/** Returns +1 for lanes which are >= 0, -1 otherwise */
+	static inline soa_lanes soa_sign(soa_lanes a) { return { _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(_mm_set1_ps(-0.0f), _mm_cmplt_ps(a.v, _mm_setzero_ps()))) }; }
+#else
+	struct soa_lanes { float v[4]; };
+	static inline soa_lanes soa_load(const float* aSrc) { return { aSrc[0], aSrc[1], aSrc[2], aSrc[3] }; }
+	static inline void soa_store(float* aDst, soa_lanes aValue) { std::copy(aValue.v, aValue.v + 4, aDst); }
+	static inline soa_lanes soa_set1(float aValue) { return { aValue, aValue, aValue, aValue }; }
+	template <typename Op>
+	static inline soa_lanes soa_apply(soa_lanes a, soa_lanes b, Op op) { return { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) }; }
+	static inline soa_lanes operator+(soa_lanes a, soa_lanes b) { return soa_apply(a, b, std::plus<float>{}); }
+	static inline soa_lanes operator-(soa_lanes a, soa_lanes b) { return soa_apply(a, b, std::minus<float>{}); }
+	static inline soa_lanes operator*(soa_lanes a, soa_lanes b) { return soa_apply(a, b, std::multiplies<float>{}); }
+	static inline soa_lanes operator/(soa_lanes a, soa_lanes b) { return soa_apply(a, b, std::divides<float>{}); }
+	static inline soa_lanes soa_sqrt(soa_lanes a) { return { std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3]) }; }
+	static inline soa_lanes soa_abs(soa_lanes a) { return { std::abs(a.v[0]), std::abs(a.v[1]), std::abs(a.v[2]), std::abs(a.v[3]) }; }
+	static inline soa_lanes soa_sign(soa_lanes a) { return { a.v[0] < 0.0f ? -1.0f : 1.0f, a.v[1] < 0.0f ? -1.0f : 1.0f, a.v[2] < 0.0f ? -1.0f : 1.0f, a.v[3] < 0.0f ? -1.0f : 1.0f }; }
+#endif
+
+	/** The keys and interpolation factors of four nodes, gathered into one lane per node */
+	struct alignas(16) soa_batch
+	{
+		float mPosition[2][3][4];
+		float mPositionFactor[4];
+		float mRotation[2][4][4];
+		float mRotationFactor[4];
+		float mScaling[2][3][4];
+		float mScalingFactor[4];
+		/** Resulting matrices: the upper three rows of all four columns */
+		float mMatrix[4][3][4];
+	};
+
+	void animation_soa_tracks::evaluate_local_transforms(double aTimeInTicks, std::span<animation_key_cursor> aCursors, std::span<glm::mat4> aLocalTransforms) const
+	{
+		assert(aCursors.size() == number_of_nodes());
+		assert(aLocalTransforms.size() == number_of_nodes());
+		const float time = static_cast<float>(aTimeInTicks);
+
+		for (size_t n = 0; n < mIsStatic.size(); ++n) {
+			if (mIsStatic[n]) {
+				aLocalTransforms[n] = mStaticLocalTransforms[n];
+			}
+		}
+
+		soa_batch batch;
+		const auto numDynamic = mDynamicNodes.size();
+		for (size_t first = 0; first < numDynamic; first += 4) {
+			const size_t numLanes = std::min(numDynamic - first, size_t{ 4 });
+
+			// Gather the keys of up to four nodes (unused lanes repeat the last node):
+			for (size_t lane = 0; lane < 4; ++lane) {
+				const auto node = mDynamicNodes[first + std::min(lane, numLanes - 1)];
+				auto& cursor = aCursors[node];
+
+				auto gather3 = [&](const std::vector<uint32_t>& bOffsets, const std::vector<float>& bTimes, const std::vector<glm::vec3>& bValues, uint32_t& bCursor, float (&bDst)[2][3][4], float (&bFactor)[4], float bDefault) {
+					const auto offset = bOffsets[node];
+					const auto numKeys = bOffsets[node + 1] - offset;
+					if (0 == numKeys) {
+						for (int c = 0; c < 3; ++c) {
+							bDst[0][c][lane] = bDst[1][c][lane] = bDefault;
+						}
+						bFactor[lane] = 0.0f;
+						return;
+					}
+					const auto [pos1, pos2, factor] = find_keys_and_factor(bTimes.data() + offset, numKeys, time, bCursor);
+					for (int c = 0; c < 3; ++c) {
+						bDst[0][c][lane] = bValues[offset + pos1][c];
+						bDst[1][c][lane] = bValues[offset + pos2][c];
+					}
+					bFactor[lane] = factor;
+				};
+				gather3(mPositionKeyOffsets, mPositionTimes, mPositionValues, cursor.mPositionKey, batch.mPosition, batch.mPositionFactor, 0.0f);
+				gather3(mScalingKeyOffsets, mScalingTimes, mScalingValues, cursor.mScalingKey, batch.mScaling, batch.mScalingFactor, 1.0f);
+
+				const auto offset = mRotationKeyOffsets[node];
+				const auto numKeys = mRotationKeyOffsets[node + 1] - offset;
+				if (0 == numKeys) {
+					for (int c = 0; c < 4; ++c) {
+						batch.mRotation[0][c][lane] = batch.mRotation[1][c][lane] = 3 == c ? 1.0f : 0.0f;
+					}
+					batch.mRotationFactor[lane] = 0.0f;
+				}
+				else {
+					const auto [pos1, pos2, factor] = find_keys_and_factor(mRotationTimes.data() + offset, numKeys, time, cursor.mRotationKey);
+					const auto& q1 = mRotationValues[offset + pos1];
+					const auto& q2 = mRotationValues[offset + pos2];
+					const float c1[4] = { q1.x, q1.y, q1.z, q1.w };
+					const float c2[4] = { q2.x, q2.y, q2.z, q2.w };
+					for (int c = 0; c < 4; ++c) {
+						batch.mRotation[0][c][lane] = c1[c];
+						batch.mRotation[1][c][lane] = c2[c];
+					}
+					batch.mRotationFactor[lane] = factor;
+				}
+			}
+
+			// Interpolate positions and scalings linearly:
+			const auto one = soa_set1(1.0f);
+			const auto pf = soa_load(batch.mPositionFactor);
+			const auto sf = soa_load(batch.mScalingFactor);
+			soa_lanes t[3], s[3];
+			for (int c = 0; c < 3; ++c) {
+				const auto p0 = soa_load(batch.mPosition[0][c]);
+				t[c] = p0 + (soa_load(batch.mPosition[1][c]) - p0) * pf;
+				const auto s0 = soa_load(batch.mScaling[0][c]);
+				s[c] = s0 + (soa_load(batch.mScaling[1][c]) - s0) * sf;
+			}
+
+			// Interpolate rotations along the shorter arc, with a normalized lerp whose factor is corrected s.t. it approximates slerp
+			// (the correction is the polynomial fit from Arseny Kapoulkine's "Approximating slerp"):
+			soa_lanes q0[4], q1[4];
+			for (int c = 0; c < 4; ++c) {
+				q0[c] = soa_load(batch.mRotation[0][c]);
+				q1[c] = soa_load(batch.mRotation[1][c]);
+			}
+			const auto cosTheta = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+			const auto d = soa_abs(cosTheta);
+			const auto rf = soa_load(batch.mRotationFactor);
+			const auto a = soa_set1(1.0904f) + d * (soa_set1(-3.2452f) + d * (soa_set1(3.55645f) - d * soa_set1(1.43519f)));
+			const auto b = soa_set1(0.848013f) + d * (soa_set1(-1.06021f) + d * soa_set1(0.215638f));
+			const auto half = soa_set1(0.5f);
+			const auto k = a * (rf - half) * (rf - half) + b;
+			const auto correctedFactor = rf + rf * (rf - half) * (rf - one) * k;
+			const auto w1 = correctedFactor * soa_sign(cosTheta);
+			const auto w0 = one - correctedFactor;
+			soa_lanes q[4];
+			for (int c = 0; c < 4; ++c) {
+				q[c] = q0[c] * w0 + q1[c] * w1;
+			}
+			const auto invLength = one / soa_sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+			for (int c = 0; c < 4; ++c) {
+				q[c] = q[c] * invLength;
+			}
+
+			// Compose translation * rotation * scaling, like matrix_from_transforms:
+			const auto two = soa_set1(2.0f);
+			const auto xx = q[0] * q[0], yy = q[1] * q[1], zz = q[2] * q[2];
+			const auto xy = q[0] * q[1], xz = q[0] * q[2], yz = q[1] * q[2];
+			const auto wx = q[3] * q[0], wy = q[3] * q[1], wz = q[3] * q[2];
+			soa_store(batch.mMatrix[0][0], (one - two * (yy + zz)) * s[0]);
+			soa_store(batch.mMatrix[0][1], two * (xy + wz) * s[0]);
+			soa_store(batch.mMatrix[0][2], two * (xz - wy) * s[0]);
+			soa_store(batch.mMatrix[1][0], two * (xy - wz) * s[1]);
+			soa_store(batch.mMatrix[1][1], (one - two * (xx + zz)) * s[1]);
+			soa_store(batch.mMatrix[1][2], two * (yz + wx) * s[1]);
+			soa_store(batch.mMatrix[2][0], two * (xz + wy) * s[2]);
+			soa_store(batch.mMatrix[2][1], two * (yz - wx) * s[2]);
+			soa_store(batch.mMatrix[2][2], (one - two * (xx + yy)) * s[2]);
+			soa_store(batch.mMatrix[3][0], t[0]);
+			soa_store(batch.mMatrix[3][1], t[1]);
+			soa_store(batch.mMatrix[3][2], t[2]);
+
+			// Scatter the matrices to their nodes:
+			for (size_t lane = 0; lane < numLanes; ++lane) {
+				auto& m = aLocalTransforms[mDynamicNodes[first + lane]];
+				for (int col = 0; col < 4; ++col) {
+					m[col] = glm::vec4{ batch.mMatrix[col][0][lane], batch.mMatrix[col][1][lane], batch.mMatrix[col][2][lane], 3 == col ? 1.0f : 0.0f };
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,25 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	bool load_progress_handler::Update(float aPercentage)
+	{
+		// Assimp passes a negative value if it can not estimate the progress; report the last known value then:
+		if (aPercentage >= 0.0f) {
+			mLastProgress = std::min(aPercentage, 1.0f);
+		}
+		if (!mCallback(mLastProgress)) {
+			mCancelled = true;
+		}
+		return !mCancelled;
+	}
+
+	bool async_load_state::report(float aProgress)
+	{
+		mProgress = aProgress;
+		if (mOnProgress) {
+			mOnProgress(aProgress);
+		}
+		return !mCancellationRequested;
+	}
+}
@@ -0,0 +1,299 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Splits an affine matrix without shear into translation, rotation, and scaling, s.t. `matrix_from_transforms` restores it */
+	static void decompose_local_transform(const glm::mat4& aMatrix, glm::vec3& aTranslation, glm::quat& aRotation, glm::vec3& aScaling)
+	{
+		aTranslation = glm::vec3(aMatrix[3]);
+		aScaling = glm::vec3(glm::length(glm::vec3(aMatrix[0])), glm::length(glm::vec3(aMatrix[1])), glm::length(glm::vec3(aMatrix[2])));
+		// A mirroring is expressed by a negative scaling along x:
+		if (glm::determinant(glm::mat3(aMatrix)) < 0.0f) {
+			aScaling.x = -aScaling.x;
+		}
+		const auto safe = [](float bScale) { return std::abs(bScale) > std::numeric_limits<float>::min() ? bScale : 1.0f; };
+		const glm::mat3 rotationMatrix(
+			glm::vec3(aMatrix[0]) / safe(aScaling.x),
+			glm::vec3(aMatrix[1]) / safe(aScaling.y),
+			glm::vec3(aMatrix[2]) / safe(aScaling.z)
+		);
+		aRotation = glm::normalize(glm::quat_cast(rotationMatrix));
+	}
+
+	/** Inverse of the conversion which `convert_to_half` performs */
+	static float half_to_float(uint16_t aHalf)
+	{
+		const uint32_t sign = static_cast<uint32_t>(aHalf & 0x8000u) << 16;
+		const uint32_t exponent = (aHalf >> 10) & 0x1Fu;
+		const uint32_t mantissa = aHalf & 0x3FFu;
+		if (0 == exponent) {
+			// Zero or subnormal:
+			const float value = std::ldexp(static_cast<float>(mantissa), -24);
+			return 0 != sign ? -value : value;
+		}
+		uint32_t bits;
+		if (0x1Fu == exponent) {
+			bits = sign | 0x7F800000u | (mantissa << 13);
+		}
+		else {
+			bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+		}
+		float result;
+		std::memcpy(&result, &bits, sizeof(float));
+		return result;
+	}
+
+	baked_animation_clip baked_animation_clip::bake(const animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_pose_format aFormat, bone_matrices_space aTargetSpace)
+	{
+		if (!(aFramesPerSecond > 0.0)) {
+			throw gvk::logic_error("The frame rate for baking an animation clip must be greater than 0.");
+		}
+		if (aClip.mAnimationIndex != aAnimation.animation_index()) {
+			throw gvk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+		}
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw gvk::runtime_error("Unknown target space value.");
+		}
+
+		baked_animation_clip result;
+		result.mFormat = aFormat;
+		result.mTargetSpace = aTargetSpace;
+		result.mAnimationIndex = aClip.mAnimationIndex;
+		result.mTicksPerSecond = aClip.mTicksPerSecond;
+		result.mStartTime = aClip.start_time();
+		result.mDuration = std::max(aClip.end_time() - result.mStartTime, 0.0);
+		if (result.mDuration > 0.0) {
+			result.mNumFrames = std::max(static_cast<size_t>(std::ceil(result.mDuration * aFramesPerSecond)) + 1, size_t{ 2 });
+			result.mFramesPerSecond = static_cast<double>(result.mNumFrames - 1) / result.mDuration;
+		}
+		else {
+			result.mNumFrames = 1;
+			result.mFramesPerSecond = aFramesPerSecond;
+		}
+
+		const auto numFrames = result.mNumFrames;
+		const auto frameTime = [&result](size_t bFrame) {
+			return result.mStartTime + (result.mNumFrames > 1 ? result.mDuration * static_cast<double>(bFrame) / static_cast<double>(result.mNumFrames - 1) : 0.0);
+		};
+		std::vector<size_t> frames(numFrames);
+		std::iota(std::begin(frames), std::end(frames), size_t{ 0 });
+
+		switch (aFormat) {
+		case baked_pose_format::bone_matrices:
+		{
+			result.mPoseSize = aAnimation.number_of_bone_matrices();
+			if (0 == result.mPoseSize) {
+				throw gvk::logic_error("The animation has no bone matrices. Bake only animations which have been created with model_t::prepare_animation.");
+			}
+			result.mBoneMatrices.resize(numFrames * result.mPoseSize);
+			std::for_each(std::execution::par, std::begin(frames), std::end(frames), [&](size_t f) {
+				animation_playback_state state(aAnimation);
+				aAnimation.animate_into_single_target_buffer(state, aClip, frameTime(f), aTargetSpace, result.mBoneMatrices.data() + f * result.mPoseSize);
+			});
+			break;
+		}
+		case baked_pose_format::local_transforms:
+		{
+			if (aClip.mTicksPerSecond == 0.0) {
+				throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+			}
+			const auto poseSize = aAnimation.number_of_animated_nodes();
+			result.mPoseSize = poseSize;
+			result.mTranslations.resize(numFrames * poseSize);
+			result.mRotations.resize(numFrames * poseSize);
+			result.mScalings.resize(numFrames * poseSize);
+			std::for_each(std::execution::par, std::begin(frames), std::end(frames), [&](size_t f) {
+				animation_playback_state state(aAnimation);
+				aAnimation.evaluate_local_transforms(state, frameTime(f) * aClip.mTicksPerSecond);
+				for (size_t n = 0; n < poseSize; ++n) {
+					const auto i = f * poseSize + n;
+					decompose_local_transform(state.local_transform(n), result.mTranslations[i], result.mRotations[i], result.mScalings[i]);
+				}
+			});
+			// Keep every node's rotations in the same hemisphere from frame to frame, s.t. neighbouring frames can be interpolated directly:
+			for (size_t f = 1; f < numFrames; ++f) {
+				for (size_t n = 0; n < poseSize; ++n) {
+					auto& rotation = result.mRotations[f * poseSize + n];
+					if (glm::dot(rotation, result.mRotations[(f - 1) * poseSize + n]) < 0.0f) {
+						rotation = -rotation;
+					}
+				}
+			}
+			break;
+		}
+		default:
+			throw gvk::runtime_error("Unknown baked_pose_format value.");
+		}
+
+		LOG_INFO(fmt::format("Baked animation clip of {:.3f} seconds into {} frames at {:.2f} frames per second, occupying {} bytes.",
+			result.mDuration, result.mNumFrames, result.mFramesPerSecond, result.size_in_bytes()));
+		return result;
+	}
+
+	size_t baked_animation_clip::size_in_bytes() const
+	{
+		return mTranslations.size() * sizeof(glm::vec3)
+			+ mRotations.size() * sizeof(glm::quat)
+			+ mScalings.size() * sizeof(glm::vec3)
+			+ mBoneMatrices.size() * sizeof(glm::mat4);
+	}
+
+	std::tuple<size_t, size_t, float> baked_animation_clip::frame_position(double aTime) const
+	{
+		if (mNumFrames < 2) {
+			return std::make_tuple(size_t{ 0 }, size_t{ 0 }, 0.0f);
+		}
+		auto relativeTime = aTime - mStartTime;
+		if (mLooping) {
+			relativeTime = std::fmod(relativeTime, mDuration);
+			if (relativeTime < 0.0) {
+				relativeTime += mDuration;
+			}
+		}
+		else {
+			relativeTime = std::clamp(relativeTime, 0.0, mDuration);
+		}
+		const auto lastFrame = mNumFrames - 1;
+		const auto position = relativeTime / mDuration * static_cast<double>(lastFrame);
+		const auto frame0 = std::min(static_cast<size_t>(position), lastFrame);
+		const auto frame1 = std::min(frame0 + 1, lastFrame);
+		return std::make_tuple(frame0, frame1, static_cast<float>(std::clamp(position - static_cast<double>(frame0), 0.0, 1.0)));
+	}
+
+	void baked_animation_clip::sample_bone_matrices(double aTime, glm::mat4* aTargetMemory, bool aInterpolate) const
+	{
+		if (baked_pose_format::bone_matrices != mFormat) {
+			throw gvk::logic_error("The baked animation clip does not contain bone matrices.");
+		}
+		const auto [frame0, frame1, factor] = frame_position(aTime);
+		const auto* m0 = mBoneMatrices.data() + frame0 * mPoseSize;
+		const auto* m1 = mBoneMatrices.data() + frame1 * mPoseSize;
+		if (!aInterpolate || frame0 == frame1) {
+			const auto* nearest = factor < 0.5f ? m0 : m1;
+			std::copy(nearest, nearest + mPoseSize, aTargetMemory);
+			return;
+		}
+		for (size_t i = 0; i < mPoseSize; ++i) {
+			aTargetMemory[i] = m0[i] + (m1[i] - m0[i]) * factor;
+		}
+	}
+
+	void baked_animation_clip::sample_local_transforms(double aTime, std::span<glm::mat4> aLocalTransforms, bool aInterpolate) const
+	{
+		if (baked_pose_format::local_transforms != mFormat) {
+			throw gvk::logic_error("The baked animation clip does not contain local transforms.");
+		}
+		if (aLocalTransforms.size() < mPoseSize) {
+			throw gvk::logic_error(fmt::format("The baked animation clip has {} animated nodes, but only {} local transforms can be written.", mPoseSize, aLocalTransforms.size()));
+		}
+		auto [frame0, frame1, factor] = frame_position(aTime);
+		if (!aInterpolate) {
+			frame0 = factor < 0.5f ? frame0 : frame1;
+			frame1 = frame0;
+		}
+		const auto o0 = frame0 * mPoseSize;
+		const auto o1 = frame1 * mPoseSize;
+		if (frame0 == frame1) {
+			for (size_t n = 0; n < mPoseSize; ++n) {
+				aLocalTransforms[n] = matrix_from_transforms(mTranslations[o0 + n], mRotations[o0 + n], mScalings[o0 + n]);
+			}
+			return;
+		}
+		for (size_t n = 0; n < mPoseSize; ++n) {
+			const auto translation = glm::mix(mTranslations[o0 + n], mTranslations[o1 + n], factor);
+			const auto scaling = glm::mix(mScalings[o0 + n], mScalings[o1 + n], factor);
+			// Neighbouring frames are close to each other, hence nlerp is a sufficient approximation of slerp.
+			// Frames are stored in the same hemisphere, except when a looping clip wraps around; hence, the sign is checked:
+			const auto& r0 = mRotations[o0 + n];
+			const auto r1 = glm::dot(r0, mRotations[o1 + n]) < 0.0f ? -mRotations[o1 + n] : mRotations[o1 + n];
+			const auto rotation = glm::normalize(r0 * (1.0f - factor) + r1 * factor);
+			aLocalTransforms[n] = matrix_from_transforms(translation, rotation, scaling);
+		}
+	}
+
+	baked_animation_error measure_baking_error(const animation& aAnimation, const animation_clip_data& aClip, const baked_animation_clip& aBakedClip, size_t aSamplesPerFrame, bool aInterpolate)
+	{
+		const auto paletteSize = aAnimation.number_of_bone_matrices();
+		std::vector<glm::mat4> exact(paletteSize);
+		std::vector<glm::mat4> baked(paletteSize);
+		animation_playback_state exactState(aAnimation);
+		animation_playback_state bakedState(aAnimation);
+
+		baked_animation_error result;
+		double sumOfSquares = 0.0;
+		size_t numValues = 0;
+		const auto numSteps = std::max(aBakedClip.mNumFrames - 1, size_t{ 1 }) * std::max(aSamplesPerFrame, size_t{ 1 });
+		// Stay within [start, end) of the clip, where looping and clamping playback agree:
+		for (size_t s = 0; s < numSteps; ++s) {
+			const auto time = aBakedClip.mStartTime + aBakedClip.mDuration * (static_cast<double>(s) + 0.5) / static_cast<double>(numSteps);
+			aAnimation.animate_into_single_target_buffer(exactState, aClip, time, aBakedClip.mTargetSpace, exact.data());
+			aAnimation.animate_into_single_target_buffer(bakedState, aBakedClip, time, aBakedClip.mTargetSpace, baked.data(), aInterpolate);
+			for (size_t i = 0; i < paletteSize; ++i) {
+				for (glm::length_t c = 0; c < 4; ++c) {
+					for (glm::length_t r = 0; r < 4; ++r) {
+						const auto d = std::abs(exact[i][c][r] - baked[i][c][r]);
+						result.mMaxError = std::max(result.mMaxError, d);
+						sumOfSquares += static_cast<double>(d) * static_cast<double>(d);
+					}
+				}
+			}
+			numValues += paletteSize * 16;
+			++result.mNumSamples;
+		}
+		result.mRmsError = numValues > 0 ? static_cast<float>(std::sqrt(sumOfSquares / static_cast<double>(numValues))) : 0.0f;
+
+		LOG_INFO(fmt::format("Baked animation clip with {} frames ({} bytes) deviates by at most {:.6f} (RMS {:.6f}) from the exact evaluation at {} points in time.",
+			aBakedClip.mNumFrames, aBakedClip.size_in_bytes(), result.mMaxError, result.mRmsError, result.mNumSamples));
+		return result;
+	}
+
+	baked_palette_gpu_data export_baked_palettes(const baked_animation_clip& aBakedClip, baked_palette_precision aPrecision)
+	{
+		if (baked_pose_format::bone_matrices != aBakedClip.mFormat) {
+			throw gvk::logic_error("Only animation clips which have been baked into bone matrices can be exported as palettes.");
+		}
+
+		baked_palette_gpu_data result;
+		result.mWidth = static_cast<uint32_t>(3 * aBakedClip.mPoseSize);
+		result.mHeight = static_cast<uint32_t>(aBakedClip.mNumFrames);
+		result.mFramesPerSecond = aBakedClip.mFramesPerSecond;
+		result.mPrecision = aPrecision;
+
+		// Gather the first three rows of every matrix (glm matrices are column-major):
+		std::vector<float> rows(static_cast<size_t>(result.mWidth) * result.mHeight * 4);
+		for (size_t i = 0; i < aBakedClip.mBoneMatrices.size(); ++i) {
+			const auto& m = aBakedClip.mBoneMatrices[i];
+			for (glm::length_t r = 0; r < 3; ++r) {
+				auto* texel = rows.data() + (i * 3 + r) * 4;
+				texel[0] = m[0][r];
+				texel[1] = m[1][r];
+				texel[2] = m[2][r];
+				texel[3] = m[3][r];
+			}
+		}
+
+		switch (aPrecision) {
+		case baked_palette_precision::float32:
+			result.mData.resize(rows.size() * sizeof(float));
+			std::memcpy(result.mData.data(), rows.data(), result.mData.size());
+			break;
+		case baked_palette_precision::float16:
+		{
+			std::vector<uint16_t> halfs(rows.size());
+			convert_to_half(rows.data(), halfs.data(), rows.size());
+			for (size_t i = 0; i < rows.size(); ++i) {
+				result.mMaxQuantizationError = std::max(result.mMaxQuantizationError, std::abs(half_to_float(halfs[i]) - rows[i]));
+			}
+			result.mData.resize(halfs.size() * sizeof(uint16_t));
+			std::memcpy(result.mData.data(), halfs.data(), result.mData.size());
+			break;
+		}
+		default:
+			throw gvk::runtime_error("Unknown baked_palette_precision value.");
+		}
+
+		LOG_INFO(fmt::format("Exported {} baked frames of {} bone matrices as a {}x{} texel layout of {} bytes ({} bytes as full 4x4 matrices), with a quantization error of at most {:.6f}.",
+			result.mHeight, aBakedClip.mPoseSize, result.mWidth, result.mHeight, result.size_in_bytes(), aBakedClip.mBoneMatrices.size() * sizeof(glm::mat4), result.mMaxQuantizationError));
+		return result;
+	}
+}
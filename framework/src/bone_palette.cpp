@@ -0,0 +1,98 @@
+#include <gvk.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GVK_BONE_PALETTE_SSE2
+#endif
+
+namespace gvk
+{
+	/** Writes the first three rows of the given matrix, followed by (0, 0, 0, 1), into aRows */
+	static void transpose_affine(const glm::mat4& aMatrix, float* aRows)
+	{
+#if defined(GVK_BONE_PALETTE_SSE2)
+		__m128 c0 = _mm_loadu_ps(&aMatrix[0][0]);
+		__m128 c1 = _mm_loadu_ps(&aMatrix[1][0]);
+		__m128 c2 = _mm_loadu_ps(&aMatrix[2][0]);
+		__m128 c3 = _mm_loadu_ps(&aMatrix[3][0]);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		_mm_storeu_ps(aRows + 0, c0);
+		_mm_storeu_ps(aRows + 4, c1);
+		_mm_storeu_ps(aRows + 8, c2);
+		_mm_storeu_ps(aRows + 12, c3);
+#else
+		for (glm::length_t r = 0; r < 4; ++r) {
+			for (glm::length_t c = 0; c < 4; ++c) {
+				aRows[r * 4 + c] = aMatrix[c][r];
+			}
+		}
+#endif
+	}
+
+	bool is_representable_in_bone_palette(const glm::mat4& aBoneMatrix, bone_palette_format aFormat)
+	{
+		if (bone_palette_format::dual_quaternion != aFormat && bone_palette_format::dual_quaternion_half != aFormat) {
+			return true;
+		}
+		// Only rotations (and translations) can be represented, i.e. the columns must be orthonormal and right-handed:
+		const glm::mat3 rotation(aBoneMatrix);
+		constexpr float tolerance = 1e-3f;
+		const auto lengths = glm::vec3(glm::dot(rotation[0], rotation[0]), glm::dot(rotation[1], rotation[1]), glm::dot(rotation[2], rotation[2]));
+		return !glm::any(glm::greaterThan(glm::abs(lengths - glm::vec3{ 1.0f }), glm::vec3{ tolerance })) && glm::determinant(rotation) >= 0.0f;
+	}
+
+	/** Writes the real part (x, y, z, w) and the dual part (x, y, z, w) of the rigid transformation aMatrix into aValues */
+	static void to_dual_quaternion(const glm::mat4& aMatrix, float* aValues)
+	{
+		if (!is_representable_in_bone_palette(aMatrix, bone_palette_format::dual_quaternion)) {
+			throw gvk::runtime_error("The bone matrix contains scaling or mirroring, which a dual quaternion cannot represent. Use bone_palette_format::affine_3x4 instead.");
+		}
+
+		const glm::mat3 rotation(aMatrix);
+		auto real = glm::normalize(glm::quat_cast(rotation));
+		if (real.w < 0.0f) {
+			real = -real;
+		}
+		const auto dual = glm::quat(0.0f, glm::vec3(aMatrix[3])) * real * 0.5f;
+		aValues[0] = real.x;
+		aValues[1] = real.y;
+		aValues[2] = real.z;
+		aValues[3] = real.w;
+		aValues[4] = dual.x;
+		aValues[5] = dual.y;
+		aValues[6] = dual.z;
+		aValues[7] = dual.w;
+	}
+
+	void write_bone_palette_entry(const glm::mat4& aBoneMatrix, bone_palette_format aFormat, void* aTarget)
+	{
+		// Convert 16 values at a time, s.t. convert_to_half can use SSE2 throughout; only the actual entry is copied out:
+		alignas(16) float values[16];
+		alignas(16) uint16_t halfs[16];
+		switch (aFormat) {
+		case bone_palette_format::mat4:
+			std::memcpy(aTarget, &aBoneMatrix, sizeof(glm::mat4));
+			break;
+		case bone_palette_format::affine_3x4:
+			transpose_affine(aBoneMatrix, values);
+			std::memcpy(aTarget, values, 12 * sizeof(float));
+			break;
+		case bone_palette_format::affine_3x4_half:
+			transpose_affine(aBoneMatrix, values);
+			convert_to_half(values, halfs, 16);
+			std::memcpy(aTarget, halfs, 12 * sizeof(uint16_t));
+			break;
+		case bone_palette_format::dual_quaternion:
+			to_dual_quaternion(aBoneMatrix, values);
+			std::memcpy(aTarget, values, 8 * sizeof(float));
+			break;
+		case bone_palette_format::dual_quaternion_half:
+			to_dual_quaternion(aBoneMatrix, values);
+			convert_to_half(values, halfs, 8);
+			std::memcpy(aTarget, halfs, 8 * sizeof(uint16_t));
+			break;
+		default:
+			throw gvk::runtime_error("Unknown bone_palette_format value.");
+		}
+	}
+}
@@ -0,0 +1,160 @@
+#include <gvk.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GVK_BOUNDING_VOLUMES_SSE2
+#endif
+
+namespace gvk
+{
+	bounding_box bounding_box::transformed(const glm::mat4& aMatrix) const
+	{
+		if (is_empty()) {
+			return *this;
+		}
+		// Arvo's method: the transformed box is spanned by the translation plus the per-axis minima and maxima of the columns' contributions.
+		bounding_box result{ glm::vec3{ aMatrix[3] }, glm::vec3{ aMatrix[3] } };
+		for (int c = 0; c < 3; ++c) {
+			const auto a = glm::vec3{ aMatrix[c] } * mMin[c];
+			const auto b = glm::vec3{ aMatrix[c] } * mMax[c];
+			result.mMin += glm::min(a, b);
+			result.mMax += glm::max(a, b);
+		}
+		return result;
+	}
+
+	bounding_sphere bounding_sphere::merged(const bounding_sphere& aOther) const
+	{
+		if (aOther.is_empty()) {
+			return *this;
+		}
+		if (is_empty()) {
+			return aOther;
+		}
+		const auto d = aOther.mCenter - mCenter;
+		const float dist = glm::length(d);
+		if (dist + aOther.mRadius <= mRadius) {
+			return *this;
+		}
+		if (dist + mRadius <= aOther.mRadius) {
+			return aOther;
+		}
+		const float radius = (dist + mRadius + aOther.mRadius) * 0.5f;
+		return bounding_sphere{ mCenter + d * ((radius - mRadius) / dist), radius };
+	}
+
+	bounding_sphere bounding_sphere::transformed(const glm::mat4& aMatrix) const
+	{
+		if (is_empty()) {
+			return *this;
+		}
+		const float maxScale = std::max({ glm::length(glm::vec3{ aMatrix[0] }), glm::length(glm::vec3{ aMatrix[1] }), glm::length(glm::vec3{ aMatrix[2] }) });
+		return bounding_sphere{ glm::vec3{ aMatrix * glm::vec4{ mCenter, 1.0f } }, mRadius * maxScale };
+	}
+
+	bounding_box compute_bounding_box(const glm::vec3* aPositions, size_t aNumPositions)
+	{
+		static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+		bounding_box result;
+		const float* values = reinterpret_cast<const float*>(aPositions);
+		const size_t numValues = aNumPositions * 3;
+		size_t i = 0;
+
+#if defined(GVK_BOUNDING_VOLUMES_SSE2)
+		// Four positions are twelve floats, i.e. three registers with the component pattern xyzx, yzxy, zxyz:
+		if (numValues >= 12) {
+			__m128 min0 = _mm_loadu_ps(values), min1 = _mm_loadu_ps(values + 4), min2 = _mm_loadu_ps(values + 8);
+			__m128 max0 = min0, max1 = min1, max2 = min2;
+			for (i = 12; i + 12 <= numValues; i += 12) {
+				const __m128 v0 = _mm_loadu_ps(values + i);
+				const __m128 v1 = _mm_loadu_ps(values + i + 4);
+				const __m128 v2 = _mm_loadu_ps(values + i + 8);
+				min0 = _mm_min_ps(min0, v0); max0 = _mm_max_ps(max0, v0);
+				min1 = _mm_min_ps(min1, v1); max1 = _mm_max_ps(max1, v1);
+				min2 = _mm_min_ps(min2, v2); max2 = _mm_max_ps(max2, v2);
+			}
+			alignas(16) float mins[12];
+			alignas(16) float maxs[12];
+			_mm_store_ps(mins, min0); _mm_store_ps(mins + 4, min1); _mm_store_ps(mins + 8, min2);
+			_mm_store_ps(maxs, max0); _mm_store_ps(maxs + 4, max1); _mm_store_ps(maxs + 8, max2);
+			for (size_t k = 0; k < 12; ++k) {
+				result.mMin[k % 3] = std::min(result.mMin[k % 3], mins[k]);
+				result.mMax[k % 3] = std::max(result.mMax[k % 3], maxs[k]);
+			}
+		}
+#endif
+
+		for (; i < numValues; ++i) {
+			result.mMin[i % 3] = std::min(result.mMin[i % 3], values[i]);
+			result.mMax[i % 3] = std::max(result.mMax[i % 3], values[i]);
+		}
+		return result;
+	}
+
+	bounding_sphere compute_bounding_sphere(const glm::vec3* aPositions, size_t aNumPositions, const bounding_box& aBox)
+	{
+		if (0 == aNumPositions) {
+			return bounding_sphere{};
+		}
+
+		// Start with the most distant pair of the points which are extreme along the x, y, and z axes, respectively:
+		std::array<size_t, 3> minIndices{ 0, 0, 0 };
+		std::array<size_t, 3> maxIndices{ 0, 0, 0 };
+		for (size_t i = 1; i < aNumPositions; ++i) {
+			for (int c = 0; c < 3; ++c) {
+				if (aPositions[i][c] < aPositions[minIndices[c]][c]) { minIndices[c] = i; }
+				if (aPositions[i][c] > aPositions[maxIndices[c]][c]) { maxIndices[c] = i; }
+			}
+		}
+		int axis = 0;
+		float maxDistSq = -1.0f;
+		for (int c = 0; c < 3; ++c) {
+			const auto d = aPositions[maxIndices[c]] - aPositions[minIndices[c]];
+			const float distSq = glm::dot(d, d);
+			if (distSq > maxDistSq) {
+				maxDistSq = distSq;
+				axis = c;
+			}
+		}
+
+		glm::vec3 center = (aPositions[minIndices[axis]] + aPositions[maxIndices[axis]]) * 0.5f;
+		float radius = std::sqrt(maxDistSq) * 0.5f;
+		for (size_t i = 0; i < aNumPositions; ++i) {
+			const float dist = glm::length(aPositions[i] - center);
+			if (dist > radius) {
+				// Grow the sphere just enough to contain the point:
+				const float newRadius = (radius + dist) * 0.5f;
+				center += (aPositions[i] - center) * ((newRadius - radius) / dist);
+				radius = newRadius;
+			}
+		}
+
+		// Compensate for rounding errors while growing, so that the sphere is conservative:
+		radius *= 1.0f + 8.0f * std::numeric_limits<float>::epsilon();
+
+		// The sphere around the box might be the tighter one for box-like meshes:
+		const float boxRadius = glm::length(aBox.extent()) * 0.5f;
+		if (!aBox.is_empty() && boxRadius < radius) {
+			return bounding_sphere{ aBox.center(), boxRadius };
+		}
+		return bounding_sphere{ center, radius };
+	}
+
+	bounding_box merge_bounding_boxes(const std::vector<bounding_box>& aBoxes)
+	{
+		bounding_box result;
+		for (const auto& box : aBoxes) {
+			result = result.merged(box);
+		}
+		return result;
+	}
+
+	bounding_sphere merge_bounding_spheres(const std::vector<bounding_sphere>& aSpheres)
+	{
+		bounding_sphere result;
+		for (const auto& sphere : aSpheres) {
+			result = result.merged(sphere);
+		}
+		return result;
+	}
+}
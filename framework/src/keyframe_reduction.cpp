@@ -0,0 +1,114 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	keyframe_reduction_result& keyframe_reduction_result::operator+=(const keyframe_reduction_result& aOther)
+	{
+		mNumKeysBefore += aOther.mNumKeysBefore;
+		mNumKeysAfter += aOther.mNumKeysAfter;
+		mBytesBefore += aOther.mBytesBefore;
+		mBytesAfter += aOther.mBytesAfter;
+		mMaxPositionError = std::max(mMaxPositionError, aOther.mMaxPositionError);
+		mMaxRotationError = std::max(mMaxRotationError, aOther.mMaxRotationError);
+		mMaxScalingError = std::max(mMaxScalingError, aOther.mMaxScalingError);
+		return *this;
+	}
+
+	/** Angle between two rotations, which is also accurate for very small angles (unlike acos of their dot product) */
+	static float angle_between(const glm::quat& aFirst, const glm::quat& aSecond)
+	{
+		const auto d = glm::conjugate(aFirst) * aSecond;
+		return 2.0f * std::atan2(glm::length(glm::vec3(d.x, d.y, d.z)), std::abs(d.w));
+	}
+
+	/**	Removes the keys from aKeys which can be reconstructed within aTolerance, see `reduce_keyframes`.
+	 *	@param	aMaxKeysPerSegment	Maximum number of keys which one segment between two kept keys may span
+	 *	@param	aInterpolate		Interpolates between two values, called as (value, value, factor)
+	 *	@param	aError				Measures the deviation between two values
+	 *	@return	The largest deviation of any removed key
+	 */
+	template <typename K, typename I, typename E>
+	static float reduce_keys(std::vector<K>& aKeys, float aTolerance, size_t aMaxKeysPerSegment, I aInterpolate, E aError)
+	{
+		const auto n = aKeys.size();
+		if (n < 2) {
+			return 0.0f;
+		}
+
+		auto interpolate = [&](const K& bFirst, const K& bSecond, double bTime) {
+			const auto dt = bSecond.mTime - bFirst.mTime;
+			const auto factor = dt > 0.0 ? static_cast<float>((bTime - bFirst.mTime) / dt) : 0.0f;
+			return aInterpolate(bFirst.mValue, bSecond.mValue, factor);
+		};
+
+		// Collapse channels which do not change (within the tolerance) into one key:
+		float maxError = 0.0f;
+		for (size_t k = 1; k < n; ++k) {
+			maxError = std::max(maxError, aError(aKeys[0].mValue, aKeys[k].mValue));
+		}
+		if (maxError <= aTolerance) {
+			aKeys.resize(1);
+			return maxError;
+		}
+
+		// Extend every segment greedily for as long as all the keys in between are reconstructed within the tolerance.
+		// Every extension checks all the keys of the segment again => limit its length to keep the reduction linear in the number of keys:
+		const auto maxSpan = std::max(aMaxKeysPerSegment, size_t{ 2 }) - 1;
+		auto segmentReconstructs = [&](size_t bFirst, size_t bLast) {
+			for (size_t k = bFirst + 1; k < bLast; ++k) {
+				if (aError(interpolate(aKeys[bFirst], aKeys[bLast], aKeys[k].mTime), aKeys[k].mValue) > aTolerance) {
+					return false;
+				}
+			}
+			return true;
+		};
+		std::vector<size_t> kept{ 0 };
+		size_t anchor = 0;
+		for (size_t last = 2; last < n; ++last) {
+			if (last - anchor > maxSpan || !segmentReconstructs(anchor, last)) {
+				anchor = last - 1;
+				kept.push_back(anchor);
+			}
+		}
+		kept.push_back(n - 1);
+
+		maxError = 0.0f;
+		std::vector<K> result;
+		result.reserve(kept.size());
+		for (size_t s = 0; s < kept.size(); ++s) {
+			result.push_back(aKeys[kept[s]]);
+			if (s + 1 < kept.size()) {
+				for (size_t k = kept[s] + 1; k < kept[s + 1]; ++k) {
+					maxError = std::max(maxError, aError(interpolate(aKeys[kept[s]], aKeys[kept[s + 1]], aKeys[k].mTime), aKeys[k].mValue));
+				}
+			}
+		}
+		aKeys = std::move(result);
+		return maxError;
+	}
+
+	keyframe_reduction_result reduce_keyframes(animated_node_keys& aNode, const keyframe_reduction_config& aConfig)
+	{
+		keyframe_reduction_result result;
+		result.mNumKeysBefore = aNode.mPositionKeys.size() + aNode.mRotationKeys.size() + aNode.mScalingKeys.size();
+		result.mBytesBefore = aNode.mPositionKeys.size() * sizeof(position_key) + aNode.mRotationKeys.size() * sizeof(rotation_key) + aNode.mScalingKeys.size() * sizeof(scaling_key);
+
+		result.mMaxPositionError = reduce_keys(aNode.mPositionKeys, aConfig.mPositionTolerance, aConfig.mMaxKeysPerSegment,
+			[](const glm::vec3& bFirst, const glm::vec3& bSecond, float bFactor) { return glm::lerp(bFirst, bSecond, bFactor); },
+			[](const glm::vec3& bFirst, const glm::vec3& bSecond) { return glm::distance(bFirst, bSecond); }
+		);
+		// Interpolate like animation::animate does:
+		result.mMaxRotationError = reduce_keys(aNode.mRotationKeys, aConfig.mRotationTolerance, aConfig.mMaxKeysPerSegment,
+			[](const glm::quat& bFirst, const glm::quat& bSecond, float bFactor) { return glm::normalize(glm::slerp(bFirst, bSecond, bFactor)); },
+			[](const glm::quat& bFirst, const glm::quat& bSecond) { return angle_between(bFirst, bSecond); }
+		);
+		result.mMaxScalingError = reduce_keys(aNode.mScalingKeys, aConfig.mScalingTolerance, aConfig.mMaxKeysPerSegment,
+			[](const glm::vec3& bFirst, const glm::vec3& bSecond, float bFactor) { return glm::lerp(bFirst, bSecond, bFactor); },
+			[](const glm::vec3& bFirst, const glm::vec3& bSecond) { const auto d = glm::abs(bFirst - bSecond); return std::max(d.x, std::max(d.y, d.z)); }
+		);
+
+		result.mNumKeysAfter = aNode.mPositionKeys.size() + aNode.mRotationKeys.size() + aNode.mScalingKeys.size();
+		result.mBytesAfter = aNode.mPositionKeys.size() * sizeof(position_key) + aNode.mRotationKeys.size() * sizeof(rotation_key) + aNode.mScalingKeys.size() * sizeof(scaling_key);
+		return result;
+	}
+}
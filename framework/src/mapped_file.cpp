@@ -0,0 +1,119 @@
+#include <gvk.hpp>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace gvk
+{
+	mapped_file::mapped_file(mapped_file&& aOther) noexcept
+		: mPath{ std::move(aOther.mPath) }
+		, mData{ std::exchange(aOther.mData, nullptr) }
+		, mSize{ std::exchange(aOther.mSize, 0) }
+#ifdef _WIN32
+		, mFile{ std::exchange(aOther.mFile, INVALID_HANDLE_VALUE) }
+		, mMapping{ std::exchange(aOther.mMapping, nullptr) }
+#endif
+	{
+	}
+
+	mapped_file& mapped_file::operator=(mapped_file&& aOther) noexcept
+	{
+		if (this != &aOther) {
+			unmap();
+			mPath = std::move(aOther.mPath);
+			mData = std::exchange(aOther.mData, nullptr);
+			mSize = std::exchange(aOther.mSize, 0);
+#ifdef _WIN32
+			mFile = std::exchange(aOther.mFile, INVALID_HANDLE_VALUE);
+			mMapping = std::exchange(aOther.mMapping, nullptr);
+#endif
+		}
+		return *this;
+	}
+
+	mapped_file::~mapped_file()
+	{
+		unmap();
+	}
+
+	mapped_file mapped_file::map(const std::string& aPath)
+	{
+		mapped_file result;
+		result.mPath = aPath;
+
+#ifdef _WIN32
+		result.mFile = CreateFileA(aPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (INVALID_HANDLE_VALUE == result.mFile) {
+			throw gvk::runtime_error(fmt::format("Could not open file '{}' for mapping it into memory.", aPath));
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(result.mFile, &fileSize)) {
+			throw gvk::runtime_error(fmt::format("Could not determine the size of file '{}'.", aPath));
+		}
+		result.mSize = static_cast<size_t>(fileSize.QuadPart);
+		if (0 == result.mSize) {
+			// Empty files can not be mapped, but there is nothing to map anyways:
+			return result;
+		}
+		result.mMapping = CreateFileMappingA(result.mFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (nullptr == result.mMapping) {
+			throw gvk::runtime_error(fmt::format("Could not create a file mapping for file '{}'.", aPath));
+		}
+		result.mData = static_cast<std::byte*>(MapViewOfFile(result.mMapping, FILE_MAP_COPY, 0, 0, 0));
+		if (nullptr == result.mData) {
+			throw gvk::runtime_error(fmt::format("Could not map a view of file '{}'.", aPath));
+		}
+#else
+		const int fd = open(aPath.c_str(), O_RDONLY);
+		if (fd < 0) {
+			throw gvk::runtime_error(fmt::format("Could not open file '{}' for mapping it into memory.", aPath));
+		}
+		struct stat fileStat;
+		if (0 != fstat(fd, &fileStat)) {
+			close(fd);
+			throw gvk::runtime_error(fmt::format("Could not determine the size of file '{}'.", aPath));
+		}
+		result.mSize = static_cast<size_t>(fileStat.st_size);
+		if (0 == result.mSize) {
+			close(fd);
+			return result;
+		}
+		void* mapped = mmap(nullptr, result.mSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		close(fd); // The mapping keeps its own reference to the file
+		if (MAP_FAILED == mapped) {
+			result.mSize = 0;
+			throw gvk::runtime_error(fmt::format("Could not map file '{}' into memory.", aPath));
+		}
+		result.mData = static_cast<std::byte*>(mapped);
+#endif
+
+		return result;
+	}
+
+	void mapped_file::unmap()
+	{
+#ifdef _WIN32
+		if (nullptr != mData) {
+			UnmapViewOfFile(mData);
+		}
+		if (nullptr != mMapping) {
+			CloseHandle(mMapping);
+			mMapping = nullptr;
+		}
+		if (INVALID_HANDLE_VALUE != mFile) {
+			CloseHandle(mFile);
+			mFile = INVALID_HANDLE_VALUE;
+		}
+#else
+		if (nullptr != mData) {
+			munmap(mData, mSize);
+		}
+#endif
+		mData = nullptr;
+		mSize = 0;
+	}
+}
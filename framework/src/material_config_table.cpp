@@ -0,0 +1,129 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Gets pointers to all the texture paths of the given config, in the order of `mDiffuseTex` through `mExtraTex` */
+	static std::array<const std::string*, material_config_num_textures> texture_paths_of(const material_config& aConfig)
+	{
+		return {
+			&aConfig.mDiffuseTex, &aConfig.mSpecularTex, &aConfig.mAmbientTex, &aConfig.mEmissiveTex,
+			&aConfig.mHeightTex, &aConfig.mNormalsTex, &aConfig.mShininessTex, &aConfig.mOpacityTex,
+			&aConfig.mDisplacementTex, &aConfig.mReflectionTex, &aConfig.mLightmapTex, &aConfig.mExtraTex
+		};
+	}
+
+	/** Hashes the same fields as `std::hash<material_config>`, but the texture paths' IDs instead of the strings */
+	static size_t hash_of(const material_config& aConfig, const std::array<texture_path_id, material_config_num_textures>& aTexturePathIds)
+	{
+		const auto& o = aConfig;
+		std::size_t h = 0;
+		avk::hash_combine(h,
+			o.mDiffuseReflectivity,
+			o.mAmbientReflectivity,
+			o.mSpecularReflectivity,
+			o.mEmissiveColor,
+			o.mTransparentColor,
+			o.mReflectiveColor,
+			o.mAlbedo,
+			o.mOpacity,
+			o.mBumpScaling,
+			o.mShininess,
+			o.mShininessStrength,
+			o.mRefractionIndex,
+			o.mReflectivity,
+			o.mMetallic,
+			o.mSmoothness,
+			o.mSheen,
+			o.mThickness,
+			o.mRoughness,
+			o.mAnisotropy,
+			o.mAnisotropyRotation,
+			o.mCustomData,
+			o.mDiffuseTexOffsetTiling,
+			o.mSpecularTexOffsetTiling,
+			o.mAmbientTexOffsetTiling,
+			o.mEmissiveTexOffsetTiling,
+			o.mHeightTexOffsetTiling,
+			o.mNormalsTexOffsetTiling,
+			o.mShininessTexOffsetTiling,
+			o.mOpacityTexOffsetTiling,
+			o.mDisplacementTexOffsetTiling,
+			o.mReflectionTexOffsetTiling,
+			o.mLightmapTexOffsetTiling,
+			o.mExtraTexOffsetTiling,
+			o.mIgnoreCpuOnlyDataForEquality
+		);
+		for (auto id : aTexturePathIds) {
+			avk::hash_combine(h, id);
+		}
+		if (!o.mIgnoreCpuOnlyDataForEquality) {
+			avk::hash_combine(h,
+				o.mShadingModel,
+				o.mWireframeMode,
+				o.mTwosided,
+				o.mBlendMode
+			);
+		}
+		return h;
+	}
+
+	material_config_table::material_config_table()
+	{
+		intern_texture_path("");
+	}
+
+	texture_path_id material_config_table::intern_texture_path(const std::string& aPath)
+	{
+		const auto it = mTexturePathIds.find(aPath);
+		if (std::end(mTexturePathIds) != it) {
+			return it->second;
+		}
+		const auto id = static_cast<texture_path_id>(mTexturePaths.size());
+		mTexturePaths.push_back(aPath);
+		mTexturePathIds.emplace(aPath, id);
+		return id;
+	}
+
+	material_id material_config_table::intern(const material_config& aConfig)
+	{
+		std::array<texture_path_id, material_config_num_textures> texturePathIds;
+		const auto texturePaths = texture_paths_of(aConfig);
+		for (size_t t = 0; t < material_config_num_textures; ++t) {
+			texturePathIds[t] = intern_texture_path(*texturePaths[t]);
+		}
+		const auto h = hash_of(aConfig, texturePathIds);
+
+		// Configs are only considered equal if they agree on mIgnoreCpuOnlyDataForEquality, otherwise operator== would not be transitive:
+		const auto [first, last] = mIdsByHash.equal_range(h);
+		for (auto it = first; it != last; ++it) {
+			const auto& candidate = mEntries[it->second];
+			if (candidate.mTexturePathIds == texturePathIds
+				&& candidate.mConfig.mIgnoreCpuOnlyDataForEquality == aConfig.mIgnoreCpuOnlyDataForEquality
+				&& candidate.mConfig == aConfig) {
+				return it->second;
+			}
+		}
+
+		const auto id = static_cast<material_id>(mEntries.size());
+		mEntries.push_back(entry{ aConfig, h, texturePathIds });
+		mIdsByHash.emplace(h, id);
+		return id;
+	}
+
+	std::vector<std::vector<size_t>> group_by_material_id(const std::vector<material_id>& aMaterialIds, size_t aNumMaterialIds)
+	{
+		std::vector<size_t> counts(aNumMaterialIds, 0);
+		for (auto id : aMaterialIds) {
+			assert(id < aNumMaterialIds);
+			++counts[id];
+		}
+		std::vector<std::vector<size_t>> result(aNumMaterialIds);
+		for (size_t id = 0; id < aNumMaterialIds; ++id) {
+			result[id].reserve(counts[id]);
+		}
+		for (size_t i = 0; i < aMaterialIds.size(); ++i) {
+			result[aMaterialIds[i]].push_back(i);
+		}
+		return result;
+	}
+}
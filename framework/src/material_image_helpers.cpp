@@ -334,36 +334,46 @@ namespace gvk
 			aSerializer);
 	}
 
-	static inline void fill_device_buffer_cached(gvk::serializer& aSerializer, avk::buffer& aDeviceBuffer, size_t aTotalSize, avk::sync& aSyncHandler)
+	static inline avk::buffer create_staging_buffer(size_t aTotalSize)
 	{
-		// Create host visible staging buffer for filling on host side from file
-		auto sb = context().create_buffer(
+		// Create host visible staging buffer for filling on host side
+		return context().create_buffer(
 			AVK_STAGING_BUFFER_MEMORY_USAGE,
 			vk::BufferUsageFlagBits::eTransferSrc,
 			avk::generic_buffer_meta::create_from_size(aTotalSize)
 		);
-		// Let the serializer map and fill the buffer
-		aSerializer.archive_buffer(sb);
+	}
 
+	static inline void copy_staging_buffer_to_device_buffer(avk::buffer aStagingBuffer, avk::buffer& aDeviceBuffer, size_t aTotalSize, avk::sync& aSyncHandler)
+	{
 		auto& commandBuffer = aSyncHandler.get_or_create_command_buffer();
 		// Sync before
 		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{ avk::memory_access::transfer_read_access });
 
 		// Copy host visible staging buffer to device buffer
-		avk::copy_buffer_to_another(avk::referenced(sb), avk::referenced(aDeviceBuffer), 0, 0, aTotalSize, avk::sync::with_barriers_into_existing_command_buffer(commandBuffer, {}, {}));
+		avk::copy_buffer_to_another(avk::referenced(aStagingBuffer), avk::referenced(aDeviceBuffer), 0, 0, aTotalSize, avk::sync::with_barriers_into_existing_command_buffer(commandBuffer, {}, {}));
 
 		// Sync after
 		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
 
 		// Take care of the lifetime handling of the stagingBuffer, it might still be in use
 		commandBuffer.set_custom_deleter([
-			lOwnedStagingBuffer{ std::move(sb) }
+			lOwnedStagingBuffer{ std::move(aStagingBuffer) }
 		]() { /* Nothing to do here, the buffers' destructors will do the cleanup, the lambda is just storing it. */ });
 
 		// Finish him
 		aSyncHandler.submit_and_sync();
 	}
 
+	static inline void fill_device_buffer_cached(gvk::serializer& aSerializer, avk::buffer& aDeviceBuffer, size_t aTotalSize, avk::sync& aSyncHandler)
+	{
+		auto sb = create_staging_buffer(aTotalSize);
+		// Let the serializer map and fill the buffer
+		aSerializer.archive_buffer(sb);
+
+		copy_staging_buffer_to_device_buffer(std::move(sb), aDeviceBuffer, aTotalSize, aSyncHandler);
+	}
+
 	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
 		std::vector<glm::vec3> positionsData;
@@ -430,11 +440,21 @@ namespace gvk
 	
 	std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
 	{
-		return create_vertex_and_index_buffers(get_vertices_and_indices(aModelsAndSelectedMeshes),
+		return create_vertex_and_index_buffers_for_lod(aModelsAndSelectedMeshes, 0, aUsageFlags, std::move(aSyncHandler));
+	}
+
+	std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_vertex_and_index_buffers(get_vertices_and_indices_parallel(aModelsAndSelectedMeshes, aLodLevel),
 			aUsageFlags, std::move(aSyncHandler));
 	}
 
 	std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_vertex_and_index_buffers_for_lod_cached(aSerializer, aModelsAndSelectedMeshes, 0, aUsageFlags, std::move(aSyncHandler));
+	}
+
+	std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
 	{
 		size_t numPositions = 0;
 		size_t totalPositionsSize = 0;
@@ -442,7 +462,7 @@ namespace gvk
 		size_t totalIndicesSize = 0;
 
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
-			auto [positionsData, indicesData] = get_vertices_and_indices(aModelsAndSelectedMeshes);
+			auto [positionsData, indicesData] = get_vertices_and_indices_parallel(aModelsAndSelectedMeshes, aLodLevel);
 
 			numPositions = positionsData.size();
 			totalPositionsSize = sizeof(positionsData[0]) * numPositions;
@@ -485,6 +505,426 @@ namespace gvk
 	}
 
 
+	static inline avk::vertex_buffer_meta create_vertex_buffer_meta_for_layout(const vertex_layout& aLayout, size_t aNumVertices)
+	{
+		auto meta = avk::vertex_buffer_meta::create_from_total_size(aLayout.mStride * aNumVertices, aNumVertices);
+		for (const auto& loc : aLayout.mAttributes) {
+			switch (loc.mAttribute) {
+			case vertex_attribute::position:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec3>(), avk::content_description::position);
+				break;
+			case vertex_attribute::normal:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec3>(), avk::content_description::normal);
+				break;
+			case vertex_attribute::tangent:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec3>(), avk::content_description::tangent);
+				break;
+			case vertex_attribute::bitangent:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec3>(), avk::content_description::bitangent);
+				break;
+			case vertex_attribute::color:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec4>(), avk::content_description::color);
+				break;
+			case vertex_attribute::texture_coordinates_2d:
+			case vertex_attribute::texture_coordinates_2d_flipped:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec2>(), avk::content_description::texture_coordinate);
+				break;
+			case vertex_attribute::texture_coordinates_3d:
+				meta.describe_member(loc.mOffset, avk::format_for<glm::vec3>(), avk::content_description::texture_coordinate);
+				break;
+			}
+		}
+		return meta;
+	}
+
+	std::vector<mesh_data_range> compute_mesh_data_ranges(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel)
+	{
+		std::vector<mesh_data_range> result;
+		size_t vertexOffset = 0;
+		size_t indexOffset = 0;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				const auto numVertices = modelRef.get().number_of_vertices_for_mesh(meshIndex);
+				const auto numIndices = modelRef.get().number_of_indices_for_mesh_lod(meshIndex, aLodLevel);
+				result.push_back(mesh_data_range{ &modelRef.get(), meshIndex, vertexOffset, numVertices, indexOffset, numIndices, aLodLevel });
+				vertexOffset += numVertices;
+				indexOffset += numIndices;
+			}
+		}
+		return result;
+	}
+
+	void write_vertex_data_parallel(const std::vector<mesh_data_range>& aMeshDataRanges, const vertex_layout& aLayout, void* aDestination)
+	{
+		auto* dst = static_cast<uint8_t*>(aDestination);
+		// An unsupported layout throws, which must not escape the parallel loop; the first exception is rethrown after all meshes have been written:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(aMeshDataRanges), std::end(aMeshDataRanges), [&](const mesh_data_range& bRange) {
+			try {
+				bRange.mModel->write_vertex_data_for_mesh(bRange.mMeshIndex, aLayout, dst + bRange.mVertexOffset * aLayout.mStride);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	void write_indices_parallel(const std::vector<mesh_data_range>& aMeshDataRanges, uint32_t* aDestination)
+	{
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been written:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(aMeshDataRanges), std::end(aMeshDataRanges), [&](const mesh_data_range& bRange) {
+			try {
+				bRange.mModel->write_indices_for_mesh<uint32_t>(bRange.mMeshIndex, aDestination + bRange.mIndexOffset, static_cast<uint32_t>(bRange.mVertexOffset), bRange.mLodLevel);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices_parallel(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel)
+	{
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes, aLodLevel);
+		std::vector<glm::vec3> positionsData(ranges.empty() ? 0 : ranges.back().mVertexOffset + ranges.back().mNumVertices);
+		std::vector<uint32_t> indicesData(ranges.empty() ? 0 : ranges.back().mIndexOffset + ranges.back().mNumIndices);
+
+		write_vertex_data_parallel(ranges, vertex_layout{}.add(vertex_attribute::position), positionsData.data());
+		write_indices_parallel(ranges, indicesData.data());
+
+		return std::make_tuple( std::move(positionsData), std::move(indicesData) );
+	}
+
+	std::vector<uint32_t> get_indices_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel)
+	{
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes, aLodLevel);
+		std::vector<uint32_t> indicesData(ranges.empty() ? 0 : ranges.back().mIndexOffset + ranges.back().mNumIndices);
+		write_indices_parallel(ranges, indicesData.data());
+		return indicesData;
+	}
+
+	static inline avk::buffer create_index_buffer_for_lod(const std::vector<uint32_t>& aIndicesData, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		auto indexBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::index_buffer_meta::create_from_data(aIndicesData)
+		);
+		indexBuffer->fill(aIndicesData.data(), 0, std::move(aSyncHandler));
+		// It is fine to let aIndicesData go out of scope, since its data has been copied to a
+		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+
+		return indexBuffer;
+	}
+
+	avk::buffer create_index_buffer_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_index_buffer_for_lod(get_indices_for_lod(aModelsAndSelectedMeshes, aLodLevel), aUsageFlags, std::move(aSyncHandler));
+	}
+
+	avk::buffer create_index_buffer_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		size_t numIndices = 0;
+		size_t totalIndicesSize = 0;
+
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			auto indicesData = get_indices_for_lod(aModelsAndSelectedMeshes, aLodLevel);
+
+			numIndices = indicesData.size();
+			totalIndicesSize = sizeof(indicesData[0]) * numIndices;
+
+			aSerializer.archive(numIndices);
+			aSerializer.archive(totalIndicesSize);
+
+			aSerializer.archive_memory(indicesData.data(), totalIndicesSize);
+
+			return create_index_buffer_for_lod(indicesData, aUsageFlags, std::move(aSyncHandler));
+		}
+		else {
+			aSerializer.archive(numIndices);
+			aSerializer.archive(totalIndicesSize);
+
+			auto indexBuffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				avk::index_buffer_meta::create_from_total_size(totalIndicesSize, numIndices)
+			);
+
+			fill_device_buffer_cached(aSerializer, indexBuffer, totalIndicesSize, aSyncHandler);
+
+			return indexBuffer;
+		}
+	}
+
+	meshlet_data get_meshlets(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aMaxVertices, uint32_t aMaxPrimitives)
+	{
+		// Check the arguments here, so that invalid ones are not only detected within the parallel loop:
+		if (aMaxVertices < 3u || aMaxVertices > 256u) {
+			throw gvk::logic_error(fmt::format("The maximum number of vertices per meshlet must be in the range [3, 256], but is {}.", aMaxVertices));
+		}
+		if (0u == aMaxPrimitives) {
+			throw gvk::logic_error("The maximum number of primitives per meshlet must be greater than zero.");
+		}
+
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes);
+		std::vector<meshlet_data> meshletsPerMesh(ranges.size());
+
+		std::vector<size_t> work(ranges.size());
+		std::iota(std::begin(work), std::end(work), size_t{ 0 });
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(work), std::end(work), [&](size_t i) {
+			try {
+				const auto& range = ranges[i];
+				meshletsPerMesh[i] = build_meshlets(
+					range.mModel->indices_for_mesh<uint32_t>(range.mMeshIndex),
+					range.mModel->positions_for_mesh(range.mMeshIndex),
+					aMaxVertices, aMaxPrimitives
+				);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+
+		meshlet_data result;
+		for (size_t i = 0; i < ranges.size(); ++i) {
+			append_meshlets(result, meshletsPerMesh[i], static_cast<uint32_t>(ranges[i].mVertexOffset), static_cast<uint32_t>(i));
+		}
+		return result;
+	}
+
+	meshlet_data get_meshlets_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aMaxVertices, uint32_t aMaxPrimitives)
+	{
+		meshlet_data meshlets;
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			meshlets = get_meshlets(aModelsAndSelectedMeshes, aMaxVertices, aMaxPrimitives);
+		}
+		aSerializer.archive(meshlets);
+		return meshlets;
+	}
+
+	std::vector<bounding_box> get_bounding_boxes(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices)
+	{
+		std::vector<bounding_box> boxes;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				boxes.push_back(aApplyMeshRootMatrices ? modelRef.get().transformed_bounding_box_for_mesh(meshIndex) : modelRef.get().bounding_box_for_mesh(meshIndex));
+			}
+		}
+		return boxes;
+	}
+
+	std::vector<bounding_box> get_bounding_boxes_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices)
+	{
+		std::vector<bounding_box> boxes;
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			boxes = get_bounding_boxes(aModelsAndSelectedMeshes, aApplyMeshRootMatrices);
+		}
+		aSerializer.archive(boxes);
+		return boxes;
+	}
+
+	morph_target_gpu_data get_morph_targets(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes);
+		const size_t numVertices = ranges.empty() ? 0 : ranges.back().mVertexOffset + ranges.back().mNumVertices;
+
+		morph_target_gpu_data result;
+		result.mFirstTargetIndices.reserve(ranges.size());
+		for (const auto& range : ranges) {
+			result.mFirstTargetIndices.push_back(result.mNumTargets);
+			result.mNumTargets += static_cast<uint32_t>(range.mModel->morph_targets_for_mesh(range.mMeshIndex).mTargets.size());
+		}
+
+		// Count the deltas per vertex, and turn the counts into offsets (i.e. an exclusive prefix sum):
+		result.mVertexDeltaOffsets.assign(numVertices + 1, 0u);
+		for (const auto& range : ranges) {
+			for (const auto& target : range.mModel->morph_targets_for_mesh(range.mMeshIndex).mTargets) {
+				for (auto v : target.mVertexIndices) {
+					++result.mVertexDeltaOffsets[range.mVertexOffset + v + 1];
+				}
+			}
+		}
+		std::partial_sum(std::begin(result.mVertexDeltaOffsets), std::end(result.mVertexDeltaOffsets), std::begin(result.mVertexDeltaOffsets));
+
+		result.mDeltas.resize(result.mVertexDeltaOffsets.back());
+		std::vector<uint32_t> cursors(std::begin(result.mVertexDeltaOffsets), std::end(result.mVertexDeltaOffsets) - 1);
+		for (size_t r = 0; r < ranges.size(); ++r) {
+			const auto& targets = ranges[r].mModel->morph_targets_for_mesh(ranges[r].mMeshIndex).mTargets;
+			for (size_t t = 0; t < targets.size(); ++t) {
+				const auto& target = targets[t];
+				for (size_t i = 0; i < target.mVertexIndices.size(); ++i) {
+					auto& delta = result.mDeltas[cursors[ranges[r].mVertexOffset + target.mVertexIndices[i]]++];
+					delta.mDeltaPosition = target.mPositionDeltas[i];
+					delta.mTargetIndex = result.mFirstTargetIndices[r] + static_cast<uint32_t>(t);
+					delta.mDeltaNormal = target.mNormalDeltas.empty() ? glm::vec3{ 0.0f } : target.mNormalDeltas[i];
+					delta.mReserved = 0u;
+				}
+			}
+		}
+		return result;
+	}
+
+	std::tuple<avk::buffer, avk::buffer, std::vector<uint32_t>> create_morph_target_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		auto data = get_morph_targets(aModelsAndSelectedMeshes);
+		if (data.mDeltas.empty()) {
+			// Empty buffers can not be created => add one dummy delta, which is never referenced by any offset range:
+			data.mDeltas.emplace_back();
+		}
+
+		auto& commandBuffer = aSyncHandler.get_or_create_command_buffer();
+		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{ avk::memory_access::transfer_read_access });
+
+		auto offsetsBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::storage_buffer_meta::create_from_data(data.mVertexDeltaOffsets)
+		);
+		offsetsBuffer->fill(data.mVertexDeltaOffsets.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+
+		auto deltasBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::storage_buffer_meta::create_from_data(data.mDeltas)
+		);
+		deltasBuffer->fill(data.mDeltas.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+		// It is fine to let data go out of scope, since it has been copied to staging buffers, which are lifetime-handled by the command buffer.
+
+		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
+		aSyncHandler.submit_and_sync();
+
+		return std::make_tuple(std::move(offsetsBuffer), std::move(deltasBuffer), std::move(data.mFirstTargetIndices));
+	}
+
+	avk::buffer create_baked_palette_buffer(const baked_palette_gpu_data& aPalettes, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		auto paletteBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::storage_buffer_meta::create_from_data(aPalettes.mData)
+		);
+		paletteBuffer->fill(aPalettes.mData.data(), 0, std::move(aSyncHandler));
+		// It is fine to let aPalettes go out of scope, since its data has been copied to a
+		// staging buffer, which is lifetime-handled by the command buffer.
+		return paletteBuffer;
+	}
+
+	std::vector<bounding_sphere> get_bounding_spheres(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices)
+	{
+		std::vector<bounding_sphere> spheres;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				spheres.push_back(aApplyMeshRootMatrices ? modelRef.get().transformed_bounding_sphere_for_mesh(meshIndex) : modelRef.get().bounding_sphere_for_mesh(meshIndex));
+			}
+		}
+		return spheres;
+	}
+
+	std::vector<bounding_sphere> get_bounding_spheres_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aApplyMeshRootMatrices)
+	{
+		std::vector<bounding_sphere> spheres;
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			spheres = get_bounding_spheres(aModelsAndSelectedMeshes, aApplyMeshRootMatrices);
+		}
+		aSerializer.archive(spheres);
+		return spheres;
+	}
+
+	size_t number_of_vertices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		size_t numVertices = 0;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			numVertices += modelRef.get().number_of_vertices_for_meshes(std::get<std::vector<mesh_index_t>>(pair));
+		}
+		return numVertices;
+	}
+
+	avk::buffer create_interleaved_vertex_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const vertex_layout& aLayout, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		const auto numVertices = number_of_vertices(aModelsAndSelectedMeshes);
+		const auto totalSize = numVertices * aLayout.mStride;
+
+		// Write the vertex data straight into the mapped staging buffer, no intermediate vectors required:
+		auto sb = create_staging_buffer(totalSize);
+		{
+			auto mapping = sb->map_memory(avk::mapping_access::write);
+			write_vertex_data_parallel(compute_mesh_data_ranges(aModelsAndSelectedMeshes), aLayout, mapping.get());
+		}
+
+		auto vertexBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			create_vertex_buffer_meta_for_layout(aLayout, numVertices)
+		);
+		copy_staging_buffer_to_device_buffer(std::move(sb), vertexBuffer, totalSize, aSyncHandler);
+
+		return vertexBuffer;
+	}
+
+	avk::buffer create_interleaved_vertex_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const vertex_layout& aLayout, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		size_t numVertices = 0;
+		size_t totalSize = 0;
+
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			numVertices = number_of_vertices(aModelsAndSelectedMeshes);
+			totalSize = numVertices * aLayout.mStride;
+
+			aSerializer.archive(numVertices);
+			aSerializer.archive(totalSize);
+
+			auto sb = create_staging_buffer(totalSize);
+			{
+				auto mapping = sb->map_memory(avk::mapping_access::write);
+				write_vertex_data_parallel(compute_mesh_data_ranges(aModelsAndSelectedMeshes), aLayout, mapping.get());
+			}
+			// Let the serializer read the data from the staging buffer
+			aSerializer.archive_buffer(sb);
+
+			auto vertexBuffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				create_vertex_buffer_meta_for_layout(aLayout, numVertices)
+			);
+			copy_staging_buffer_to_device_buffer(std::move(sb), vertexBuffer, totalSize, aSyncHandler);
+
+			return vertexBuffer;
+		}
+		else {
+			aSerializer.archive(numVertices);
+			aSerializer.archive(totalSize);
+
+			auto vertexBuffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				create_vertex_buffer_meta_for_layout(aLayout, numVertices)
+			);
+
+			fill_device_buffer_cached(aSerializer, vertexBuffer, totalSize, aSyncHandler);
+
+			return vertexBuffer;
+		}
+	}
+
 	std::vector<glm::vec3> get_normals(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
 		std::vector<glm::vec3> normalsData;
@@ -576,6 +1016,27 @@ namespace gvk
 		return tangentsData;
 	}
 
+	void generate_tangents_cached(gvk::serializer& aSerializer, model_t& aModel, const std::vector<mesh_index_t>& aMeshIndices, int aTexCoordSet)
+	{
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			aModel.generate_tangents(aMeshIndices, aTexCoordSet);
+		}
+		for (auto meshIndex : aMeshIndices) {
+			// Meshes which contain tangents or for which none could be generated are stored as empty tangent spaces:
+			tangent_space tangentSpace;
+			if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+				const auto generated = aModel.generated_tangents_for_mesh(meshIndex);
+				if (nullptr != generated) {
+					tangentSpace = *generated;
+				}
+			}
+			aSerializer.archive(tangentSpace);
+			if (aSerializer.mode() == gvk::serializer::mode::deserialize && !tangentSpace.mTangents.empty()) {
+				aModel.set_generated_tangents_for_mesh(meshIndex, std::move(tangentSpace));
+			}
+		}
+	}
+
 	std::vector<glm::vec3> get_tangents_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
 		std::vector<glm::vec3> tangentsData;
@@ -935,6 +1396,362 @@ namespace gvk
 		return create_bone_indices_buffer_cached(aSerializer, boneIndicesData, std::move(aSyncHandler));
 	}
 
+	template <typename T>
+	static inline avk::buffer create_compact_vertex_buffer(const std::vector<T>& aData, vk::Format aFormat, avk::sync aSyncHandler, std::optional<avk::content_description> aContent = {})
+	{
+		auto meta = avk::vertex_buffer_meta::create_from_data(aData);
+		if (aContent.has_value()) {
+			meta.describe_member(0, aFormat, aContent.value());
+		}
+		else {
+			meta.describe_member(0, aFormat);
+		}
+		auto buffer = context().create_buffer(
+			avk::memory_usage::device, {},
+			meta
+		);
+		buffer->fill(aData.data(), 0, std::move(aSyncHandler));
+		// It is fine to let aData go out of scope, since its data has been copied to a
+		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+
+		return buffer;
+	}
+
+	template <typename T, typename F>
+	static inline avk::buffer create_compact_vertex_buffer_cached(gvk::serializer& aSerializer, F aGetData, vk::Format aFormat, avk::sync aSyncHandler, std::optional<avk::content_description> aContent = {})
+	{
+		size_t numElements = 0;
+		size_t totalSize = 0;
+
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			std::vector<T> data = aGetData();
+
+			numElements = data.size();
+			totalSize = sizeof(T) * numElements;
+
+			aSerializer.archive(numElements);
+			aSerializer.archive(totalSize);
+
+			aSerializer.archive_memory(data.data(), totalSize);
+
+			return create_compact_vertex_buffer(data, aFormat, std::move(aSyncHandler), aContent);
+		}
+		else {
+			aSerializer.archive(numElements);
+			aSerializer.archive(totalSize);
+
+			auto meta = avk::vertex_buffer_meta::create_from_total_size(totalSize, numElements);
+			if (aContent.has_value()) {
+				meta.describe_member(0, aFormat, aContent.value());
+			}
+			else {
+				meta.describe_member(0, aFormat);
+			}
+			auto buffer = context().create_buffer(
+				avk::memory_usage::device, {},
+				meta
+			);
+
+			fill_device_buffer_cached(aSerializer, buffer, totalSize, aSyncHandler);
+
+			return buffer;
+		}
+	}
+
+	std::vector<glm::u8vec4> get_bone_weights_unorm8(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<glm::u8vec4> boneWeightsData;
+
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				insert_into(boneWeightsData, modelRef.get().bone_weights_for_mesh_unorm8(meshIndex));
+			}
+		}
+
+		return boneWeightsData;
+	}
+
+	avk::buffer create_bone_weights_unorm8_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_bone_weights_unorm8(aModelsAndSelectedMeshes), vk::Format::eR8G8B8A8Unorm, std::move(aSyncHandler));
+	}
+
+	avk::buffer create_bone_weights_unorm8_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::u8vec4>(aSerializer, [&]() { return get_bone_weights_unorm8(aModelsAndSelectedMeshes); }, vk::Format::eR8G8B8A8Unorm, std::move(aSyncHandler));
+	}
+
+	std::vector<glm::u16vec4> get_bone_weights_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<glm::u16vec4> boneWeightsData;
+
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				insert_into(boneWeightsData, modelRef.get().bone_weights_for_mesh_unorm16(meshIndex));
+			}
+		}
+
+		return boneWeightsData;
+	}
+
+	avk::buffer create_bone_weights_unorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_bone_weights_unorm16(aModelsAndSelectedMeshes), vk::Format::eR16G16B16A16Unorm, std::move(aSyncHandler));
+	}
+
+	avk::buffer create_bone_weights_unorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::u16vec4>(aSerializer, [&]() { return get_bone_weights_unorm16(aModelsAndSelectedMeshes); }, vk::Format::eR16G16B16A16Unorm, std::move(aSyncHandler));
+	}
+
+	std::vector<glm::u8vec4> get_bone_indices_u8(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+	{
+		std::vector<glm::u8vec4> boneIndicesData;
+
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				insert_into(boneIndicesData, modelRef.get().bone_indices_for_mesh_u8(meshIndex, aBoneIndexOffset));
+			}
+		}
+
+		return boneIndicesData;
+	}
+
+	avk::buffer create_bone_indices_u8_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_bone_indices_u8(aModelsAndSelectedMeshes, aBoneIndexOffset), vk::Format::eR8G8B8A8Uint, std::move(aSyncHandler));
+	}
+
+	avk::buffer create_bone_indices_u8_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::u8vec4>(aSerializer, [&]() { return get_bone_indices_u8(aModelsAndSelectedMeshes, aBoneIndexOffset); }, vk::Format::eR8G8B8A8Uint, std::move(aSyncHandler));
+	}
+
+	std::vector<glm::i16vec2> get_normals_octahedral_snorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		const auto normalsData = get_vertex_attribute_parallel<glm::vec3>(aModelsAndSelectedMeshes, vertex_attribute::normal);
+		std::vector<glm::i16vec2> encodedData(normalsData.size());
+		encode_octahedral_snorm16(normalsData.data(), encodedData.data(), normalsData.size());
+		return encodedData;
+	}
+
+	avk::buffer create_normals_octahedral_snorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_normals_octahedral_snorm16(aModelsAndSelectedMeshes), vk::Format::eR16G16Snorm, std::move(aSyncHandler), avk::content_description::normal);
+	}
+
+	avk::buffer create_normals_octahedral_snorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::i16vec2>(aSerializer, [&]() { return get_normals_octahedral_snorm16(aModelsAndSelectedMeshes); }, vk::Format::eR16G16Snorm, std::move(aSyncHandler), avk::content_description::normal);
+	}
+
+	std::vector<glm::i16vec2> get_tangents_octahedral_snorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		const auto tangentsData = get_vertex_attribute_parallel<glm::vec3>(aModelsAndSelectedMeshes, vertex_attribute::tangent);
+		std::vector<glm::i16vec2> encodedData(tangentsData.size());
+		encode_octahedral_snorm16(tangentsData.data(), encodedData.data(), tangentsData.size());
+		return encodedData;
+	}
+
+	avk::buffer create_tangents_octahedral_snorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_tangents_octahedral_snorm16(aModelsAndSelectedMeshes), vk::Format::eR16G16Snorm, std::move(aSyncHandler), avk::content_description::tangent);
+	}
+
+	avk::buffer create_tangents_octahedral_snorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::i16vec2>(aSerializer, [&]() { return get_tangents_octahedral_snorm16(aModelsAndSelectedMeshes); }, vk::Format::eR16G16Snorm, std::move(aSyncHandler), avk::content_description::tangent);
+	}
+
+	std::vector<glm::u16vec2> get_2d_texture_coordinates_half(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped)
+	{
+		const auto texCoordsData = get_vertex_attribute_parallel<glm::vec2>(aModelsAndSelectedMeshes, aFlipped ? vertex_attribute::texture_coordinates_2d_flipped : vertex_attribute::texture_coordinates_2d, aTexCoordSet);
+		std::vector<glm::u16vec2> halfData(texCoordsData.size());
+		convert_to_half(reinterpret_cast<const float*>(texCoordsData.data()), reinterpret_cast<uint16_t*>(halfData.data()), texCoordsData.size() * 2);
+		return halfData;
+	}
+
+	avk::buffer create_2d_texture_coordinates_half_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_2d_texture_coordinates_half(aModelsAndSelectedMeshes, aTexCoordSet, aFlipped), vk::Format::eR16G16Sfloat, std::move(aSyncHandler), avk::content_description::texture_coordinate);
+	}
+
+	avk::buffer create_2d_texture_coordinates_half_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::u16vec2>(aSerializer, [&]() { return get_2d_texture_coordinates_half(aModelsAndSelectedMeshes, aTexCoordSet, aFlipped); }, vk::Format::eR16G16Sfloat, std::move(aSyncHandler), avk::content_description::texture_coordinate);
+	}
+
+	std::vector<glm::u16vec2> get_2d_texture_coordinates_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped)
+	{
+		const auto texCoordsData = get_vertex_attribute_parallel<glm::vec2>(aModelsAndSelectedMeshes, aFlipped ? vertex_attribute::texture_coordinates_2d_flipped : vertex_attribute::texture_coordinates_2d, aTexCoordSet);
+		std::vector<glm::u16vec2> unormData(texCoordsData.size());
+		const float offsets[] = { 0.0f, 0.0f };
+		const float scales[] = { 1.0f, 1.0f };
+		quantize_unorm16(reinterpret_cast<const float*>(texCoordsData.data()), reinterpret_cast<uint16_t*>(unormData.data()), texCoordsData.size(), 2, offsets, scales);
+		return unormData;
+	}
+
+	avk::buffer create_2d_texture_coordinates_unorm16_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer(get_2d_texture_coordinates_unorm16(aModelsAndSelectedMeshes, aTexCoordSet, aFlipped), vk::Format::eR16G16Unorm, std::move(aSyncHandler), avk::content_description::texture_coordinate);
+	}
+
+	avk::buffer create_2d_texture_coordinates_unorm16_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipped, avk::sync aSyncHandler)
+	{
+		return create_compact_vertex_buffer_cached<glm::u16vec2>(aSerializer, [&]() { return get_2d_texture_coordinates_unorm16(aModelsAndSelectedMeshes, aTexCoordSet, aFlipped); }, vk::Format::eR16G16Unorm, std::move(aSyncHandler), avk::content_description::texture_coordinate);
+	}
+
+	std::tuple<std::vector<glm::u16vec4>, std::vector<quantization_transform>> get_positions_unorm16(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds)
+	{
+		const auto ranges = compute_mesh_data_ranges(aModelsAndSelectedMeshes);
+		const auto numVertices = ranges.empty() ? 0 : ranges.back().mVertexOffset + ranges.back().mNumVertices;
+
+		// Positions are gathered with a stride of four floats, so that they can be quantized into four components. The fourth one stays 0.
+		std::vector<glm::vec4> positionsData(numVertices, glm::vec4{ 0.0f });
+		write_vertex_data_parallel(ranges, vertex_layout{}.add(vertex_attribute::position).with_stride(sizeof(glm::vec4)), positionsData.data());
+
+		auto boundsOf = [&](size_t bFirst, size_t bCount) {
+			std::vector<glm::vec3> tmp(bCount);
+			for (size_t i = 0; i < bCount; ++i) {
+				tmp[i] = glm::vec3{ positionsData[bFirst + i] };
+			}
+			return compute_quantization_transform(tmp.data(), tmp.size());
+		};
+		std::vector<quantization_transform> transforms(ranges.size());
+		if (aSharedBounds) {
+			std::fill(std::begin(transforms), std::end(transforms), boundsOf(0, numVertices));
+		}
+
+		std::vector<glm::u16vec4> quantizedData(numVertices);
+		std::vector<size_t> work(ranges.size());
+		std::iota(std::begin(work), std::end(work), size_t{ 0 });
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been quantized:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(work), std::end(work), [&](size_t i) {
+			try {
+				const auto& range = ranges[i];
+				if (!aSharedBounds) {
+					transforms[i] = boundsOf(range.mVertexOffset, range.mNumVertices);
+				}
+				const float offsets[] = { transforms[i].mOffset.x, transforms[i].mOffset.y, transforms[i].mOffset.z, 0.0f };
+				const float scales[] = { 1.0f / transforms[i].mScale.x, 1.0f / transforms[i].mScale.y, 1.0f / transforms[i].mScale.z, 0.0f };
+				quantize_unorm16(reinterpret_cast<const float*>(positionsData.data() + range.mVertexOffset), reinterpret_cast<uint16_t*>(quantizedData.data() + range.mVertexOffset), range.mNumVertices, 4, offsets, scales);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+
+		return std::make_tuple(std::move(quantizedData), std::move(transforms));
+	}
+
+	static inline std::tuple<avk::buffer, avk::buffer> create_quantized_vertex_and_index_buffers(const std::vector<glm::u16vec4>& aPositionsData, const std::vector<uint32_t>& aIndicesData, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		auto& commandBuffer = aSyncHandler.get_or_create_command_buffer();
+		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{ avk::memory_access::transfer_read_access });
+
+		auto positionsBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::vertex_buffer_meta::create_from_data(aPositionsData)
+				.describe_member(0, vk::Format::eR16G16B16A16Unorm, avk::content_description::position)
+		);
+		positionsBuffer->fill(aPositionsData.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+
+		auto indexBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::index_buffer_meta::create_from_data(aIndicesData)
+		);
+		indexBuffer->fill(aIndicesData.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+
+		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
+		aSyncHandler.submit_and_sync();
+
+		return std::make_tuple(std::move(positionsBuffer), std::move(indexBuffer));
+	}
+
+	std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_quantized_vertex_and_index_buffers_for_lod(aModelsAndSelectedMeshes, 0, aSharedBounds, aUsageFlags, std::move(aSyncHandler));
+	}
+
+	std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_for_lod(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, bool aSharedBounds, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		auto [positionsData, transforms] = get_positions_unorm16(aModelsAndSelectedMeshes, aSharedBounds);
+		auto [positionsBuffer, indexBuffer] = create_quantized_vertex_and_index_buffers(positionsData, get_indices_for_lod(aModelsAndSelectedMeshes, aLodLevel), aUsageFlags, std::move(aSyncHandler));
+		return std::make_tuple(std::move(positionsBuffer), std::move(indexBuffer), std::move(transforms));
+	}
+
+	std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aSharedBounds, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_quantized_vertex_and_index_buffers_for_lod_cached(aSerializer, aModelsAndSelectedMeshes, 0, aSharedBounds, aUsageFlags, std::move(aSyncHandler));
+	}
+
+	std::tuple<avk::buffer, avk::buffer, std::vector<quantization_transform>> create_quantized_vertex_and_index_buffers_for_lod_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aLodLevel, bool aSharedBounds, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		size_t numPositions = 0;
+		size_t totalPositionsSize = 0;
+		size_t numIndices = 0;
+		size_t totalIndicesSize = 0;
+		std::vector<quantization_transform> transforms;
+
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			auto [positionsData, transformsData] = get_positions_unorm16(aModelsAndSelectedMeshes, aSharedBounds);
+			auto indicesData = get_indices_for_lod(aModelsAndSelectedMeshes, aLodLevel);
+			transforms = std::move(transformsData);
+
+			numPositions = positionsData.size();
+			totalPositionsSize = sizeof(positionsData[0]) * numPositions;
+			numIndices = indicesData.size();
+			totalIndicesSize = sizeof(indicesData[0]) * numIndices;
+
+			aSerializer.archive(transforms);
+			aSerializer.archive(numPositions);
+			aSerializer.archive(totalPositionsSize);
+			aSerializer.archive(numIndices);
+			aSerializer.archive(totalIndicesSize);
+
+			aSerializer.archive_memory(positionsData.data(), totalPositionsSize);
+			aSerializer.archive_memory(indicesData.data(), totalIndicesSize);
+
+			auto [positionsBuffer, indexBuffer] = create_quantized_vertex_and_index_buffers(positionsData, indicesData, aUsageFlags, std::move(aSyncHandler));
+			return std::make_tuple(std::move(positionsBuffer), std::move(indexBuffer), std::move(transforms));
+		}
+		else {
+			aSerializer.archive(transforms);
+			aSerializer.archive(numPositions);
+			aSerializer.archive(totalPositionsSize);
+			aSerializer.archive(numIndices);
+			aSerializer.archive(totalIndicesSize);
+
+			auto positionsBuffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				avk::vertex_buffer_meta::create_from_total_size(totalPositionsSize, numPositions)
+					.describe_member(0, vk::Format::eR16G16B16A16Unorm, avk::content_description::position)
+			);
+
+			fill_device_buffer_cached(aSerializer, positionsBuffer, totalPositionsSize, aSyncHandler);
+
+			auto indexBuffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				avk::index_buffer_meta::create_from_total_size(totalIndicesSize, numIndices)
+			);
+
+			fill_device_buffer_cached(aSerializer, indexBuffer, totalIndicesSize, aSyncHandler);
+
+			return std::make_tuple(std::move(positionsBuffer), std::move(indexBuffer), std::move(transforms));
+		}
+	}
+
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
 	{
 		std::vector<glm::uvec4> boneIndicesData;
@@ -0,0 +1,304 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	vertex_cache_statistics analyze_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices, uint32_t aCacheSize)
+	{
+		assert(aIndices.size() % 3 == 0);
+		vertex_cache_statistics result;
+		result.mNumTriangles = aIndices.size() / 3;
+
+		// A vertex is in the FIFO cache if it has been inserted at most aCacheSize insertions ago:
+		std::vector<size_t> insertionTimestamps(aNumVertices, 0);
+		std::vector<bool> referenced(aNumVertices, false);
+		size_t timestamp = static_cast<size_t>(aCacheSize) + 1;
+		for (auto index : aIndices) {
+			assert(index < aNumVertices);
+			if (timestamp - insertionTimestamps[index] > aCacheSize) {
+				insertionTimestamps[index] = timestamp++;
+				++result.mVerticesTransformed;
+			}
+			if (!referenced[index]) {
+				referenced[index] = true;
+				++result.mNumUniqueVertices;
+			}
+		}
+
+		result.mAcmr = result.mNumTriangles > 0 ? static_cast<float>(result.mVerticesTransformed) / static_cast<float>(result.mNumTriangles) : 0.0f;
+		result.mAtvr = result.mNumUniqueVertices > 0 ? static_cast<float>(result.mVerticesTransformed) / static_cast<float>(result.mNumUniqueVertices) : 0.0f;
+		return result;
+	}
+
+	// Parameters of Forsyth's scoring function, as proposed in the original paper:
+	static constexpr int   sForsythCacheSize = 32;
+	static constexpr float sForsythCacheDecayPower = 1.5f;
+	static constexpr float sForsythLastTriangleScore = 0.75f;
+	static constexpr float sForsythValenceBoostScale = 2.0f;
+	static constexpr float sForsythValenceBoostPower = 0.5f;
+
+	static float forsyth_vertex_score(int aCachePosition, uint32_t aRemainingValence)
+	{
+		if (0 == aRemainingValence) {
+			return -1.0f; // No triangles left which use this vertex
+		}
+
+		float score = 0.0f;
+		if (aCachePosition >= 0) {
+			if (aCachePosition < 3) {
+				// The vertex was used in the last triangle => fixed score, so that it does not matter which one of the three
+				score = sForsythLastTriangleScore;
+			}
+			else {
+				assert(aCachePosition < sForsythCacheSize);
+				const float scaler = 1.0f / static_cast<float>(sForsythCacheSize - 3);
+				score = std::pow(1.0f - static_cast<float>(aCachePosition - 3) * scaler, sForsythCacheDecayPower);
+			}
+		}
+
+		// Boost vertices with only a few triangles left, so that they get finished off:
+		score += sForsythValenceBoostScale * std::pow(static_cast<float>(aRemainingValence), -sForsythValenceBoostPower);
+		return score;
+	}
+
+	std::vector<uint32_t> optimize_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices)
+	{
+		assert(aIndices.size() % 3 == 0);
+		const size_t numTriangles = aIndices.size() / 3;
+		if (0 == numTriangles) {
+			return aIndices;
+		}
+
+		// Per-vertex triangle adjacency in a flat, compressed sparse row layout:
+		std::vector<uint32_t> valence(aNumVertices, 0u);
+		for (auto index : aIndices) {
+			++valence[index];
+		}
+		std::vector<uint32_t> adjacencyOffsets(aNumVertices + 1, 0u);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + valence[v];
+		}
+		std::vector<uint32_t> adjacency(aIndices.size());
+		{
+			std::vector<uint32_t> fill(aNumVertices, 0u);
+			for (size_t t = 0; t < numTriangles; ++t) {
+				for (size_t k = 0; k < 3; ++k) {
+					const auto v = aIndices[t * 3 + k];
+					adjacency[adjacencyOffsets[v] + fill[v]++] = static_cast<uint32_t>(t);
+				}
+			}
+		}
+		// valence[v] is used as the number of remaining (not yet emitted) triangles of v from here on,
+		// and adjacency[adjacencyOffsets[v], adjacencyOffsets[v] + valence[v]) always holds exactly those.
+
+		std::vector<float> vertexScores(aNumVertices);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			vertexScores[v] = forsyth_vertex_score(-1, valence[v]);
+		}
+		std::vector<bool> emitted(numTriangles, false);
+
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		std::vector<uint32_t> cache;
+		std::vector<uint32_t> newCache;
+		cache.reserve(sForsythCacheSize + 3);
+		newCache.reserve(sForsythCacheSize + 3);
+
+		size_t linearScanCursor = 0;
+		std::optional<size_t> bestTriangle;
+		for (size_t emittedCount = 0; emittedCount < numTriangles; ++emittedCount) {
+			if (!bestTriangle.has_value()) {
+				// No candidate in the cache => take the next one which has not been emitted yet
+				while (emitted[linearScanCursor]) {
+					++linearScanCursor;
+				}
+				bestTriangle = linearScanCursor;
+			}
+
+			const size_t t = bestTriangle.value();
+			emitted[t] = true;
+
+			// Emit the triangle, put its vertices at the front of the LRU cache, and remove it from the adjacency:
+			newCache.clear();
+			for (size_t k = 0; k < 3; ++k) {
+				const auto v = aIndices[t * 3 + k];
+				result.push_back(v);
+				newCache.push_back(v);
+
+				auto* first = &adjacency[adjacencyOffsets[v]];
+				auto* last = first + valence[v];
+				auto* it = std::find(first, last, static_cast<uint32_t>(t));
+				assert(it != last);
+				std::swap(*it, *(last - 1));
+				--valence[v];
+			}
+			for (auto v : cache) {
+				if (v != newCache[0] && v != newCache[1] && v != newCache[2]) {
+					newCache.push_back(v);
+				}
+			}
+			// Vertices which dropped out of the cache:
+			for (size_t i = sForsythCacheSize; i < newCache.size(); ++i) {
+				vertexScores[newCache[i]] = forsyth_vertex_score(-1, valence[newCache[i]]);
+			}
+			if (newCache.size() > static_cast<size_t>(sForsythCacheSize)) {
+				newCache.resize(sForsythCacheSize);
+			}
+			std::swap(cache, newCache);
+
+			// Update the scores of all vertices in the cache and of all their remaining triangles,
+			// and determine the best candidate for the next iteration on the way:
+			for (size_t i = 0; i < cache.size(); ++i) {
+				vertexScores[cache[i]] = forsyth_vertex_score(static_cast<int>(i), valence[cache[i]]);
+			}
+			bestTriangle.reset();
+			float bestScore = -1.0f;
+			for (auto v : cache) {
+				for (uint32_t a = 0; a < valence[v]; ++a) {
+					const auto tri = adjacency[adjacencyOffsets[v] + a];
+					assert(!emitted[tri]);
+					const float score = vertexScores[aIndices[tri * 3]] + vertexScores[aIndices[tri * 3 + 1]] + vertexScores[aIndices[tri * 3 + 2]];
+					if (score > bestScore) {
+						bestScore = score;
+						bestTriangle = tri;
+					}
+				}
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<uint32_t> optimize_overdraw(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, uint32_t aCacheSize, float aThreshold)
+	{
+		assert(aIndices.size() % 3 == 0);
+		const size_t numTriangles = aIndices.size() / 3;
+		if (numTriangles < 2) {
+			return aIndices;
+		}
+
+		// FIFO cache simulation. Flushing the cache is done by advancing the timestamp past the cache size.
+		std::vector<size_t> insertionTimestamps(aPositions.size(), 0);
+		size_t timestamp = static_cast<size_t>(aCacheSize) + 1;
+		auto flushCache = [&]() {
+			timestamp += static_cast<size_t>(aCacheSize) + 1;
+		};
+		auto simulateTriangle = [&](size_t bTriangle) -> uint32_t {
+			uint32_t misses = 0;
+			for (size_t k = 0; k < 3; ++k) {
+				const auto v = aIndices[bTriangle * 3 + k];
+				if (timestamp - insertionTimestamps[v] > aCacheSize) {
+					insertionTimestamps[v] = timestamp++;
+					++misses;
+				}
+			}
+			return misses;
+		};
+
+		// Hard boundaries: Triangles where the cache has been flushed, i.e. all three vertices have to be transformed.
+		std::vector<uint32_t> missesPerTriangle(numTriangles);
+		std::vector<size_t> hardBoundaries;
+		for (size_t t = 0; t < numTriangles; ++t) {
+			missesPerTriangle[t] = simulateTriangle(t);
+			if (0 == t || 3 == missesPerTriangle[t]) {
+				hardBoundaries.push_back(t);
+			}
+		}
+		hardBoundaries.push_back(numTriangles);
+
+		// Soft boundaries: Split the hard clusters further as long as the ACMR of the sub-clusters stays within the threshold.
+		std::vector<size_t> clusterStarts;
+		for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+			const auto start = hardBoundaries[h];
+			const auto end = hardBoundaries[h + 1];
+			size_t clusterMisses = 0;
+			for (size_t t = start; t < end; ++t) {
+				clusterMisses += missesPerTriangle[t];
+			}
+			const float thresholdAcmr = static_cast<float>(clusterMisses) / static_cast<float>(end - start) * aThreshold;
+
+			size_t t = start;
+			while (t < end) {
+				// Start a new sub-cluster with a fresh cache:
+				clusterStarts.push_back(t);
+				flushCache();
+				const size_t subStart = t;
+				size_t runningMisses = 0;
+				while (t < end) {
+					runningMisses += simulateTriangle(t);
+					++t;
+					if (static_cast<float>(runningMisses) / static_cast<float>(t - subStart) <= thresholdAcmr) {
+						break;
+					}
+				}
+			}
+		}
+		clusterStarts.push_back(numTriangles);
+		const size_t numClusters = clusterStarts.size() - 1;
+
+		// Sort key per cluster: Clusters which face away from the mesh's center are likely occluders => draw them first.
+		glm::vec3 meshCentroid{ 0.0f };
+		for (const auto& p : aPositions) {
+			meshCentroid += p;
+		}
+		meshCentroid /= static_cast<float>(std::max(size_t{ 1 }, aPositions.size()));
+
+		std::vector<float> sortKeys(numClusters);
+		for (size_t c = 0; c < numClusters; ++c) {
+			glm::vec3 centroid{ 0.0f };
+			glm::vec3 normal{ 0.0f };
+			float area = 0.0f;
+			for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t) {
+				const auto& p0 = aPositions[aIndices[t * 3]];
+				const auto& p1 = aPositions[aIndices[t * 3 + 1]];
+				const auto& p2 = aPositions[aIndices[t * 3 + 2]];
+				const auto n = glm::cross(p1 - p0, p2 - p0); // length is twice the area => area-weighted
+				const float a = glm::length(n);
+				centroid += (p0 + p1 + p2) * (a / 3.0f);
+				normal += n;
+				area += a;
+			}
+			centroid = area > 0.0f ? centroid / area : aPositions[aIndices[clusterStarts[c] * 3]];
+			const float normalLength = glm::length(normal);
+			normal = normalLength > 0.0f ? normal / normalLength : glm::vec3{ 0.0f };
+			sortKeys[c] = glm::dot(centroid - meshCentroid, normal);
+		}
+
+		std::vector<size_t> clusterOrder(numClusters);
+		std::iota(std::begin(clusterOrder), std::end(clusterOrder), size_t{ 0 });
+		std::stable_sort(std::begin(clusterOrder), std::end(clusterOrder), [&](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		for (auto c : clusterOrder) {
+			result.insert(std::end(result), std::begin(aIndices) + clusterStarts[c] * 3, std::begin(aIndices) + clusterStarts[c + 1] * 3);
+		}
+		return result;
+	}
+
+	std::vector<uint32_t> optimize_vertex_fetch_remap(const std::vector<uint32_t>& aIndices, size_t aNumVertices)
+	{
+		constexpr uint32_t unassigned = std::numeric_limits<uint32_t>::max();
+		std::vector<uint32_t> remap(aNumVertices, unassigned);
+		uint32_t next = 0;
+		for (auto index : aIndices) {
+			assert(index < aNumVertices);
+			if (unassigned == remap[index]) {
+				remap[index] = next++;
+			}
+		}
+		// Keep unreferenced vertices, but move them to the end:
+		for (auto& r : remap) {
+			if (unassigned == r) {
+				r = next++;
+			}
+		}
+		return remap;
+	}
+
+	void remap_indices(std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aRemap)
+	{
+		for (auto& index : aIndices) {
+			index = aRemap[index];
+		}
+	}
+}
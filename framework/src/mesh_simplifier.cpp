@@ -0,0 +1,324 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Symmetric 4x4 error quadric, stored as its upper triangle, plus the sum of the weights of all planes, so that
+	// the error can be normalized to a squared distance. Doubles, because the plane equations are accumulated over many triangles.
+	struct quadric
+	{
+		double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+		double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+		double a22 = 0.0, a23 = 0.0;
+		double a33 = 0.0;
+		double w = 0.0;
+
+		// Quadric of the squared distance to the plane through aPoint with the given unit normal, weighted by aWeight:
+		static quadric from_plane(const glm::vec3& aNormal, const glm::vec3& aPoint, double aWeight)
+		{
+			const double a = aNormal.x, b = aNormal.y, c = aNormal.z;
+			const double d = -glm::dot(aNormal, aPoint);
+			quadric q;
+			q.a00 = aWeight * a * a; q.a01 = aWeight * a * b; q.a02 = aWeight * a * c; q.a03 = aWeight * a * d;
+			q.a11 = aWeight * b * b; q.a12 = aWeight * b * c; q.a13 = aWeight * b * d;
+			q.a22 = aWeight * c * c; q.a23 = aWeight * c * d;
+			q.a33 = aWeight * d * d;
+			q.w = aWeight;
+			return q;
+		}
+
+		quadric& operator+=(const quadric& aOther)
+		{
+			a00 += aOther.a00; a01 += aOther.a01; a02 += aOther.a02; a03 += aOther.a03;
+			a11 += aOther.a11; a12 += aOther.a12; a13 += aOther.a13;
+			a22 += aOther.a22; a23 += aOther.a23;
+			a33 += aOther.a33;
+			w += aOther.w;
+			return *this;
+		}
+
+		double error(const glm::vec3& aPoint) const
+		{
+			const double x = aPoint.x, y = aPoint.y, z = aPoint.z;
+			const double e =
+				a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x +
+				a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y +
+				a22 * z * z + 2.0 * a23 * z +
+				a33;
+			return w > 0.0 ? std::max(0.0, e) / w : 0.0;
+		}
+	};
+
+	enum struct simplifier_vertex_kind : uint8_t
+	{
+		interior,	// Can be collapsed into any neighbor
+		border,		// Can only be collapsed along an open border edge
+		locked		// Is never removed, e.g. vertices at attribute seams
+	};
+
+	static uint64_t edge_key(uint32_t aFrom, uint32_t aTo)
+	{
+		return (static_cast<uint64_t>(aFrom) << 32) | static_cast<uint64_t>(aTo);
+	}
+
+	mesh_lod simplify_mesh(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, size_t aTargetIndexCount, float aTargetError)
+	{
+		assert(aIndices.size() % 3 == 0);
+		mesh_lod result;
+		result.mIndices = aIndices;
+		if (aIndices.size() <= aTargetIndexCount) {
+			return result;
+		}
+		const auto numVertices = aPositions.size();
+		auto& indices = result.mIndices;
+
+		// Errors are relative to the extent of the mesh:
+		glm::vec3 minPos{ std::numeric_limits<float>::max() };
+		glm::vec3 maxPos{ std::numeric_limits<float>::lowest() };
+		for (auto index : aIndices) {
+			minPos = glm::min(minPos, aPositions[index]);
+			maxPos = glm::max(maxPos, aPositions[index]);
+		}
+		const auto extents = maxPos - minPos;
+		const float scale = std::max(std::max(extents.x, extents.y), std::max(extents.z, std::numeric_limits<float>::min()));
+		const double maxAbsoluteError = static_cast<double>(aTargetError) * static_cast<double>(scale);
+		const double maxQuadricError = maxAbsoluteError * maxAbsoluteError;
+
+		// Weld vertices by position, so that the topology can be analyzed regardless of attribute seams:
+		std::vector<uint32_t> welded(numVertices);
+		std::vector<uint32_t> numVerticesAtPosition(numVertices, 0u);
+		{
+			struct position_hash
+			{
+				size_t operator()(const glm::vec3& aPos) const
+				{
+					// Adding 0 turns -0 into +0, which compare equal and must therefore hash equally:
+					size_t h = 0;
+					avk::hash_combine(h, aPos.x + 0.0f, aPos.y + 0.0f, aPos.z + 0.0f);
+					return h;
+				}
+			};
+			std::unordered_map<glm::vec3, uint32_t, position_hash> firstVertexAtPosition;
+			for (uint32_t v = 0; v < static_cast<uint32_t>(numVertices); ++v) {
+				welded[v] = firstVertexAtPosition.try_emplace(aPositions[v], v).first->second;
+				++numVerticesAtPosition[welded[v]];
+			}
+		}
+
+		// Half-edges in welded space. Half-edges without an opposite are on an open border, edges with more than two triangles are non-manifold.
+		std::unordered_map<uint64_t, uint32_t> halfEdgeCounts;
+		auto collectHalfEdges = [&]() {
+			halfEdgeCounts.clear();
+			halfEdgeCounts.reserve(indices.size());
+			for (size_t i = 0; i < indices.size(); i += 3) {
+				for (size_t k = 0; k < 3; ++k) {
+					++halfEdgeCounts[edge_key(welded[indices[i + k]], welded[indices[i + (k + 1) % 3]])];
+				}
+			}
+		};
+		auto isBorderEdge = [&](uint32_t bFrom, uint32_t bTo) {
+			return 0 == halfEdgeCounts.count(edge_key(welded[bTo], welded[bFrom]));
+		};
+		collectHalfEdges();
+
+		// Classify vertices. Vertices which are not locked due to a seam are their own welded representative.
+		std::vector<simplifier_vertex_kind> kinds(numVertices, simplifier_vertex_kind::interior);
+		for (uint32_t v = 0; v < static_cast<uint32_t>(numVertices); ++v) {
+			if (numVerticesAtPosition[welded[v]] > 1) {
+				kinds[v] = simplifier_vertex_kind::locked;
+			}
+		}
+		for (const auto& [key, count] : halfEdgeCounts) {
+			const auto a = static_cast<uint32_t>(key >> 32);
+			const auto b = static_cast<uint32_t>(key & 0xFFFFFFFFu);
+			const auto opposite = halfEdgeCounts.find(edge_key(b, a));
+			const auto oppositeCount = halfEdgeCounts.end() == opposite ? 0u : opposite->second;
+			if (count > 1 || oppositeCount > 1) {
+				// Non-manifold => don't touch
+				kinds[a] = simplifier_vertex_kind::locked;
+				kinds[b] = simplifier_vertex_kind::locked;
+			}
+			else if (0 == oppositeCount) {
+				for (auto v : { a, b }) {
+					if (simplifier_vertex_kind::interior == kinds[v]) {
+						kinds[v] = simplifier_vertex_kind::border;
+					}
+				}
+			}
+		}
+
+		// Area-weighted plane quadrics, plus perpendicular planes along open borders to preserve their shape:
+		std::vector<quadric> quadrics(numVertices);
+		for (size_t i = 0; i < aIndices.size(); i += 3) {
+			const auto& p0 = aPositions[aIndices[i]];
+			const auto& p1 = aPositions[aIndices[i + 1]];
+			const auto& p2 = aPositions[aIndices[i + 2]];
+			const auto n = glm::cross(p1 - p0, p2 - p0);
+			const float length = glm::length(n);
+			if (length <= 0.0f) {
+				continue;
+			}
+			const auto normal = n / length;
+			const auto q = quadric::from_plane(normal, p0, 0.5 * length);
+			for (size_t k = 0; k < 3; ++k) {
+				quadrics[aIndices[i + k]] += q;
+			}
+			for (size_t k = 0; k < 3; ++k) {
+				const auto from = aIndices[i + k], to = aIndices[i + (k + 1) % 3];
+				if (isBorderEdge(from, to)) {
+					const auto edge = aPositions[to] - aPositions[from];
+					const float edgeLength = glm::length(edge);
+					if (edgeLength > 0.0f) {
+						const auto borderQ = quadric::from_plane(glm::normalize(glm::cross(edge, normal)), aPositions[from], 10.0 * static_cast<double>(edgeLength) * static_cast<double>(edgeLength));
+						quadrics[from] += borderQ;
+						quadrics[to] += borderQ;
+					}
+				}
+			}
+		}
+
+		double maxErrorUsed = 0.0;
+		std::vector<uint32_t> adjacencyOffsets(numVertices + 1);
+		std::vector<uint32_t> adjacency;
+		std::vector<bool> touched(numVertices);
+		std::vector<uint32_t> collapseTarget(numVertices);
+		struct collapse_candidate { uint32_t mFrom; uint32_t mTo; double mCost; };
+		std::vector<collapse_candidate> candidates;
+		std::vector<std::optional<collapse_candidate>> bestCandidatePerVertex(numVertices);
+
+		const bool hasBorders = kinds.end() != std::find(kinds.begin(), kinds.end(), simplifier_vertex_kind::border);
+		bool errorLimitReached = false;
+		while (indices.size() > aTargetIndexCount && !errorLimitReached) {
+			const size_t numTriangles = indices.size() / 3;
+
+			// Vertex -> triangles adjacency of the current triangles:
+			std::fill(std::begin(adjacencyOffsets), std::end(adjacencyOffsets), 0u);
+			for (auto index : indices) {
+				++adjacencyOffsets[index + 1];
+			}
+			for (size_t v = 0; v < numVertices; ++v) {
+				adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+			}
+			adjacency.resize(indices.size());
+			{
+				std::vector<uint32_t> insertPositions(std::begin(adjacencyOffsets), std::end(adjacencyOffsets) - 1);
+				for (size_t t = 0; t < numTriangles; ++t) {
+					for (size_t k = 0; k < 3; ++k) {
+						adjacency[insertPositions[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+					}
+				}
+			}
+
+			// The cheapest collapse per vertex:
+			std::fill(std::begin(bestCandidatePerVertex), std::end(bestCandidatePerVertex), std::optional<collapse_candidate>{});
+			for (size_t t = 0; t < numTriangles; ++t) {
+				for (size_t k = 0; k < 3; ++k) {
+					for (size_t dir = 0; dir < 2; ++dir) {
+						const auto from = indices[t * 3 + (dir == 0 ? k : (k + 1) % 3)];
+						const auto to   = indices[t * 3 + (dir == 0 ? (k + 1) % 3 : k)];
+						if (simplifier_vertex_kind::locked == kinds[from]) {
+							continue;
+						}
+						if (simplifier_vertex_kind::border == kinds[from] && (simplifier_vertex_kind::interior == kinds[to] || !isBorderEdge(from, to))) {
+							continue;
+						}
+						quadric q = quadrics[from];
+						q += quadrics[to];
+						const double cost = q.error(aPositions[to]);
+						auto& best = bestCandidatePerVertex[from];
+						if (!best.has_value() || cost < best->mCost) {
+							best = collapse_candidate{ from, to, cost };
+						}
+					}
+				}
+			}
+			candidates.clear();
+			for (const auto& c : bestCandidatePerVertex) {
+				if (c.has_value()) {
+					candidates.push_back(c.value());
+				}
+			}
+			std::sort(std::begin(candidates), std::end(candidates), [](const collapse_candidate& a, const collapse_candidate& b) { return a.mCost < b.mCost; });
+
+			// Perform as many collapses as possible within this pass. Every collapse blocks the one-ring of the removed vertex
+			// for the rest of the pass, so that all collapses of one pass operate on unmodified neighborhoods.
+			std::fill(std::begin(touched), std::end(touched), false);
+			std::iota(std::begin(collapseTarget), std::end(collapseTarget), 0u);
+			size_t remainingIndices = indices.size();
+			size_t numCollapses = 0;
+			for (const auto& c : candidates) {
+				if (remainingIndices <= aTargetIndexCount) {
+					break;
+				}
+				if (c.mCost > maxQuadricError) {
+					errorLimitReached = true;
+					break;
+				}
+				if (touched[c.mFrom] || touched[c.mTo]) {
+					continue;
+				}
+
+				// Reject the collapse if it would flip any of the remaining triangles:
+				bool flips = false;
+				size_t numRemovedTriangles = 0;
+				for (auto a = adjacencyOffsets[c.mFrom]; a < adjacencyOffsets[c.mFrom + 1]; ++a) {
+					const auto* tri = &indices[static_cast<size_t>(adjacency[a]) * 3];
+					if (tri[0] == c.mTo || tri[1] == c.mTo || tri[2] == c.mTo) {
+						++numRemovedTriangles;
+						continue;
+					}
+					std::array<glm::vec3, 3> before = { aPositions[tri[0]], aPositions[tri[1]], aPositions[tri[2]] };
+					std::array<glm::vec3, 3> after = before;
+					for (size_t k = 0; k < 3; ++k) {
+						if (tri[k] == c.mFrom) {
+							after[k] = aPositions[c.mTo];
+						}
+					}
+					const auto nBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+					const auto nAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+					if (glm::dot(nBefore, nAfter) <= 0.0f) {
+						flips = true;
+						break;
+					}
+				}
+				if (flips) {
+					continue;
+				}
+
+				for (auto a = adjacencyOffsets[c.mFrom]; a < adjacencyOffsets[c.mFrom + 1]; ++a) {
+					const auto* tri = &indices[static_cast<size_t>(adjacency[a]) * 3];
+					touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = true;
+				}
+				collapseTarget[c.mFrom] = c.mTo;
+				quadrics[c.mTo] += quadrics[c.mFrom];
+				maxErrorUsed = std::max(maxErrorUsed, c.mCost);
+				remainingIndices -= numRemovedTriangles * 3;
+				++numCollapses;
+			}
+
+			if (0 == numCollapses) {
+				break;
+			}
+
+			// Apply the collapses and remove the degenerate triangles:
+			size_t write = 0;
+			for (size_t t = 0; t < numTriangles; ++t) {
+				const auto i0 = collapseTarget[indices[t * 3]];
+				const auto i1 = collapseTarget[indices[t * 3 + 1]];
+				const auto i2 = collapseTarget[indices[t * 3 + 2]];
+				if (i0 == i1 || i1 == i2 || i0 == i2) {
+					continue;
+				}
+				indices[write++] = i0;
+				indices[write++] = i1;
+				indices[write++] = i2;
+			}
+			indices.resize(write);
+			if (hasBorders) {
+				collectHalfEdges(); // Border edges change when border vertices are collapsed
+			}
+		}
+
+		result.mError = static_cast<float>(std::sqrt(maxErrorUsed) / static_cast<double>(scale));
+		return result;
+	}
+}
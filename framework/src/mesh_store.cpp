@@ -0,0 +1,151 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	mesh_store mesh_store::create_from_scene(const aiScene* aScene)
+	{
+		assert(nullptr != aScene);
+		mesh_store result;
+		const auto numMeshes = static_cast<size_t>(aScene->mNumMeshes);
+		result.mMeshes.resize(numMeshes);
+
+		// Determine all the offsets first, so that the data of all the meshes can be copied in parallel afterwards:
+		uint64_t numFloats = 0;
+		uint64_t numIndices = 0;
+		uint64_t numBones = 0;
+		uint64_t numBoneWeights = 0;
+		for (size_t m = 0; m < numMeshes; ++m) {
+			const aiMesh* paiMesh = aScene->mMeshes[m];
+			auto& mesh = result.mMeshes[m];
+			mesh.mName = to_string(paiMesh->mName);
+			mesh.mMaterialIndex = paiMesh->mMaterialIndex;
+			mesh.mPrimitiveTypes = paiMesh->mPrimitiveTypes;
+			mesh.mNumVertices = paiMesh->mNumVertices;
+
+			auto allocateStream = [&](mesh_store_stream& bStream, const void* bSource, uint32_t bNumComponents) {
+				if (nullptr == bSource || 0 == bNumComponents) {
+					return;
+				}
+				bStream.mOffset = numFloats;
+				bStream.mNumComponents = bNumComponents;
+				numFloats += static_cast<uint64_t>(mesh.mNumVertices) * bNumComponents;
+			};
+			allocateStream(mesh.mPositions, paiMesh->mVertices, 3);
+			allocateStream(mesh.mNormals, paiMesh->mNormals, 3);
+			allocateStream(mesh.mTangents, paiMesh->mTangents, 3);
+			allocateStream(mesh.mBitangents, paiMesh->mBitangents, 3);
+			for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+				allocateStream(mesh.mColors[c], paiMesh->mColors[c], 4);
+			}
+			for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+				allocateStream(mesh.mTextureCoordinates[t], paiMesh->mTextureCoords[t], std::min(paiMesh->mNumUVComponents[t], 3u));
+			}
+
+			mesh.mIndicesOffset = numIndices;
+			for (unsigned int f = 0; f < paiMesh->mNumFaces; ++f) {
+				mesh.mNumIndices += paiMesh->mFaces[f].mNumIndices;
+			}
+			numIndices += mesh.mNumIndices;
+
+			mesh.mBonesOffset = numBones;
+			mesh.mNumBones = paiMesh->HasBones() ? paiMesh->mNumBones : 0u;
+			numBones += mesh.mNumBones;
+			for (unsigned int b = 0; b < mesh.mNumBones; ++b) {
+				numBoneWeights += paiMesh->mBones[b]->mNumWeights;
+			}
+		}
+		struct heap_storage
+		{
+			std::vector<float> mVertexData;
+			std::vector<uint32_t> mIndices;
+			std::vector<mesh_store_bone_weight> mBoneWeights;
+		};
+		auto storage = std::make_shared<heap_storage>();
+		storage->mVertexData.resize(static_cast<size_t>(numFloats));
+		storage->mIndices.resize(static_cast<size_t>(numIndices));
+		storage->mBoneWeights.resize(static_cast<size_t>(numBoneWeights));
+		result.mVertexData = storage->mVertexData;
+		result.mIndices = storage->mIndices;
+		result.mBoneWeights = storage->mBoneWeights;
+		result.mStorage = std::move(storage);
+		result.mBones.resize(static_cast<size_t>(numBones));
+
+		// Bone weights are laid out in mesh order, bone by bone => compute the offsets sequentially:
+		uint64_t boneWeightsOffset = 0;
+		for (size_t m = 0; m < numMeshes; ++m) {
+			const aiMesh* paiMesh = aScene->mMeshes[m];
+			const auto& mesh = result.mMeshes[m];
+			for (unsigned int b = 0; b < mesh.mNumBones; ++b) {
+				auto& bone = result.mBones[static_cast<size_t>(mesh.mBonesOffset) + b];
+				bone.mWeightsOffset = boneWeightsOffset;
+				bone.mNumWeights = paiMesh->mBones[b]->mNumWeights;
+				boneWeightsOffset += bone.mNumWeights;
+			}
+		}
+
+		std::vector<size_t> work(numMeshes);
+		std::iota(std::begin(work), std::end(work), size_t{ 0 });
+		std::for_each(std::execution::par, std::begin(work), std::end(work), [&](size_t m) {
+			const aiMesh* paiMesh = aScene->mMeshes[m];
+			const auto& mesh = result.mMeshes[m];
+			const auto n = static_cast<size_t>(mesh.mNumVertices);
+
+			// Assimp stores 3 floats per vertex for all streams but colors, regardless of how many components are actually used:
+			auto copyStream = [&](const mesh_store_stream& bStream, const float* bSource, size_t bSourceStride) {
+				float* dst = result.data(bStream);
+				if (nullptr == dst) {
+					return;
+				}
+				for (size_t i = 0; i < n; ++i) {
+					for (uint32_t c = 0; c < bStream.mNumComponents; ++c) {
+						dst[i * bStream.mNumComponents + c] = bSource[i * bSourceStride + c];
+					}
+				}
+			};
+			if (nullptr != paiMesh->mVertices) { copyStream(mesh.mPositions, &paiMesh->mVertices[0].x, 3); }
+			if (nullptr != paiMesh->mNormals) { copyStream(mesh.mNormals, &paiMesh->mNormals[0].x, 3); }
+			if (nullptr != paiMesh->mTangents) { copyStream(mesh.mTangents, &paiMesh->mTangents[0].x, 3); }
+			if (nullptr != paiMesh->mBitangents) { copyStream(mesh.mBitangents, &paiMesh->mBitangents[0].x, 3); }
+			for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+				if (nullptr != paiMesh->mColors[c]) { copyStream(mesh.mColors[c], &paiMesh->mColors[c][0].r, 4); }
+			}
+			for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+				if (nullptr != paiMesh->mTextureCoords[t]) { copyStream(mesh.mTextureCoordinates[t], &paiMesh->mTextureCoords[t][0].x, 3); }
+			}
+
+			auto* indices = result.mIndices.data() + static_cast<size_t>(mesh.mIndicesOffset);
+			for (unsigned int f = 0; f < paiMesh->mNumFaces; ++f) {
+				const aiFace& paiFace = paiMesh->mFaces[f];
+				indices = std::copy(paiFace.mIndices, paiFace.mIndices + paiFace.mNumIndices, indices);
+			}
+
+			for (unsigned int b = 0; b < mesh.mNumBones; ++b) {
+				const aiBone* paiBone = paiMesh->mBones[b];
+				auto& bone = result.mBones[static_cast<size_t>(mesh.mBonesOffset) + b];
+				bone.mName = to_string(paiBone->mName);
+				bone.mOffsetMatrix = to_mat4(paiBone->mOffsetMatrix);
+				for (unsigned int w = 0; w < paiBone->mNumWeights; ++w) {
+					result.mBoneWeights[static_cast<size_t>(bone.mWeightsOffset) + w] = mesh_store_bone_weight{ paiBone->mWeights[w].mVertexId, paiBone->mWeights[w].mWeight };
+				}
+			}
+		});
+
+		return result;
+	}
+
+	size_t mesh_store::size_in_bytes() const
+	{
+		size_t result = mMeshes.size() * sizeof(mesh_store_mesh)
+			+ mVertexData.size() * sizeof(float)
+			+ mIndices.size() * sizeof(uint32_t)
+			+ mBones.size() * sizeof(mesh_store_bone)
+			+ mBoneWeights.size() * sizeof(mesh_store_bone_weight);
+		for (const auto& mesh : mMeshes) {
+			result += mesh.mName.capacity();
+		}
+		for (const auto& bone : mBones) {
+			result += bone.mName.capacity();
+		}
+		return result;
+	}
+}
@@ -0,0 +1,197 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Ritter's bounding sphere: not minimal, but close and linear in the number of points.
+	static void compute_bounding_sphere(meshlet& aMeshlet, const uint32_t* aVertexIndices, const std::vector<glm::vec3>& aPositions)
+	{
+		const auto n = aMeshlet.mVertexCount;
+		auto farthestFrom = [&](const glm::vec3& bPoint) {
+			glm::vec3 farthest = aPositions[aVertexIndices[0]];
+			float maxDistSq = -1.0f;
+			for (uint32_t i = 0; i < n; ++i) {
+				const auto& p = aPositions[aVertexIndices[i]];
+				const auto d = p - bPoint;
+				const float distSq = glm::dot(d, d);
+				if (distSq > maxDistSq) {
+					maxDistSq = distSq;
+					farthest = p;
+				}
+			}
+			return farthest;
+		};
+
+		const auto a = farthestFrom(aPositions[aVertexIndices[0]]);
+		const auto b = farthestFrom(a);
+		glm::vec3 center = (a + b) * 0.5f;
+		float radius = glm::length(b - a) * 0.5f;
+		for (uint32_t i = 0; i < n; ++i) {
+			const auto& p = aPositions[aVertexIndices[i]];
+			const float dist = glm::length(p - center);
+			if (dist > radius) {
+				// Grow the sphere just enough to contain p:
+				const float newRadius = (radius + dist) * 0.5f;
+				center += (p - center) * ((newRadius - radius) / dist);
+				radius = newRadius;
+			}
+		}
+		aMeshlet.mCenter = center;
+		aMeshlet.mRadius = radius;
+	}
+
+	static void compute_normal_cone(meshlet& aMeshlet, const uint32_t* aVertexIndices, const uint8_t* aPrimitiveIndices, const std::vector<glm::vec3>& aPositions)
+	{
+		aMeshlet.mConeAxis = glm::vec3{ 0.0f, 0.0f, 1.0f };
+		aMeshlet.mConeCutoff = 1.0f;
+		aMeshlet.mConeApex = aMeshlet.mCenter;
+
+		// All of the meshlet's triangles must be considered, otherwise the cone could cull visible ones:
+		const auto n = aMeshlet.mPrimitiveCount;
+		std::vector<glm::vec3> normals(n);
+		std::vector<glm::vec3> firstVertices(n);
+		glm::vec3 axis{ 0.0f };
+		uint32_t numValid = 0;
+		for (uint32_t t = 0; t < n; ++t) {
+			const auto& p0 = aPositions[aVertexIndices[aPrimitiveIndices[t * 3]]];
+			const auto& p1 = aPositions[aVertexIndices[aPrimitiveIndices[t * 3 + 1]]];
+			const auto& p2 = aPositions[aVertexIndices[aPrimitiveIndices[t * 3 + 2]]];
+			const auto normal = glm::cross(p1 - p0, p2 - p0);
+			const float length = glm::length(normal);
+			if (length <= 0.0f) {
+				continue; // Degenerate triangles do not constrain the cone
+			}
+			normals[numValid] = normal / length;
+			firstVertices[numValid] = p0;
+			axis += normals[numValid];
+			++numValid;
+		}
+		const float axisLength = glm::length(axis);
+		if (0 == numValid || axisLength <= 0.0f) {
+			return;
+		}
+		axis /= axisLength;
+
+		float minDot = 1.0f;
+		for (uint32_t t = 0; t < numValid; ++t) {
+			minDot = std::min(minDot, glm::dot(normals[t], axis));
+		}
+		if (minDot <= 0.0f) {
+			return; // Cone is wider than a hemisphere => can not be used for culling
+		}
+
+		// Move the apex back along the axis, so that all triangles' planes are in front of it:
+		float maxT = 0.0f;
+		for (uint32_t t = 0; t < numValid; ++t) {
+			const float distanceToPlane = glm::dot(aMeshlet.mCenter - firstVertices[t], normals[t]);
+			const float t0 = distanceToPlane / glm::dot(axis, normals[t]);
+			maxT = std::max(maxT, t0);
+		}
+
+		aMeshlet.mConeAxis = axis;
+		aMeshlet.mConeCutoff = std::sqrt(1.0f - minDot * minDot);
+		aMeshlet.mConeApex = aMeshlet.mCenter - axis * maxT;
+	}
+
+	meshlet_data build_meshlets(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, uint32_t aMaxVertices, uint32_t aMaxPrimitives)
+	{
+		if (aMaxVertices < 3 || aMaxVertices > 256) {
+			throw gvk::logic_error(fmt::format("The maximum number of vertices per meshlet must be in the range [3, 256], but is {}.", aMaxVertices));
+		}
+		if (0 == aMaxPrimitives) {
+			throw gvk::logic_error("The maximum number of primitives per meshlet must be greater than zero.");
+		}
+		assert(aIndices.size() % 3 == 0);
+
+		meshlet_data result;
+		const size_t numTriangles = aIndices.size() / 3;
+
+		// Meshlet-local index of every vertex of the meshlet which is currently being built, 0xFF for vertices which are not part of it:
+		constexpr uint8_t notInMeshlet = 0xFF;
+		std::vector<uint8_t> localIndices(aPositions.size(), notInMeshlet);
+		// ...which does not work for the 256th vertex => track it separately:
+		std::optional<uint32_t> vertexWithLocalIndex255;
+		auto localIndexOf = [&](uint32_t bVertex) -> std::optional<uint8_t> {
+			if (notInMeshlet != localIndices[bVertex]) {
+				return localIndices[bVertex];
+			}
+			if (vertexWithLocalIndex255.has_value() && vertexWithLocalIndex255.value() == bVertex) {
+				return notInMeshlet;
+			}
+			return {};
+		};
+
+		meshlet current;
+		auto finishCurrent = [&]() {
+			if (0 == current.mPrimitiveCount) {
+				return;
+			}
+			compute_bounding_sphere(current, &result.mVertexIndices[current.mVertexOffset], aPositions);
+			compute_normal_cone(current, &result.mVertexIndices[current.mVertexOffset], &result.mPrimitiveIndices[current.mPrimitiveOffset], aPositions);
+			for (uint32_t i = 0; i < current.mVertexCount; ++i) {
+				localIndices[result.mVertexIndices[current.mVertexOffset + i]] = notInMeshlet;
+			}
+			vertexWithLocalIndex255.reset();
+			result.mMeshlets.push_back(current);
+
+			current = meshlet{};
+			current.mVertexOffset = static_cast<uint32_t>(result.mVertexIndices.size());
+			current.mPrimitiveOffset = static_cast<uint32_t>(result.mPrimitiveIndices.size());
+		};
+
+		for (size_t t = 0; t < numTriangles; ++t) {
+			const uint32_t* tri = &aIndices[t * 3];
+			uint32_t numNewVertices = 0;
+			for (size_t k = 0; k < 3; ++k) {
+				// Count each new vertex only once, even if the triangle is degenerate:
+				const bool isDuplicate = (k > 0 && tri[k] == tri[0]) || (k > 1 && tri[k] == tri[1]);
+				if (!isDuplicate && !localIndexOf(tri[k]).has_value()) {
+					++numNewVertices;
+				}
+			}
+			if (current.mVertexCount + numNewVertices > aMaxVertices || current.mPrimitiveCount + 1 > aMaxPrimitives) {
+				finishCurrent();
+			}
+
+			for (size_t k = 0; k < 3; ++k) {
+				auto local = localIndexOf(tri[k]);
+				if (!local.has_value()) {
+					local = static_cast<uint8_t>(current.mVertexCount);
+					if (notInMeshlet == local.value()) {
+						vertexWithLocalIndex255 = tri[k];
+					}
+					else {
+						localIndices[tri[k]] = local.value();
+					}
+					result.mVertexIndices.push_back(tri[k]);
+					++current.mVertexCount;
+				}
+				result.mPrimitiveIndices.push_back(local.value());
+			}
+			++current.mPrimitiveCount;
+		}
+		finishCurrent();
+
+		return result;
+	}
+
+	void append_meshlets(meshlet_data& aTarget, const meshlet_data& aSource, uint32_t aVertexIndexOffset, uint32_t aMeshIndexInSelection)
+	{
+		const auto vertexOffset = static_cast<uint32_t>(aTarget.mVertexIndices.size());
+		const auto primitiveOffset = static_cast<uint32_t>(aTarget.mPrimitiveIndices.size());
+
+		aTarget.mMeshlets.reserve(aTarget.mMeshlets.size() + aSource.mMeshlets.size());
+		for (auto m : aSource.mMeshlets) {
+			m.mVertexOffset += vertexOffset;
+			m.mPrimitiveOffset += primitiveOffset;
+			m.mMeshIndexInSelection = aMeshIndexInSelection;
+			aTarget.mMeshlets.push_back(m);
+		}
+
+		aTarget.mVertexIndices.reserve(aTarget.mVertexIndices.size() + aSource.mVertexIndices.size());
+		for (auto index : aSource.mVertexIndices) {
+			aTarget.mVertexIndices.push_back(index + aVertexIndexOffset);
+		}
+
+		aTarget.mPrimitiveIndices.insert(std::end(aTarget.mPrimitiveIndices), std::begin(aSource.mPrimitiveIndices), std::end(aSource.mPrimitiveIndices));
+	}
+}
@@ -4,20 +4,60 @@
 namespace gvk
 {
 
-	avk::owning_resource<model_t> model_t::load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags)
+	avk::owning_resource<model_t> model_t::load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags, bool aReleaseScene, const load_progress_callback& aProgressCallback)
 	{
 		model_t result;
 		result.mModelPath = avk::clean_up_path(aPath);
 		result.mImporter = std::make_unique<Assimp::Importer>();
-		result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags);
+		// Read all files through the virtual file system; the importer takes ownership of the IO system:
+		result.mImporter->SetIOHandler(new vfs_io_system(virtual_file_system::shared()));
+		std::unique_ptr<load_progress_handler> progressHandler;
+		if (aProgressCallback) {
+			progressHandler = std::make_unique<load_progress_handler>(aProgressCallback);
+			result.mImporter->SetProgressHandler(progressHandler.get());
+		}
+		try {
+			result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags);
+		}
+		catch (...) {
+			// Unregister the handler on every path, otherwise the importer would use or delete it after it has been freed:
+			if (progressHandler) {
+				result.mImporter->SetProgressHandler(nullptr);
+			}
+			throw;
+		}
+		if (progressHandler) {
+			// Hand the handler back, otherwise the importer would delete it:
+			result.mImporter->SetProgressHandler(nullptr);
+		}
 		if (nullptr == result.mScene) {
+			if (progressHandler && progressHandler->was_cancelled()) {
+				throw gvk::runtime_error(fmt::format("Loading model from '{}' has been cancelled.", aPath));
+			}
 			throw gvk::runtime_error(fmt::format("Loading model from '{}' failed.", aPath));
 		}
 		result.initialize_materials();
+		result.initialize_node_table();
+		result.initialize_animations();
+		result.initialize_morph_targets();
+		result.initialize_caches();
+		if (aReleaseScene) {
+			result.release_scene();
+		}
 		return result;
 	}
 	
-	avk::owning_resource<model_t> model_t::load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags)
+	async_load<avk::owning_resource<model_t>> model_t::load_from_file_async(const std::string& aPath, aiProcessFlagsType aAssimpFlags, bool aReleaseScene, std::function<void(float)> aOnProgress)
+	{
+		return async_load<avk::owning_resource<model_t>>::launch(
+			[aPath, aAssimpFlags, aReleaseScene](const load_progress_callback& bProgressCallback) {
+				return load_from_file(aPath, aAssimpFlags, aReleaseScene, bProgressCallback);
+			},
+			std::move(aOnProgress)
+		);
+	}
+	
+	avk::owning_resource<model_t> model_t::load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags, bool aReleaseScene)
 	{
 		model_t result;
 		result.mModelPath = "";
@@ -27,10 +67,41 @@ namespace gvk
 			throw gvk::runtime_error("Loading model from memory failed.");
 		}
 		result.initialize_materials();
+		result.initialize_node_table();
+		result.initialize_animations();
+		result.initialize_morph_targets();
+		result.initialize_caches();
+		if (aReleaseScene) {
+			result.release_scene();
+		}
 		return result;
 	}
 
 	
+	void model_t::release_scene()
+	{
+		if (!has_scene()) {
+			return;
+		}
+		const auto n = num_meshes();
+
+		// Everything which is still read from Assimp's data structures has to be converted before releasing them:
+		for (mesh_index_t i = 0; i < n; ++i) {
+			material_config_for_mesh(i);
+		}
+		mMaterialNames.clear();
+		for (unsigned int i = 0; i < mScene->mNumMaterials; ++i) {
+			mMaterialNames.push_back(name_of_material(i));
+		}
+		mLights = lights();
+		mCameras = cameras();
+		mMeshStore = mesh_store::create_from_scene(mScene);
+
+		LOG_INFO(fmt::format("Converted {} meshes of model '{}' into a compact mesh store of {:.1f} MiB and released Assimp's scene.", n, mModelPath, static_cast<double>(mMeshStore->size_in_bytes()) / (1024.0 * 1024.0)));
+		mScene = nullptr;
+		mImporter.reset();
+	}
+
 	void model_t::initialize_materials()
 	{
 		auto n = static_cast<size_t>(mScene->mNumMeshes);
@@ -40,54 +111,171 @@ namespace gvk
 		}
 	}
 
-	aiNode* model_t::find_mesh_root_node(unsigned int aMeshIndexToFind) const
+	void model_t::initialize_caches()
 	{
-		return mesh_node_traverser(aMeshIndexToFind, mScene->mRootNode);
+		mCacheMutex = std::make_unique<std::mutex>();
+		mMaterialMutex = std::make_unique<std::recursive_mutex>();
+		mBoneInfluencesPerMesh.resize(static_cast<size_t>(num_meshes()));
+		mBoundingVolumesPerMesh.resize(static_cast<size_t>(num_meshes()));
+		mTangentSpacePerMesh.resize(static_cast<size_t>(num_meshes()));
+		mMaterialIdPerMesh.assign(static_cast<size_t>(num_meshes()), std::nullopt);
+		mLodsPerMesh.resize(static_cast<size_t>(num_meshes()));
 	}
-	
-	aiNode* model_t::mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const
+
+	void model_t::initialize_node_table()
 	{
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return aNode;
+		mNodeNames.clear();
+		mNodeLocalTransforms.clear();
+		mNodeParentIndices.clear();
+		mNodeMeshIndices.clear();
+
+		// Depth-first traversal with an explicit stack, so that also deep hierarchies can be handled.
+		// Children are pushed in reverse order to get the same (pre-)order as a recursive traversal.
+		std::stack<std::tuple<aiNode*, std::optional<size_t>>> toVisit;
+		toVisit.emplace(mScene->mRootNode, std::optional<size_t>{});
+		while (!toVisit.empty()) {
+			auto [node, parentIndex] = toVisit.top();
+			toVisit.pop();
+
+			const auto nodeIndex = mNodeNames.size();
+			mNodeNames.push_back(to_string(node->mName));
+			mNodeLocalTransforms.push_back(to_mat4(node->mTransformation));
+			mNodeParentIndices.push_back(parentIndex);
+			mNodeMeshIndices.emplace_back(node->mMeshes, node->mMeshes + node->mNumMeshes);
+
+			for (unsigned int i = node->mNumChildren; i > 0; --i) {
+				toVisit.emplace(node->mChildren[i - 1], nodeIndex);
 			}
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto* node = mesh_node_traverser(aMeshIndexToFind, aNode->mChildren[i]);
-			if (nullptr != node) {
-				return node;
+
+		initialize_node_lookups();
+	}
+
+	void model_t::initialize_node_lookups()
+	{
+		const auto numNodes = mNodeNames.size();
+		mNodeGlobalTransforms.clear();
+		mNodeGlobalTransforms.reserve(numNodes);
+		mNodeIndicesByName.clear();
+		mMeshNodeIndices.assign(static_cast<size_t>(num_meshes()), std::optional<size_t>{});
+
+		for (size_t nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex) {
+			// Parents always come before their children => their global transforms are known already:
+			const auto& parentIndex = mNodeParentIndices[nodeIndex];
+			mNodeGlobalTransforms.push_back(parentIndex.has_value() ? mNodeGlobalTransforms[parentIndex.value()] * mNodeLocalTransforms[nodeIndex] : mNodeLocalTransforms[nodeIndex]);
+			// Lights and cameras have always been attached to the first node with a given name, animations to the last one (in depth-first order):
+			mNodeIndicesByName.try_emplace(mNodeNames[nodeIndex], nodeIndex, nodeIndex).first->second.second = nodeIndex;
+			for (auto meshIndex : mNodeMeshIndices[nodeIndex]) {
+				auto& meshNodeIndex = mMeshNodeIndices[meshIndex];
+				if (!meshNodeIndex.has_value()) {
+					meshNodeIndex = nodeIndex;
+				}
 			}
 		}
-		return nullptr;
 	}
-	
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const
+
+	void model_t::initialize_animations()
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return to_mat4(nodeM);
+		mAnimationTracks.clear();
+		mAnimationTracks.reserve(static_cast<size_t>(mScene->mNumAnimations));
+		for (unsigned int a = 0; a < mScene->mNumAnimations; ++a) {
+			const aiAnimation* paiAnimation = mScene->mAnimations[a];
+			auto& tracks = mAnimationTracks.emplace_back();
+			tracks.mName = to_string(paiAnimation->mName);
+			tracks.mTicksPerSecond = paiAnimation->mTicksPerSecond;
+			tracks.mDurationTicks = paiAnimation->mDuration;
+			tracks.mChannels.reserve(static_cast<size_t>(paiAnimation->mNumChannels));
+			for (unsigned int c = 0; c < paiAnimation->mNumChannels; ++c) {
+				const aiNodeAnim* paiChannel = paiAnimation->mChannels[c];
+				auto& channel = tracks.mChannels.emplace_back();
+				channel.mNodeName = to_string(paiChannel->mNodeName);
+				channel.mPositionKeys.reserve(static_cast<size_t>(paiChannel->mNumPositionKeys));
+				for (unsigned int i = 0; i < paiChannel->mNumPositionKeys; ++i) {
+					channel.mPositionKeys.push_back(position_key{ paiChannel->mPositionKeys[i].mTime, to_vec3(paiChannel->mPositionKeys[i].mValue) });
+				}
+				channel.mRotationKeys.reserve(static_cast<size_t>(paiChannel->mNumRotationKeys));
+				for (unsigned int i = 0; i < paiChannel->mNumRotationKeys; ++i) {
+					// normalize the quaternion, just to be on the safe side
+					channel.mRotationKeys.push_back(rotation_key{ paiChannel->mRotationKeys[i].mTime, glm::normalize(to_quat(paiChannel->mRotationKeys[i].mValue)) });
+				}
+				channel.mScalingKeys.reserve(static_cast<size_t>(paiChannel->mNumScalingKeys));
+				for (unsigned int i = 0; i < paiChannel->mNumScalingKeys; ++i) {
+					channel.mScalingKeys.push_back(scaling_key{ paiChannel->mScalingKeys[i].mTime, to_vec3(paiChannel->mScalingKeys[i].mValue) });
+				}
 			}
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser(aMeshIndexToFind, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
+	}
+
+	void model_t::initialize_morph_targets()
+	{
+		const auto n = static_cast<size_t>(mScene->mNumMeshes);
+		mMorphTargetsPerMesh.clear();
+		mMorphTargetsPerMesh.resize(n);
+		std::vector<size_t> work(n);
+		std::iota(std::begin(work), std::end(work), size_t{ 0 });
+		// Exceptions (e.g. failed allocations for large assets) must not escape the parallel loop; the first one is rethrown after all meshes have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(work), std::end(work), [&](size_t i) {
+			try {
+				const aiMesh* paiMesh = mScene->mMeshes[i];
+				if (paiMesh->mNumAnimMeshes > 0) {
+					mMorphTargetsPerMesh[i] = morph_target_set::create_from_mesh(paiMesh);
+				}
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
 			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+
+		size_t numTargets = 0, numDeltas = 0, sizeInBytes = 0;
+		for (const auto& targets : mMorphTargetsPerMesh) {
+			numTargets += targets.mTargets.size();
+			numDeltas += targets.num_deltas();
+			sizeInBytes += targets.size_in_bytes();
+		}
+		if (numTargets > 0) {
+			LOG_INFO(fmt::format("Extracted {} morph targets with {} sparse deltas ({:.1f} MiB) from model '{}'.", numTargets, numDeltas, static_cast<double>(sizeInBytes) / (1024.0 * 1024.0), mModelPath));
+		}
+	}
+
+	std::optional<size_t> model_t::node_index_by_name(const std::string& aNodeName) const
+	{
+		const auto it = mNodeIndicesByName.find(aNodeName);
+		if (std::end(mNodeIndicesByName) == it) {
+			return {};
 		}
-		return {};
+		return it->second.first;
+	}
+
+	std::optional<size_t> model_t::last_node_index_by_name(const std::string& aNodeName) const
+	{
+		const auto it = mNodeIndicesByName.find(aNodeName);
+		if (std::end(mNodeIndicesByName) == it) {
+			return {};
+		}
+		return it->second.second;
+	}
+
+	std::optional<size_t> model_t::node_index_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(aMeshIndex < mMeshNodeIndices.size());
+		return mMeshNodeIndices[aMeshIndex];
 	}
 
 	glm::mat4 model_t::transformation_matrix_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		// Find the mesh in Assim's node hierarchy
-		return transformation_matrix_traverser(static_cast<unsigned int>(aMeshIndex), mScene->mRootNode, aiMatrix4x4{}).value();
+		const auto nodeIndex = node_index_for_mesh(aMeshIndex);
+		if (!nodeIndex.has_value()) {
+			throw gvk::runtime_error(fmt::format("The mesh at index {} is not referenced by any node.", aMeshIndex));
+		}
+		return mNodeGlobalTransforms[nodeIndex.value()];
 	}
 
 	glm::mat4 model_t::mesh_root_matrix(mesh_index_t aMeshIndex) const
@@ -95,9 +283,77 @@ namespace gvk
 		return transformation_matrix_for_mesh(aMeshIndex);
 	}
 
+	const bounding_box& model_t::bounding_box_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		return std::get<bounding_box>(bounding_volumes_for_mesh(aMeshIndex));
+	}
+
+	const bounding_sphere& model_t::bounding_sphere_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		return std::get<bounding_sphere>(bounding_volumes_for_mesh(aMeshIndex));
+	}
+
+	const std::tuple<bounding_box, bounding_sphere>& model_t::bounding_volumes_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(aMeshIndex < mBoundingVolumesPerMesh.size());
+		{
+			std::scoped_lock guard(*mCacheMutex);
+			if (mBoundingVolumesPerMesh[aMeshIndex].has_value()) {
+				return mBoundingVolumesPerMesh[aMeshIndex].value();
+			}
+		}
+		// Compute without holding the lock, so that multiple meshes can be processed concurrently.
+		// Operate directly on the vertex positions, which are tightly packed float triples both in Assimp's scene and in the mesh store:
+		static_assert(sizeof(aiVector3D) == sizeof(glm::vec3));
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::position);
+		assert(nullptr == stream.mData || 3 == stream.mStride);
+		const auto* positions = reinterpret_cast<const glm::vec3*>(stream.mData);
+		const auto n = nullptr == stream.mData ? size_t{ 0 } : number_of_vertices_for_mesh(aMeshIndex);
+		const auto box = compute_bounding_box(positions, n);
+		const auto sphere = compute_bounding_sphere(positions, n, box);
+
+		std::scoped_lock guard(*mCacheMutex);
+		auto& cached = mBoundingVolumesPerMesh[aMeshIndex];
+		if (!cached.has_value()) {
+			cached = std::make_tuple(box, sphere);
+		}
+		return cached.value();
+	}
+
+	bounding_box model_t::transformed_bounding_box_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		return bounding_box_for_mesh(aMeshIndex).transformed(mesh_root_matrix(aMeshIndex));
+	}
+
+	bounding_sphere model_t::transformed_bounding_sphere_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		return bounding_sphere_for_mesh(aMeshIndex).transformed(mesh_root_matrix(aMeshIndex));
+	}
+
+	bounding_box model_t::bounding_box_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, bool aApplyMeshRootMatrices) const
+	{
+		bounding_box result;
+		for (auto meshIndex : aMeshIndices) {
+			result = result.merged(aApplyMeshRootMatrices ? transformed_bounding_box_for_mesh(meshIndex) : bounding_box_for_mesh(meshIndex));
+		}
+		return result;
+	}
+
+	bounding_sphere model_t::bounding_sphere_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, bool aApplyMeshRootMatrices) const
+	{
+		bounding_sphere result;
+		for (auto meshIndex : aMeshIndices) {
+			result = result.merged(aApplyMeshRootMatrices ? transformed_bounding_sphere_for_mesh(meshIndex) : bounding_sphere_for_mesh(meshIndex));
+		}
+		return result;
+	}
+
 	uint32_t model_t::num_actual_bones(mesh_index_t aMeshIndex) const
 	{
-		assert(mScene->mNumMeshes > aMeshIndex && 0 <= aMeshIndex);
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
+		if (!has_scene()) {
+			return mMeshStore->mMeshes[aMeshIndex].mNumBones;
+		}
 		if (!mScene->mMeshes[aMeshIndex]->HasBones()) {
 			return 0u;
 		}
@@ -120,14 +376,14 @@ namespace gvk
 	
 	std::vector<glm::mat4> model_t::inverse_bind_pose_matrices(mesh_index_t aMeshIndex, bone_matrices_space aSourceSpace) const
 	{
-		assert(mScene->mNumMeshes > aMeshIndex && 0 <= aMeshIndex);
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
 		std::vector<glm::mat4> result;
-		if (mScene->mMeshes[aMeshIndex]->HasBones()) {
-			auto nb = mScene->mMeshes[aMeshIndex]->mNumBones;
+		if (num_actual_bones(aMeshIndex) > 0) {
+			auto nb = num_actual_bones(aMeshIndex);
 			switch (aSourceSpace) {
 			case bone_matrices_space::mesh_space:
 				for (decltype(nb) i = 0; i < nb; ++i) {
-					result.push_back(to_mat4(mScene->mMeshes[aMeshIndex]->mBones[i]->mOffsetMatrix));
+					result.push_back(offset_matrix_of_bone(aMeshIndex, i));
 				}
 				break;
 			case bone_matrices_space::model_space:
@@ -136,7 +392,7 @@ namespace gvk
 					const auto inverseMeshRootMatrix = glm::inverse(meshRootMatrix);
 				
 					for (decltype(nb) i = 0; i < nb; ++i) {
-						result.push_back(meshRootMatrix * to_mat4(mScene->mMeshes[aMeshIndex]->mBones[i]->mOffsetMatrix) * inverseMeshRootMatrix);
+						result.push_back(meshRootMatrix * offset_matrix_of_bone(aMeshIndex, i) * inverseMeshRootMatrix);
 					}
 				}
 				break;
@@ -152,18 +408,205 @@ namespace gvk
 
 	std::string model_t::name_of_mesh(mesh_index_t aMeshIndex) const
 	{
-		assert(mScene->mNumMeshes > aMeshIndex && 0 <= aMeshIndex);
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
+		if (!has_scene()) {
+			return mMeshStore->mMeshes[aMeshIndex].mName;
+		}
 		return mScene->mMeshes[aMeshIndex]->mName.data;
 	}
 
 	size_t model_t::material_index_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		assert(mScene->mNumMeshes > aMeshIndex && 0 <= aMeshIndex);
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
+		if (!has_scene()) {
+			return mMeshStore->mMeshes[aMeshIndex].mMaterialIndex;
+		}
 		return mScene->mMeshes[aMeshIndex]->mMaterialIndex;
 	}
 
+	uint32_t model_t::primitive_types_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
+		if (!has_scene()) {
+			return mMeshStore->mMeshes[aMeshIndex].mPrimitiveTypes;
+		}
+		return mScene->mMeshes[aMeshIndex]->mPrimitiveTypes;
+	}
+
+	std::string model_t::name_of_bone(mesh_index_t aMeshIndex, uint32_t aBoneIndex) const
+	{
+		assert(aBoneIndex < num_actual_bones(aMeshIndex));
+		if (!has_scene()) {
+			return mMeshStore->mBones[static_cast<size_t>(mMeshStore->mMeshes[aMeshIndex].mBonesOffset) + aBoneIndex].mName;
+		}
+		return to_string(mScene->mMeshes[aMeshIndex]->mBones[aBoneIndex]->mName);
+	}
+
+	glm::mat4 model_t::offset_matrix_of_bone(mesh_index_t aMeshIndex, uint32_t aBoneIndex) const
+	{
+		assert(aBoneIndex < num_actual_bones(aMeshIndex));
+		if (!has_scene()) {
+			return mMeshStore->mBones[static_cast<size_t>(mMeshStore->mMeshes[aMeshIndex].mBonesOffset) + aBoneIndex].mOffsetMatrix;
+		}
+		return to_mat4(mScene->mMeshes[aMeshIndex]->mBones[aBoneIndex]->mOffsetMatrix);
+	}
+
+	model_t::vertex_stream model_t::vertex_stream_for_mesh(mesh_index_t aMeshIndex, vertex_attribute aAttribute, int aSet) const
+	{
+		assert(num_meshes() > aMeshIndex && 0 <= aMeshIndex);
+		// Meshes without tangents are served generated ones, if they can be generated:
+		auto generatedStream = [this, aMeshIndex](vertex_attribute bAttribute) {
+			auto generated = tangent_space_for_mesh(aMeshIndex);
+			if (!generated) {
+				return vertex_stream{};
+			}
+			const auto& data = vertex_attribute::tangent == bAttribute ? generated->mTangents : generated->mBitangents;
+			return vertex_stream{ reinterpret_cast<const float*>(data.data()), 3, 3, std::move(generated) };
+		};
+
+		if (!has_scene()) {
+			const auto& mesh = mMeshStore->mMeshes[aMeshIndex];
+			auto fromStore = [this](const mesh_store_stream& bStream) {
+				return vertex_stream{ mMeshStore->data(bStream), bStream.mNumComponents, bStream.mNumComponents };
+			};
+			switch (aAttribute) {
+			case vertex_attribute::position:
+				return fromStore(mesh.mPositions);
+			case vertex_attribute::normal:
+				return fromStore(mesh.mNormals);
+			case vertex_attribute::tangent:
+				return 0 != mesh.mTangents.mNumComponents ? fromStore(mesh.mTangents) : generatedStream(aAttribute);
+			case vertex_attribute::bitangent:
+				return 0 != mesh.mTangents.mNumComponents ? fromStore(mesh.mBitangents) : generatedStream(aAttribute);
+			case vertex_attribute::color:
+				assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_COLOR_SETS);
+				return fromStore(mesh.mColors[aSet]);
+			case vertex_attribute::texture_coordinates_2d:
+			case vertex_attribute::texture_coordinates_2d_flipped:
+			case vertex_attribute::texture_coordinates_3d:
+				assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+				return fromStore(mesh.mTextureCoordinates[aSet]);
+			default:
+				throw gvk::logic_error("Unsupported vertex_attribute");
+			}
+		}
+
+		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
+		auto fromScene = [](const auto* bSource, size_t bStride, size_t bNumComponents) {
+			return nullptr == bSource ? vertex_stream{} : vertex_stream{ reinterpret_cast<const float*>(bSource), bStride, bNumComponents };
+		};
+		switch (aAttribute) {
+		case vertex_attribute::position:
+			return fromScene(paiMesh->mVertices, 3, 3);
+		case vertex_attribute::normal:
+			return fromScene(paiMesh->mNormals, 3, 3);
+		case vertex_attribute::tangent:
+			return nullptr != paiMesh->mTangents ? fromScene(paiMesh->mTangents, 3, 3) : generatedStream(aAttribute);
+		case vertex_attribute::bitangent:
+			return nullptr != paiMesh->mTangents ? fromScene(paiMesh->mBitangents, 3, 3) : generatedStream(aAttribute);
+		case vertex_attribute::color:
+			assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_COLOR_SETS);
+			return fromScene(paiMesh->mColors[aSet], 4, 4);
+		case vertex_attribute::texture_coordinates_2d:
+		case vertex_attribute::texture_coordinates_2d_flipped:
+		case vertex_attribute::texture_coordinates_3d:
+			assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+			return fromScene(paiMesh->mTextureCoords[aSet], 3, static_cast<size_t>(paiMesh->mNumUVComponents[aSet]));
+		default:
+			throw gvk::logic_error("Unsupported vertex_attribute");
+		}
+	}
+
+	bool model_t::has_source_tangents(mesh_index_t aMeshIndex) const
+	{
+		return has_scene() ? nullptr != mScene->mMeshes[aMeshIndex]->mTangents : 0 != mMeshStore->mMeshes[aMeshIndex].mTangents.mNumComponents;
+	}
+
+	std::optional<tangent_space> model_t::compute_tangent_space(mesh_index_t aMeshIndex, int aTexCoordSet) const
+	{
+		if (aiPrimitiveType_TRIANGLE != primitive_types_for_mesh(aMeshIndex) || 0 == number_of_vertices_for_mesh(aMeshIndex)
+			|| nullptr == vertex_stream_for_mesh(aMeshIndex, vertex_attribute::normal).mData
+			|| nullptr == vertex_stream_for_mesh(aMeshIndex, vertex_attribute::texture_coordinates_2d, aTexCoordSet).mData) {
+			return {};
+		}
+		return generate_tangent_space(indices_for_mesh<uint32_t>(aMeshIndex), positions_for_mesh(aMeshIndex), normals_for_mesh(aMeshIndex), texture_coordinates_for_mesh<glm::vec2>(aMeshIndex, aTexCoordSet));
+	}
+
+	std::shared_ptr<const tangent_space> model_t::tangent_space_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(aMeshIndex < mTangentSpacePerMesh.size());
+		{
+			std::scoped_lock guard(*mCacheMutex);
+			if (mTangentSpacePerMesh[aMeshIndex]) {
+				return mTangentSpacePerMesh[aMeshIndex];
+			}
+		}
+		// Generate without holding the lock, so that multiple meshes can be processed concurrently:
+		auto generated = compute_tangent_space(aMeshIndex, 0);
+		if (!generated.has_value()) {
+			return nullptr;
+		}
+		std::scoped_lock guard(*mCacheMutex);
+		auto& cached = mTangentSpacePerMesh[aMeshIndex];
+		if (!cached) {
+			cached = std::make_shared<const tangent_space>(std::move(generated.value()));
+		}
+		return cached;
+	}
+
+	void model_t::generate_tangents(const std::vector<mesh_index_t>& aMeshIndices, int aTexCoordSet)
+	{
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(aMeshIndices), std::end(aMeshIndices), [&](mesh_index_t bMeshIndex) {
+			try {
+				if (has_source_tangents(bMeshIndex)) {
+					return;
+				}
+				auto generated = compute_tangent_space(bMeshIndex, aTexCoordSet);
+				if (!generated.has_value()) {
+					LOG_WARNING(fmt::format("Can not generate tangents for mesh {} of model '{}', because it does not consist of triangles with normals and texture coordinates of set {}.", bMeshIndex, mModelPath, aTexCoordSet));
+					return;
+				}
+				std::scoped_lock guard(*mCacheMutex);
+				mTangentSpacePerMesh[bMeshIndex] = std::make_shared<const tangent_space>(std::move(generated.value()));
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	std::shared_ptr<const tangent_space> model_t::generated_tangents_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(aMeshIndex < mTangentSpacePerMesh.size());
+		std::scoped_lock guard(*mCacheMutex);
+		return mTangentSpacePerMesh[aMeshIndex];
+	}
+
+	void model_t::set_generated_tangents_for_mesh(mesh_index_t aMeshIndex, tangent_space aTangentSpace)
+	{
+		assert(aMeshIndex < mTangentSpacePerMesh.size());
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
+		if (aTangentSpace.mTangents.size() != n || aTangentSpace.mBitangents.size() != n) {
+			throw gvk::logic_error(fmt::format("Mesh {} has {} vertices, but {} tangents and {} bitangents have been passed.", aMeshIndex, n, aTangentSpace.mTangents.size(), aTangentSpace.mBitangents.size()));
+		}
+		std::scoped_lock guard(*mCacheMutex);
+		mTangentSpacePerMesh[aMeshIndex] = std::make_shared<const tangent_space>(std::move(aTangentSpace));
+	}
+
 	std::string model_t::name_of_material(size_t aMaterialIndex) const
 	{
+		if (!has_scene()) {
+			return aMaterialIndex < mMaterialNames.size() ? mMaterialNames[aMaterialIndex] : "";
+		}
 		aiMaterial* pMaterial = mScene->mMaterials[aMaterialIndex];
 		if (!pMaterial) return "";
 		aiString name;
@@ -173,8 +616,9 @@ namespace gvk
 			return "";
 	}
 
-	material_config model_t::material_config_for_mesh(mesh_index_t aMeshIndex)
+	material_config model_t::material_config_for_mesh(mesh_index_t aMeshIndex) const
 	{
+		std::scoped_lock guard(*mMaterialMutex);
 		assert (mMaterialConfigPerMesh.size() > aMeshIndex);
 		if (mMaterialConfigPerMesh[aMeshIndex].has_value()) {
 			return mMaterialConfigPerMesh[aMeshIndex].value();
@@ -189,6 +633,8 @@ namespace gvk
 		float floatVal;
 		aiTextureMapping texMapping;
 
+		// All material configs have been converted in release_scene, i.e. reaching this point requires Assimp's scene:
+		assert(has_scene());
 		auto materialIndex = material_index_for_mesh(aMeshIndex);
 		assert(materialIndex <= mScene->mNumMaterials);
 		aiMaterial* aimat = mScene->mMaterials[materialIndex];
@@ -359,60 +805,102 @@ namespace gvk
 
 	void model_t::set_material_config_for_mesh(mesh_index_t aMeshIndex, const material_config& aMaterialConfig)
 	{
+		std::scoped_lock guard(*mMaterialMutex);
 		assert(aMeshIndex < mMaterialConfigPerMesh.size());
 		mMaterialConfigPerMesh[aMeshIndex] = aMaterialConfig;
+		mMaterialIdPerMesh[aMeshIndex].reset();
 	}
 
-	std::unordered_map<material_config, std::vector<size_t>> model_t::distinct_material_configs(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials)
+	material_id model_t::material_id_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		assert(mScene);
+		std::scoped_lock guard(*mMaterialMutex);
+		assert(aMeshIndex < mMaterialIdPerMesh.size());
+		if (!mMaterialIdPerMesh[aMeshIndex].has_value()) {
+			auto matConf = material_config_for_mesh(aMeshIndex);
+			matConf.mIgnoreCpuOnlyDataForEquality = false;
+			mMaterialIdPerMesh[aMeshIndex] = mMaterialTable.intern(matConf);
+		}
+		return mMaterialIdPerMesh[aMeshIndex].value();
+	}
+
+	std::unordered_map<material_config, std::vector<size_t>> model_t::distinct_material_configs(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials) const
+	{
+		std::scoped_lock guard(*mMaterialMutex);
+		const auto n = static_cast<size_t>(num_meshes());
+		std::vector<material_id> ids(n);
+		for (size_t i = 0; i < n; ++i) {
+			ids[i] = material_id_for_mesh(i);
+		}
+
+		// The meshes' IDs distinguish the CPU-only data as well. If that is not desired, map them to coarser IDs, interning every distinct ID only once:
+		const material_config_table* table = &mMaterialTable;
+		material_config_table gpuOnlyTable;
+		if (!aAlsoConsiderCpuOnlyDataForDistinctMaterials) {
+			constexpr auto unmapped = std::numeric_limits<material_id>::max();
+			std::vector<material_id> gpuOnlyIds(mMaterialTable.size(), unmapped);
+			for (auto& id : ids) {
+				if (unmapped == gpuOnlyIds[id]) {
+					auto matConf = mMaterialTable.config(id);
+					matConf.mIgnoreCpuOnlyDataForEquality = true;
+					gpuOnlyIds[id] = gpuOnlyTable.intern(matConf);
+				}
+				id = gpuOnlyIds[id];
+			}
+			table = &gpuOnlyTable;
+		}
+
+		auto groups = group_by_material_id(ids, table->size());
 		std::unordered_map<material_config, std::vector<size_t>> result;
-		auto n = mScene->mNumMeshes;
-		for (decltype(n) i = 0; i < n; ++i) {
-			const aiMesh* paiMesh = mScene->mMeshes[i];
-			auto matConf = material_config_for_mesh(i);
+		result.reserve(groups.size());
+		for (size_t id = 0; id < groups.size(); ++id) {
+			if (groups[id].empty()) {
+				continue;
+			}
+			auto matConf = table->config(static_cast<material_id>(id));
 			matConf.mIgnoreCpuOnlyDataForEquality = !aAlsoConsiderCpuOnlyDataForDistinctMaterials;
-			result[matConf].emplace_back(i);
+			result.emplace(std::move(matConf), std::move(groups[id]));
 		}
 		return result;
 	}
 
 	size_t model_t::number_of_vertices_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		assert(mScene);
-		assert(aMeshIndex < mScene->mNumMeshes);
+		assert(aMeshIndex < num_meshes());
+		if (!has_scene()) {
+			return static_cast<size_t>(mMeshStore->mMeshes[aMeshIndex].mNumVertices);
+		}
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		return static_cast<size_t>(paiMesh->mNumVertices);
 	}
 
 	std::vector<glm::vec3> model_t::positions_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::position);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec3> result;
 		result.reserve(n);
-		for (decltype(n) i = 0; i < n; ++i) {
-			result.push_back(glm::vec3(paiMesh->mVertices[i][0], paiMesh->mVertices[i][1], paiMesh->mVertices[i][2]));
+		for (size_t i = 0; i < n; ++i) {
+			result.push_back(glm::make_vec3(stream.mData + i * stream.mStride));
 		}
 		return result;
 	}
 
 	std::vector<glm::vec3> model_t::normals_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::normal);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec3> result;
 		result.reserve(n);
-		if (nullptr == paiMesh->mNormals) {
+		if (nullptr == stream.mData) {
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain normals. Will return (0,0,1) normals for each vertex.", aMeshIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(0.f, 0.f, 1.f);
 			}
 		}
 		else {
 			// We've got normals. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mNormals[i][0], paiMesh->mNormals[i][1], paiMesh->mNormals[i][2]);
+			for (size_t i = 0; i < n; ++i) {
+				result.push_back(glm::make_vec3(stream.mData + i * stream.mStride));
 			}
 		}
 		return result;
@@ -420,20 +908,20 @@ namespace gvk
 
 	std::vector<glm::vec3> model_t::tangents_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::tangent);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec3> result;
 		result.reserve(n);
-		if (nullptr == paiMesh->mTangents) {
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents. Will return (1,0,0) tangents for each vertex.", aMeshIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
+		if (nullptr == stream.mData) {
+			LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents, and they can not be generated. Will return (1,0,0) tangents for each vertex.", aMeshIndex));
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(1.f, 0.f, 0.f);
 			}
 		}
 		else {
 			// We've got tangents. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mTangents[i][0], paiMesh->mTangents[i][1], paiMesh->mTangents[i][2]);
+			for (size_t i = 0; i < n; ++i) {
+				result.push_back(glm::make_vec3(stream.mData + i * stream.mStride));
 			}
 		}
 		return result;
@@ -441,20 +929,20 @@ namespace gvk
 
 	std::vector<glm::vec3> model_t::bitangents_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::bitangent);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec3> result;
 		result.reserve(n);
-		if (nullptr == paiMesh->mBitangents) {
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain bitangents. Will return (0,1,0) bitangents for each vertex.", aMeshIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
+		if (nullptr == stream.mData) {
+			LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents, and they can not be generated. Will return (0,1,0) bitangents for each vertex.", aMeshIndex));
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(0.f, 1.f, 0.f);
 			}
 		}
 		else {
 			// We've got bitangents. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mBitangents[i][0], paiMesh->mBitangents[i][1], paiMesh->mBitangents[i][2]);
+			for (size_t i = 0; i < n; ++i) {
+				result.push_back(glm::make_vec3(stream.mData + i * stream.mStride));
 			}
 		}
 		return result;
@@ -462,76 +950,130 @@ namespace gvk
 
 	std::vector<glm::vec4> model_t::colors_for_mesh(mesh_index_t aMeshIndex, int aSet) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_COLOR_SETS);
+		const auto stream = vertex_stream_for_mesh(aMeshIndex, vertex_attribute::color, aSet);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec4> result;
 		result.reserve(n);
-		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_COLOR_SETS);
-		if (nullptr == paiMesh->mColors[aSet]) {
+		if (nullptr == stream.mData) {
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain a color set at index {}. Will return opaque magenta for each vertex.", aMeshIndex, aSet));
-			for (decltype(n) i = 0; i < n; ++i) {
+			for (size_t i = 0; i < n; ++i) {
 				result.emplace_back(1.f, 0.f, 1.f, 1.f);
 			}
 		}
 		else {
 			// We've got colors[_Set]. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mColors[aSet][i][0], paiMesh->mColors[aSet][i][1], paiMesh->mColors[aSet][i][2], paiMesh->mColors[aSet][i][3]);
+			for (size_t i = 0; i < n; ++i) {
+				result.push_back(glm::make_vec4(stream.mData + i * stream.mStride));
 			}
 		}
 		return result;
 	}
 
+	const bone_influences& model_t::bone_influences_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(aMeshIndex < mBoneInfluencesPerMesh.size());
+		std::scoped_lock guard(*mCacheMutex);
+		auto& cached = mBoneInfluencesPerMesh[aMeshIndex];
+		if (cached) {
+			return *cached;
+		}
+
+		assert(num_actual_bones(aMeshIndex) > 0);
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
+
+		// Invokes the given function for all <bone index, vertex id, weight> triples of this mesh, either from Assimp's scene or from the mesh store:
+		auto forEachBoneWeight = [&](auto bFunc) {
+			if (!has_scene()) {
+				const auto& mesh = mMeshStore->mMeshes[aMeshIndex];
+				for (uint32_t j = 0; j < mesh.mNumBones; ++j) {
+					const auto& bone = mMeshStore->mBones[static_cast<size_t>(mesh.mBonesOffset) + j];
+					for (uint32_t b = 0; b < bone.mNumWeights; ++b) {
+						const auto& w = mMeshStore->mBoneWeights[static_cast<size_t>(bone.mWeightsOffset) + b];
+						bFunc(j, w.mVertexId, w.mWeight);
+					}
+				}
+				return;
+			}
+			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
+			for (unsigned int j = 0; j < paiMesh->mNumBones; ++j) {
+				const aiBone* pBone = paiMesh->mBones[j];
+				for (unsigned int b = 0; b < pBone->mNumWeights; ++b) {
+					bFunc(static_cast<uint32_t>(j), pBone->mWeights[b].mVertexId, pBone->mWeights[b].mWeight);
+				}
+			}
+		};
+
+		// Gather all <bone index, weight> pairs per vertex in a flat, compressed sparse row layout:
+		// The pairs of vertex v are stored in the range [offsets[v], offsets[v+1]).
+		std::vector<uint32_t> offsets(n + 1, 0u);
+		forEachBoneWeight([&](uint32_t bBoneIndex, uint32_t bVertexId, float bWeight) {
+			++offsets[bVertexId + 1];
+		});
+		for (size_t v = 0; v < n; ++v) {
+			offsets[v + 1] += offsets[v];
+		}
+		std::vector<std::tuple<uint32_t, float>> influences(offsets[n]);
+		{
+			std::vector<uint32_t> insertPositions(std::begin(offsets), std::end(offsets) - 1);
+			forEachBoneWeight([&](uint32_t bBoneIndex, uint32_t bVertexId, float bWeight) {
+				influences[insertPositions[bVertexId]++] = std::make_tuple(bBoneIndex, bWeight);
+			});
+		}
+
+		auto result = std::make_unique<bone_influences>();
+		result->mIndices.resize(n, glm::uvec4{ 0u });
+		result->mWeights.resize(n, glm::vec4{ 0.0f });
+		result->mWeightSums.resize(n, 0.0f);
+		for (size_t v = 0; v < n; ++v) {
+			auto first = std::begin(influences) + offsets[v];
+			auto last  = std::begin(influences) + offsets[v + 1];
+			// Only the four most important ones are required => no need to sort all of them:
+			const auto numIndexWeightPairs = std::min(std::ptrdiff_t{ 4 }, std::distance(first, last));
+			std::partial_sort(first, first + numIndexWeightPairs, last, [](const std::tuple<uint32_t, float>& a, const std::tuple<uint32_t, float>& b) { return std::get<float>(a) > std::get<float>(b); });
+			for (std::ptrdiff_t j = 0; j < numIndexWeightPairs; ++j) {
+				result->mIndices[v][static_cast<int>(j)] = std::get<uint32_t>(*(first + j));
+				result->mWeights[v][static_cast<int>(j)] = std::get<float>(*(first + j));
+			}
+			float sum = 0.0f;
+			for (auto it = first; it != last; ++it) {
+				sum += std::get<float>(*it);
+			}
+			result->mWeightSums[v] = sum;
+		}
+
+		cached = std::move(result);
+		return *cached;
+	}
+
 	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::vec4> result;
 		result.reserve(n);
-		if (!paiMesh->HasBones()) {
+		if (0 == num_actual_bones(aMeshIndex)) {
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights for each vertex.", aMeshIndex));
 			for (decltype(n) i = 0; i < n; ++i) {
 				result.emplace_back(1.f, 0.f, 0.f, 0.f);
 			}
 		}
 		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone* pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
-				}
+			const auto& influences = bone_influences_for_mesh(aMeshIndex);
+			if (!aNormalizeBoneWeights) {
+				return influences.mWeights;
 			}
-			
-			// We've got bone weights. Proceed as planned.
+
 			bool hasNonNormalizedBoneWeights = false;
 			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
-
-				auto& weights = result.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					weights[j] = std::get<float>(vTempWeightsPerVertex[i][j]);
-				}
-
-				// "normalize" the weights, if requested, so they add up to one
-				if (aNormalizeBoneWeights) {
-					// Blender can save meshes with a total weight sum > 1. So first scale down by the total sum (we need to consider all weights, not only the first four!)
-					float sum = 0.0f;
-					for (auto& w : vTempWeightsPerVertex[i]) {
-						sum += std::get<float>(w);
-					}
-					if (sum > 0.0f) {
-						weights /= sum;
-					}
-					hasNonNormalizedBoneWeights = sum > 1.001f || hasNonNormalizedBoneWeights;
-					// if we have more than 4 weights, assign all the unconsidered ones to the 4th bone
-					weights.w = 1.0f - weights.x - weights.y - weights.z;
+				auto& weights = result.emplace_back(influences.mWeights[i]);
+				// Blender can save meshes with a total weight sum > 1. So first scale down by the total sum (we need to consider all weights, not only the first four!)
+				const auto sum = influences.mWeightSums[i];
+				if (sum > 0.0f) {
+					weights /= sum;
 				}
+				hasNonNormalizedBoneWeights = sum > 1.001f || hasNonNormalizedBoneWeights;
+				// if we have more than 4 weights, assign all the unconsidered ones to the 4th bone
+				weights.w = 1.0f - weights.x - weights.y - weights.z;
 			}
 			if (hasNonNormalizedBoneWeights) {
 				LOG_WARNING(fmt::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", aMeshIndex));
@@ -542,11 +1084,10 @@ namespace gvk
 
 	std::vector<glm::uvec4> model_t::bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
+		auto n = number_of_vertices_for_mesh(aMeshIndex);
 		std::vector<glm::uvec4> result;
 		result.reserve(n);
-		if (!paiMesh->HasBones()) {
+		if (0 == num_actual_bones(aMeshIndex)) {
 			const uint32_t fallbackIndex = aBoneIndexOffset;
 			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return ({},{},{},{}) bone indices for each vertex.", aMeshIndex, fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex));
 			for (decltype(n) i = 0; i < n; ++i) {
@@ -554,28 +1095,57 @@ namespace gvk
 			}
 		}
 		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone * pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
-				}
-			}
-			
-			// We've got bone weights. Proceed as planned.
+			const auto& influences = bone_influences_for_mesh(aMeshIndex);
 			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
+				result.emplace_back(influences.mIndices[i] + glm::uvec4{ aBoneIndexOffset });
+			}
+		}
+		return result;
+	}
 
-				auto& indices = result.emplace_back(aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					indices[j] = std::get<uint32_t>(vTempWeightsPerVertex[i][j]) + aBoneIndexOffset;
-				}
+	/** Quantizes normalized bone weights to unsigned normalized integers of type T, such that
+	 *	the quantized weights of each vertex add up to exactly std::numeric_limits<T>::max().
+	 */
+	template <typename T>
+	static std::vector<glm::vec<4, T, glm::defaultp>> quantize_bone_weights(const std::vector<glm::vec4>& aNormalizedWeights)
+	{
+		constexpr auto maxValue = static_cast<int>(std::numeric_limits<T>::max());
+		std::vector<glm::vec<4, T, glm::defaultp>> result;
+		result.reserve(aNormalizedWeights.size());
+		for (const auto& weights : aNormalizedWeights) {
+			auto q = glm::ivec4(glm::round(glm::clamp(weights, glm::vec4{ 0.0f }, glm::vec4{ 1.0f }) * static_cast<float>(maxValue)));
+			// Distribute the rounding error onto the largest weight, so that the sum stays exactly 1.0 after dequantization:
+			int largest = 0;
+			for (int j = 1; j < 4; ++j) {
+				if (q[j] > q[largest]) { largest = j; }
 			}
+			q[largest] = glm::clamp(q[largest] + maxValue - (q.x + q.y + q.z + q.w), 0, maxValue);
+			result.emplace_back(q);
+		}
+		return result;
+	}
+
+	std::vector<glm::u8vec4> model_t::bone_weights_for_mesh_unorm8(mesh_index_t aMeshIndex) const
+	{
+		return quantize_bone_weights<glm::u8>(bone_weights_for_mesh(aMeshIndex, true));
+	}
+
+	std::vector<glm::u16vec4> model_t::bone_weights_for_mesh_unorm16(mesh_index_t aMeshIndex) const
+	{
+		return quantize_bone_weights<glm::u16>(bone_weights_for_mesh(aMeshIndex, true));
+	}
+
+	std::vector<glm::u8vec4> model_t::bone_indices_for_mesh_u8(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
+	{
+		const auto highestIndex = num_bone_matrices(aMeshIndex) - 1u + aBoneIndexOffset;
+		if (highestIndex > static_cast<uint32_t>(std::numeric_limits<glm::u8>::max())) {
+			throw gvk::runtime_error(fmt::format("The bone indices of the mesh at index {} (with offset {}) reach up to {}, which does not fit into 8 bits. Use bone_indices_for_mesh instead.", aMeshIndex, aBoneIndexOffset, highestIndex));
+		}
+		auto indices = bone_indices_for_mesh(aMeshIndex, aBoneIndexOffset);
+		std::vector<glm::u8vec4> result;
+		result.reserve(indices.size());
+		for (const auto& i : indices) {
+			result.emplace_back(i);
 		}
 		return result;
 	}
@@ -606,14 +1176,15 @@ namespace gvk
 	
 	int model_t::num_uv_components_for_mesh(mesh_index_t aMeshIndex, int aSet) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
-		if (nullptr == paiMesh->mTextureCoords[aSet]) { return 0; }
-		return paiMesh->mNumUVComponents[aSet];
+		return static_cast<int>(vertex_stream_for_mesh(aMeshIndex, vertex_attribute::texture_coordinates_3d, aSet).mNumComponents);
 	}
 
 	int model_t::number_of_indices_for_mesh(mesh_index_t aMeshIndex) const
 	{
+		if (!has_scene()) {
+			return static_cast<int>(mMeshStore->mMeshes[aMeshIndex].mNumIndices);
+		}
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		size_t indicesCount = 0;
 		for (unsigned int i = 0; i < paiMesh->mNumFaces; i++)
@@ -627,7 +1198,7 @@ namespace gvk
 	std::vector<mesh_index_t> model_t::select_all_meshes() const
 	{
 		std::vector<mesh_index_t> result;
-		auto n = mScene->mNumMeshes;
+		auto n = num_meshes();
 		result.reserve(n);
 		for (decltype(n) i = 0; i < n; ++i) {
 			result.push_back(static_cast<mesh_index_t>(i));
@@ -635,26 +1206,10 @@ namespace gvk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* aNode, const aiMatrix4x4& aM) const
-	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aLight->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_light(aLight, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
-			}
-		}
-		return {};
-	}
-
 	std::vector<glm::vec3> model_t::positions_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = positions_for_mesh(meshIndex);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -665,6 +1220,7 @@ namespace gvk
 	std::vector<glm::vec3> model_t::normals_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = normals_for_mesh(meshIndex);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -675,6 +1231,7 @@ namespace gvk
 	std::vector<glm::vec3> model_t::tangents_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = tangents_for_mesh(meshIndex);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -685,6 +1242,7 @@ namespace gvk
 	std::vector<glm::vec3> model_t::bitangents_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = bitangents_for_mesh(meshIndex);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -695,6 +1253,7 @@ namespace gvk
 	std::vector<glm::vec4> model_t::colors_for_meshes(std::vector<mesh_index_t> aMeshIndices, int aSet) const
 	{
 		std::vector<glm::vec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = colors_for_mesh(meshIndex, aSet);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -705,6 +1264,7 @@ namespace gvk
 	std::vector<glm::vec4> model_t::bone_weights_for_meshes(std::vector<mesh_index_t> aMeshIndices, bool aNormalizeBoneWeights) const
 	{
 		std::vector<glm::vec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = bone_weights_for_mesh(meshIndex, aNormalizeBoneWeights);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -715,6 +1275,7 @@ namespace gvk
 	std::vector<glm::uvec4> model_t::bone_indices_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::uvec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
 		for (auto meshIndex : aMeshIndices) {
 			auto tmp = bone_indices_for_mesh(meshIndex);
 			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
@@ -722,14 +1283,156 @@ namespace gvk
 		return result;
 	}
 
+	std::vector<glm::u8vec4> model_t::bone_weights_for_meshes_unorm8(std::vector<mesh_index_t> aMeshIndices) const
+	{
+		std::vector<glm::u8vec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
+		for (auto meshIndex : aMeshIndices) {
+			insert_into(result, bone_weights_for_mesh_unorm8(meshIndex));
+		}
+		return result;
+	}
+
+	std::vector<glm::u16vec4> model_t::bone_weights_for_meshes_unorm16(std::vector<mesh_index_t> aMeshIndices) const
+	{
+		std::vector<glm::u16vec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
+		for (auto meshIndex : aMeshIndices) {
+			insert_into(result, bone_weights_for_mesh_unorm16(meshIndex));
+		}
+		return result;
+	}
+
+	std::vector<glm::u8vec4> model_t::bone_indices_for_meshes_u8(std::vector<mesh_index_t> aMeshIndices) const
+	{
+		std::vector<glm::u8vec4> result;
+		result.reserve(number_of_vertices_for_meshes(aMeshIndices));
+		for (auto meshIndex : aMeshIndices) {
+			insert_into(result, bone_indices_for_mesh_u8(meshIndex));
+		}
+		return result;
+	}
+
+	size_t model_t::number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		size_t result = 0;
+		for (auto meshIndex : aMeshIndices) {
+			result += number_of_vertices_for_mesh(meshIndex);
+		}
+		return result;
+	}
+
+	size_t model_t::write_vertex_data_for_mesh(mesh_index_t aMeshIndex, const vertex_layout& aLayout, void* aDestination) const
+	{
+		assert(aMeshIndex < num_meshes());
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
+
+		// Resolve the source of each attribute ONCE, so that the loop over all vertices only has to copy floats:
+		struct attribute_source
+		{
+			const float* mSource;		// nullptr if the mesh does not contain this attribute
+			size_t mSourceStride;		// in floats
+			size_t mNumSourceComponents;
+			size_t mNumComponents;
+			size_t mOffset;
+			bool mFlipV;
+			std::array<float, 4> mFallback;
+		};
+		std::vector<attribute_source> sources;
+		sources.reserve(aLayout.mAttributes.size());
+		for (const auto& loc : aLayout.mAttributes) {
+			const auto stream = vertex_stream_for_mesh(aMeshIndex, loc.mAttribute, loc.mSet);
+			auto& src = sources.emplace_back(attribute_source{ stream.mData, stream.mStride, stream.mNumComponents, num_components_of(loc.mAttribute), loc.mOffset, false, { 0.f, 0.f, 0.f, 0.f } });
+			switch (loc.mAttribute) {
+			case vertex_attribute::position:
+				break;
+			case vertex_attribute::normal:
+				src.mFallback = { 0.f, 0.f, 1.f, 0.f };
+				if (nullptr == src.mSource) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain normals. Will write (0,0,1) normals for each vertex.", aMeshIndex));
+				}
+				break;
+			case vertex_attribute::tangent:
+				src.mFallback = { 1.f, 0.f, 0.f, 0.f };
+				if (nullptr == src.mSource) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents, and they can not be generated. Will write (1,0,0) tangents for each vertex.", aMeshIndex));
+				}
+				break;
+			case vertex_attribute::bitangent:
+				src.mFallback = { 0.f, 1.f, 0.f, 0.f };
+				if (nullptr == src.mSource) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents, and they can not be generated. Will write (0,1,0) bitangents for each vertex.", aMeshIndex));
+				}
+				break;
+			case vertex_attribute::color:
+				src.mFallback = { 1.f, 0.f, 1.f, 1.f };
+				if (nullptr == src.mSource) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain a color set at index {}. Will write opaque magenta for each vertex.", aMeshIndex, loc.mSet));
+				}
+				break;
+			case vertex_attribute::texture_coordinates_2d:
+			case vertex_attribute::texture_coordinates_2d_flipped:
+			case vertex_attribute::texture_coordinates_3d:
+				src.mFlipV = vertex_attribute::texture_coordinates_2d_flipped == loc.mAttribute;
+				if (nullptr == src.mSource) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain a texture coordinates at index {}. Will write zeros for each vertex.", aMeshIndex, loc.mSet));
+					break;
+				}
+				if (src.mNumSourceComponents < 1 || src.mNumSourceComponents > 3) {
+					throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", src.mNumSourceComponents, aMeshIndex, loc.mSet));
+				}
+				break;
+			default:
+				throw gvk::logic_error("Unsupported vertex_attribute");
+			}
+			if (nullptr == src.mSource) {
+				src.mNumSourceComponents = 0;
+			}
+		}
+
+		// One pass over all the vertices, writing every attribute of a vertex before proceeding to the next one:
+		auto* dst = static_cast<uint8_t*>(aDestination);
+		for (size_t i = 0; i < n; ++i) {
+			auto* vertex = dst + i * aLayout.mStride;
+			for (const auto& src : sources) {
+				auto* target = reinterpret_cast<float*>(vertex + src.mOffset);
+				const float* source = nullptr != src.mSource ? src.mSource + i * src.mSourceStride : nullptr;
+				for (size_t c = 0; c < src.mNumComponents; ++c) {
+					target[c] = c < src.mNumSourceComponents ? source[c] : src.mFallback[c];
+				}
+				if (src.mFlipV) {
+					target[1] = 1.0f - target[1];
+				}
+			}
+		}
+		return n;
+	}
+
+	size_t model_t::write_vertex_data_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, const vertex_layout& aLayout, void* aDestination) const
+	{
+		auto* dst = static_cast<uint8_t*>(aDestination);
+		size_t written = 0;
+		for (auto meshIndex : aMeshIndices) {
+			written += write_vertex_data_for_mesh(meshIndex, aLayout, dst + written * aLayout.mStride);
+		}
+		return written;
+	}
+
 	std::vector<lightsource> model_t::lights() const
 	{
+		if (!has_scene()) {
+			return mLights;
+		}
 		std::vector<lightsource> result;
 		auto n = mScene->mNumLights;
 		result.reserve(n);
 		for (decltype(n) i = 0; i < n; ++i) {
 			const aiLight* aiLight = mScene->mLights[i];
-			glm::mat4 transfo = transformation_matrix_traverser_for_light(aiLight, mScene->mRootNode, aiMatrix4x4()).value();
+			const auto nodeIndex = node_index_by_name(to_string(aiLight->mName));
+			if (!nodeIndex.has_value()) {
+				throw gvk::runtime_error(fmt::format("The light source named '{}' is not referenced by any node.", to_string(aiLight->mName)));
+			}
+			glm::mat4 transfo = mNodeGlobalTransforms[nodeIndex.value()];
 			glm::mat3 transfoForDirections = glm::mat3(glm::inverse(glm::transpose(transfo))); // TODO: inverse transpose okay for direction??
 			lightsource cgbLight;
 			cgbLight.mAngleInnerCone = aiLight->mAngleInnerCone;
@@ -775,6 +1478,9 @@ namespace gvk
 
 	std::vector<gvk::camera> model_t::cameras() const
 	{
+		if (!has_scene()) {
+			return mCameras;
+		}
 		std::vector<gvk::camera> result;
 		result.reserve(mScene->mNumCameras);
 		for (unsigned int i = 0; i < mScene->mNumCameras; ++i) {
@@ -791,11 +1497,12 @@ namespace gvk
 			aiMatrix4x4 projMat;
 			aiCam->GetCameraMatrix(projMat);
 			cgbCam.set_projection_matrix(glm::make_mat4(&projMat.a1));
-			auto trafo = transformation_matrix_traverser_for_camera(aiCam, mScene->mRootNode, aiMatrix4x4());
-			if (trafo.has_value()) {
+			const auto nodeIndex = node_index_by_name(to_string(aiCam->mName));
+			if (nodeIndex.has_value()) {
+				const auto& trafo = mNodeGlobalTransforms[nodeIndex.value()];
 				glm::vec3 side = glm::normalize(glm::cross(lookdir, updir));
-				cgbCam.set_translation(trafo.value() * glm::vec4(cgbCam.translation(), 1));
-				glm::mat3 dirtrafo = glm::mat3(glm::inverse(glm::transpose(trafo.value())));
+				cgbCam.set_translation(trafo * glm::vec4(cgbCam.translation(), 1));
+				glm::mat3 dirtrafo = glm::mat3(glm::inverse(glm::transpose(trafo)));
 				cgbCam.set_rotation(glm::quatLookAt(dirtrafo * lookdir, dirtrafo * updir));
 			}
 			result.push_back(cgbCam);
@@ -805,26 +1512,309 @@ namespace gvk
 
 	animation_clip_data model_t::load_animation_clip(unsigned int aAnimationIndex, double aStartTimeTicks, double aEndTimeTicks) const
 	{
-		assert(mScene);
 		assert(aEndTimeTicks > aStartTimeTicks);
 		assert(aStartTimeTicks >= 0.0);
-		if (!mScene->HasAnimations()) {
+		if (mAnimationTracks.empty()) {
 			throw avk::runtime_error("Model has no animations");
 		}
-		if (aAnimationIndex > mScene->mNumAnimations) {
+		if (aAnimationIndex >= mAnimationTracks.size()) {
 			throw avk::runtime_error("Requested animation index out of bounds");
 		}
 
-		double ticksPerSec = mScene->mAnimations[aAnimationIndex]->mTicksPerSecond;
-		double durationTicks = mScene->mAnimations[aAnimationIndex]->mDuration;
+		double ticksPerSec = mAnimationTracks[aAnimationIndex].mTicksPerSecond;
+		double durationTicks = mAnimationTracks[aAnimationIndex].mDurationTicks;
 		double endTicks = glm::min(aEndTimeTicks, durationTicks);
 
 		return animation_clip_data{ aAnimationIndex, ticksPerSec, aStartTimeTicks, endTicks };
 	}
 
-	animation model_t::prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices)
+	std::vector<mesh_optimization_statistics> model_t::optimize_meshes(const std::vector<mesh_index_t>& aMeshIndices, mesh_optimization aSteps, uint32_t aCacheSize, float aOverdrawThreshold)
+	{
+		std::vector<std::optional<mesh_optimization_statistics>> statistics(aMeshIndices.size());
+
+		std::vector<size_t> work(aMeshIndices.size());
+		std::iota(std::begin(work), std::end(work), size_t{ 0 });
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(work), std::end(work), [&](size_t i) {
+			try {
+				const auto meshIndex = aMeshIndices[i];
+				if (aiPrimitiveType_TRIANGLE != primitive_types_for_mesh(meshIndex)) {
+					LOG_WARNING(fmt::format("Not optimizing mesh {} of model '{}', because it does not consist of triangles only.", meshIndex, mModelPath));
+					return;
+				}
+				// The scene is owned by this model's importer => it is fine to modify it. Without the scene, the mesh store is modified instead:
+				aiMesh* paiMesh = has_scene() ? const_cast<aiScene*>(mScene)->mMeshes[meshIndex] : nullptr;
+
+				const auto numVertices = number_of_vertices_for_mesh(meshIndex);
+				std::vector<uint32_t> indices(static_cast<size_t>(number_of_indices_for_mesh(meshIndex)));
+				write_indices_for_mesh(meshIndex, indices.data());
+
+				mesh_optimization_statistics stats;
+				stats.mMeshIndex = meshIndex;
+				stats.mBefore = analyze_vertex_cache(indices, numVertices, aCacheSize);
+
+				if ((aSteps & mesh_optimization::vertex_cache) == mesh_optimization::vertex_cache) {
+					indices = optimize_vertex_cache(indices, numVertices);
+				}
+				if ((aSteps & mesh_optimization::overdraw) == mesh_optimization::overdraw) {
+					indices = optimize_overdraw(indices, positions_for_mesh(meshIndex), aCacheSize, aOverdrawThreshold);
+				}
+				if ((aSteps & mesh_optimization::vertex_fetch) == mesh_optimization::vertex_fetch) {
+					const auto remap = optimize_vertex_fetch_remap(indices, numVertices);
+					remap_indices(indices, remap);
+					for (auto& lod : mLodsPerMesh[meshIndex]) {
+						remap_indices(lod.mIndices, remap);
+					}
+					mMorphTargetsPerMesh[meshIndex].remap_vertices(remap);
+					{
+						// Generated or assigned tangents are reordered as well, handles to the old ones stay valid:
+						std::scoped_lock guard(*mCacheMutex);
+						if (auto& tangentSpace = mTangentSpacePerMesh[meshIndex]) {
+							auto remapped = *tangentSpace;
+							remap_vertex_data(remapped.mTangents, remap);
+							remap_vertex_data(remapped.mBitangents, remap);
+							tangentSpace = std::make_shared<const tangent_space>(std::move(remapped));
+						}
+					}
+
+					if (nullptr == paiMesh) {
+						// Reorder every stream of the mesh store, each of which holds its number of components per vertex:
+						const auto& mesh = mMeshStore->mMeshes[meshIndex];
+						auto remapStoreStream = [&](const mesh_store_stream& bStream) {
+							float* data = mMeshStore->data(bStream);
+							if (nullptr == data) {
+								return;
+							}
+							const size_t nc = bStream.mNumComponents;
+							std::vector<float> tmp(data, data + numVertices * nc);
+							for (size_t v = 0; v < numVertices; ++v) {
+								std::copy_n(tmp.data() + v * nc, nc, data + static_cast<size_t>(remap[v]) * nc);
+							}
+						};
+						remapStoreStream(mesh.mPositions);
+						remapStoreStream(mesh.mNormals);
+						remapStoreStream(mesh.mTangents);
+						remapStoreStream(mesh.mBitangents);
+						for (const auto& stream : mesh.mColors) {
+							remapStoreStream(stream);
+						}
+						for (const auto& stream : mesh.mTextureCoordinates) {
+							remapStoreStream(stream);
+						}
+						for (uint32_t b = 0; b < mesh.mNumBones; ++b) {
+							const auto& bone = mMeshStore->mBones[static_cast<size_t>(mesh.mBonesOffset) + b];
+							for (uint32_t w = 0; w < bone.mNumWeights; ++w) {
+								auto& weight = mMeshStore->mBoneWeights[static_cast<size_t>(bone.mWeightsOffset) + w];
+								weight.mVertexId = remap[weight.mVertexId];
+							}
+						}
+					}
+					else {
+						// Reorder every vertex attribute stream which Assimp might hold for this mesh:
+						auto remapStream = [&remap, numVertices](auto* bStream) {
+							if (nullptr == bStream) {
+								return;
+							}
+							using T = std::remove_pointer_t<decltype(bStream)>;
+							std::vector<T> tmp(bStream, bStream + numVertices);
+							remap_vertex_data(tmp, remap);
+							std::copy(std::begin(tmp), std::end(tmp), bStream);
+						};
+						remapStream(paiMesh->mVertices);
+						remapStream(paiMesh->mNormals);
+						remapStream(paiMesh->mTangents);
+						remapStream(paiMesh->mBitangents);
+						for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+							remapStream(paiMesh->mColors[c]);
+						}
+						for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+							remapStream(paiMesh->mTextureCoords[t]);
+						}
+						for (unsigned int a = 0; a < paiMesh->mNumAnimMeshes; ++a) {
+							aiAnimMesh* paiAnimMesh = paiMesh->mAnimMeshes[a];
+							assert(paiAnimMesh->mNumVertices == paiMesh->mNumVertices);
+							remapStream(paiAnimMesh->mVertices);
+							remapStream(paiAnimMesh->mNormals);
+							remapStream(paiAnimMesh->mTangents);
+							remapStream(paiAnimMesh->mBitangents);
+							for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+								remapStream(paiAnimMesh->mColors[c]);
+							}
+							for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+								remapStream(paiAnimMesh->mTextureCoords[t]);
+							}
+						}
+						for (unsigned int b = 0; b < paiMesh->mNumBones; ++b) {
+							aiBone* paiBone = paiMesh->mBones[b];
+							for (unsigned int w = 0; w < paiBone->mNumWeights; ++w) {
+								paiBone->mWeights[w].mVertexId = remap[paiBone->mWeights[w].mVertexId];
+							}
+						}
+					}
+				}
+
+				// Write the (reordered) triangles back:
+				if (nullptr == paiMesh) {
+					const auto& mesh = mMeshStore->mMeshes[meshIndex];
+					std::copy(std::begin(indices), std::end(indices), mMeshStore->mIndices.begin() + static_cast<ptrdiff_t>(mesh.mIndicesOffset));
+				}
+				else {
+					for (unsigned int f = 0; f < paiMesh->mNumFaces; ++f) {
+						aiFace& paiFace = paiMesh->mFaces[f];
+						assert(3 == paiFace.mNumIndices);
+						paiFace.mIndices[0] = indices[f * 3];
+						paiFace.mIndices[1] = indices[f * 3 + 1];
+						paiFace.mIndices[2] = indices[f * 3 + 2];
+					}
+				}
+
+				stats.mAfter = analyze_vertex_cache(indices, numVertices, aCacheSize);
+				statistics[i] = stats;
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+
+		// Vertex order might have changed => cached bone influences are outdated (tangents have been reordered above):
+		{
+			std::scoped_lock guard(*mCacheMutex);
+			for (auto meshIndex : aMeshIndices) {
+				mBoneInfluencesPerMesh[meshIndex].reset();
+			}
+		}
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+
+		std::vector<mesh_optimization_statistics> result;
+		result.reserve(aMeshIndices.size());
+		vertex_cache_statistics totalBefore, totalAfter;
+		for (auto& stats : statistics) {
+			if (!stats.has_value()) {
+				continue;
+			}
+			totalBefore.mVerticesTransformed += stats->mBefore.mVerticesTransformed;
+			totalBefore.mNumTriangles += stats->mBefore.mNumTriangles;
+			totalAfter.mVerticesTransformed += stats->mAfter.mVerticesTransformed;
+			result.push_back(stats.value());
+		}
+		if (totalBefore.mNumTriangles > 0) {
+			LOG_INFO(fmt::format("Optimized {} meshes of model '{}': ACMR {:.3f} -> {:.3f} (cache size {})",
+				result.size(), mModelPath,
+				static_cast<float>(totalBefore.mVerticesTransformed) / static_cast<float>(totalBefore.mNumTriangles),
+				static_cast<float>(totalAfter.mVerticesTransformed) / static_cast<float>(totalBefore.mNumTriangles),
+				aCacheSize));
+		}
+		return result;
+	}
+
+	void model_t::generate_lods(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<lod_level_config>& aLevels)
+	{
+		// Exceptions must not escape the parallel loop; the first one is rethrown after all meshes have been processed:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(aMeshIndices), std::end(aMeshIndices), [&](mesh_index_t bMeshIndex) {
+			try {
+				if (aiPrimitiveType_TRIANGLE != primitive_types_for_mesh(bMeshIndex)) {
+					LOG_WARNING(fmt::format("Not generating levels of detail for mesh {} of model '{}', because it does not consist of triangles only.", bMeshIndex, mModelPath));
+					return;
+				}
+
+				const auto positions = positions_for_mesh(bMeshIndex);
+				const auto originalIndices = indices_for_mesh<uint32_t>(bMeshIndex);
+				std::vector<mesh_lod> lods;
+				lods.reserve(aLevels.size());
+				for (const auto& level : aLevels) {
+					const auto& previous = lods.empty() ? originalIndices : lods.back().mIndices;
+					const auto previousError = lods.empty() ? 0.0f : lods.back().mError;
+					const auto targetIndexCount = static_cast<size_t>(static_cast<float>(originalIndices.size()) * level.mTargetRatio) / 3 * 3;
+					auto lod = simplify_mesh(previous, positions, targetIndexCount, std::max(0.0f, level.mTargetError - previousError));
+					// The errors of the chain add up:
+					lod.mError += previousError;
+					lods.push_back(std::move(lod));
+				}
+				mLodsPerMesh[bMeshIndex] = std::move(lods);
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	void model_t::generate_lods(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<float>& aTargetRatios, float aTargetError)
+	{
+		std::vector<lod_level_config> levels;
+		for (auto ratio : aTargetRatios) {
+			levels.push_back(lod_level_config{ ratio, aTargetError });
+		}
+		generate_lods(aMeshIndices, levels);
+	}
+
+	size_t model_t::number_of_indices_for_mesh_lod(mesh_index_t aMeshIndex, size_t aLodLevel) const
+	{
+		if (0 == aLodLevel || mLodsPerMesh[aMeshIndex].empty()) {
+			return static_cast<size_t>(number_of_indices_for_mesh(aMeshIndex));
+		}
+		return mLodsPerMesh[aMeshIndex][std::min(aLodLevel, mLodsPerMesh[aMeshIndex].size()) - 1].mIndices.size();
+	}
+
+	float model_t::lod_error_for_mesh(mesh_index_t aMeshIndex, size_t aLodLevel) const
+	{
+		if (0 == aLodLevel || mLodsPerMesh[aMeshIndex].empty()) {
+			return 0.0f;
+		}
+		return mLodsPerMesh[aMeshIndex][std::min(aLodLevel, mLodsPerMesh[aMeshIndex].size()) - 1].mError;
+	}
+
+	std::vector<size_t> model_t::nodes_animated_by(uint32_t aAnimationIndex) const
+	{
+		if (aAnimationIndex >= mAnimationTracks.size()) {
+			throw gvk::runtime_error(fmt::format("Requested animation index {} is out of bounds for model '{}' with {} animations.", aAnimationIndex, mModelPath, mAnimationTracks.size()));
+		}
+		std::vector<size_t> result;
+		const auto& ani = mAnimationTracks[aAnimationIndex];
+		for (size_t i = 0; i < ani.mChannels.size(); ++i) {
+			const auto& channel = ani.mChannels[i];
+
+			auto channelNode = last_node_index_by_name(channel.mNodeName);
+			if (!channelNode.has_value()) {
+				LOG_ERROR(fmt::format("Node name '{}', referenced from channel[{}], could not be found in the model's nodes.", channel.mNodeName, i));
+				continue;
+			}
+			result.push_back(channelNode.value());
+		}
+
+#ifdef _DEBUG
+		{
+			auto sanityCheck = result;
+			std::sort(std::begin(sanityCheck), std::end(sanityCheck));
+			auto uniqueEnd = std::unique(std::begin(sanityCheck), std::end(sanityCheck));
+			if (uniqueEnd != std::end(sanityCheck)) {
+				LOG_WARNING(
+					fmt::format(
+						"Some nodes are contained multiple times in the animation channels of animation[{}]. Only the first channel of each node is going to be used."
+						, aAnimationIndex));
+			}
+		}
+#endif
+		return result;
+	}
+
+	std::shared_ptr<const animation_skeleton> model_t::build_animation_skeleton(const std::vector<size_t>& aAnimatedNodes, const std::vector<mesh_index_t>& aMeshIndices) const
 	{
-		animation result;
+		auto result = std::make_shared<animation_skeleton>();
 
 		std::unordered_map<mesh_index_t, uint32_t> boneIndexOffsetsPerMesh;
 		{
@@ -833,19 +1823,15 @@ namespace gvk
 				boneIndexOffsetsPerMesh[mi] = bio;
 				bio += num_bone_matrices(mi);
 			}
+			result->mMaxNumBoneMatrices = static_cast<size_t>(bio);
 		}
-		result.mAnimationIndex = aAnimationIndex;
 
 		// --------------------------- helper collections ------------------------------------
-		// Contains mappings of bone/node names to aiNode* pointers:
-		std::unordered_map<std::string, aiNode*> mapNameToNode;
-		add_all_to_node_map(mapNameToNode, mScene->mRootNode);
-
-		// Which node is modified by bone animation? => Only those with an entry in this map:
-		std::unordered_map<aiNode*, aiNodeAnim*> mapNodeToBoneAnimation;
+		// Which node is modified by bone animation? => Only those contained in this set:
+		const std::unordered_set<size_t> nodesModifiedByBones(std::begin(aAnimatedNodes), std::end(aAnimatedNodes));
 
 		// Matrix information per bone per mesh:
-		std::vector<std::unordered_map<aiNode*, bone_mesh_data>> mapsBoneToMatrixInfo;
+		std::vector<std::unordered_map<size_t, bone_mesh_data>> mapsBoneToMatrixInfo;
 
 		// Additional bone_mesh_data entries for mesh root nodes
 		std::vector<std::vector<bone_mesh_data>> fakeBoneToMatrixInfos;
@@ -855,22 +1841,18 @@ namespace gvk
 		std::vector<std::vector<bool>> flagsBonesAddedAsAniNodes;
 
 		// At which index has which node been inserted (relevant mostly for keeping track of parent-nodes):
-		std::map<aiNode*, size_t> mapNodeToAniNodeIndex;
+		std::map<size_t, size_t> mapNodeToAniNodeIndex;
 		// -----------------------------------------------------------------------------------
 
 		// -------------------------------- helper lambdas -----------------------------------
-		// Checks whether the given node is modified by bones a.k.a. bone-animated (by searching it in mapNodeToBoneAnimation)
-		auto isNodeModifiedByBones = [&](aiNode* bNode) -> bool{
-			const auto it = mapNodeToBoneAnimation.find(bNode);
-			if (std::end(mapNodeToBoneAnimation) != it) {
-				assert(it->first == bNode);
-				return true;
-			}
-			return false;
+		// Nodes are identified by their index in the model's flat node table.
+		// Checks whether the given node is modified by bones a.k.a. bone-animated (by searching it in nodesModifiedByBones)
+		auto isNodeModifiedByBones = [&](size_t bNode) -> bool{
+			return nodesModifiedByBones.contains(bNode);
 		};
 
 		// Helper lambda for checking whether a node has already been added and if so, returning its index
-		auto isNodeAlreadyAdded = [&](aiNode* bNode) -> std::optional<size_t>{
+		auto isNodeAlreadyAdded = [&](size_t bNode) -> std::optional<size_t>{
 			auto it = mapNodeToAniNodeIndex.find(bNode);
 			if (std::end(mapNodeToAniNodeIndex) != it) {
 				return it->second;
@@ -881,18 +1863,18 @@ namespace gvk
 		// Helper lambda for getting the 'next' parent node which is animated.
 		// 'next' means: Next up the parent hierarchy WHICH IS BONE-ANIMATED.
 		// If no such parent exists, an empty value will be returned.
-		auto getAnimatedParentIndex = [&](aiNode* bNode) -> std::optional<size_t>{
-			auto* parent = bNode->mParent;
-			while (nullptr != parent) {
-				auto already = isNodeAlreadyAdded(parent);
+		auto getAnimatedParentIndex = [&](size_t bNode) -> std::optional<size_t>{
+			auto parent = mNodeParentIndices[bNode];
+			while (parent.has_value()) {
+				auto already = isNodeAlreadyAdded(parent.value());
 				if (already.has_value()) {
-					assert(isNodeModifiedByBones(parent));
+					assert(isNodeModifiedByBones(parent.value()));
 					return already;
 				}
 				else {
-					assert(!isNodeModifiedByBones(parent));
+					assert(!isNodeModifiedByBones(parent.value()));
 				}
-				parent = parent->mParent;
+				parent = mNodeParentIndices[parent.value()];
 			}
 			return {};
 		};
@@ -900,94 +1882,46 @@ namespace gvk
 		// Helper lambda for getting the accumulated parent transforms up the parent
 		// hierarchy until a parent node is encountered which is bone-animated. That
 		// bone-animated parent is NOT included in the accumulated transformation matrix.
-		auto getUnanimatedParentTransform = [&](aiNode* bNode) -> glm::mat4{
-			aiMatrix4x4 parentTransform{};
-			auto* parent = bNode->mParent;
-			while (nullptr != parent) {
-				if (!isNodeModifiedByBones(parent)) {
-					parentTransform = parent->mTransformation * parentTransform;
-					parent = parent->mParent;
+		auto getUnanimatedParentTransform = [&](size_t bNode) -> glm::mat4{
+			glm::mat4 parentTransform{ 1.0f };
+			auto parent = mNodeParentIndices[bNode];
+			while (parent.has_value()) {
+				if (!isNodeModifiedByBones(parent.value())) {
+					parentTransform = mNodeLocalTransforms[parent.value()] * parentTransform;
+					parent = mNodeParentIndices[parent.value()];
 				}
 				else {
-					assert(isNodeAlreadyAdded(parent).has_value());
-					parent = nullptr; // stop if the parent is animated
+					assert(isNodeAlreadyAdded(parent.value()).has_value());
+					parent.reset(); // stop if the parent is animated
 				}
 			}
-			return to_mat4(parentTransform);
+			return parentTransform;
 		};
 
 		// Helper-lambda to create an animated_node instance:
-		auto addAnimatedNode = [&](aiNodeAnim* bChannel, aiNode* bNode, std::optional<size_t> bAnimatedParentIndex, const glm::mat4& bUnanimatedParentTransform){
-			auto& anode = result.mAnimationData.emplace_back();
-			mapNodeToAniNodeIndex[bNode] = result.mAnimationData.size() - 1;
-
-			if (nullptr != bChannel) {
-				for (unsigned int i = 0; i < bChannel->mNumPositionKeys; ++i) {
-					anode.mPositionKeys.emplace_back(position_key{
-						bChannel->mPositionKeys[i].mTime, to_vec3(bChannel->mPositionKeys[i].mValue)
-					});
-				}
-				for (unsigned int i = 0; i < bChannel->mNumRotationKeys; ++i) {
-					anode.mRotationKeys.emplace_back(rotation_key{
-						bChannel->mRotationKeys[i].mTime, glm::normalize(to_quat(bChannel->mRotationKeys[i].mValue))	// normalize the quaternion, just to be on the safe side
-					});
-				}
-				for (unsigned int i = 0; i < bChannel->mNumScalingKeys; ++i) {
-					anode.mScalingKeys.emplace_back(scaling_key{
-						bChannel->mScalingKeys[i].mTime, to_vec3(bChannel->mScalingKeys[i].mValue)
-					});
-				}
-			}
-
-			// Tidy-up the keys:
-			//
-			// There is one special case which will occur (probably often) in practice. That is, that there
-			// are no keys at all (position + rotation + scaling == 0), because the animation does not modify a
-			// given bone.
-			// Such a case is created in the last step in this function (prepare_animation_for_meshes_into_strided_consecutive_storage),
-			// which is looking for bones which have not been animated by Assimp's channels, but need to receive
-			// a proper bone matrix.
-			//
-			// If it is not the special case, then assure that there ARE keys in each of the keys-collections,
-			// that will (hopefully) make animation more performant because it requires fewer ifs.
-			if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() > 0) {
-				if (anode.mPositionKeys.empty()) {
-					// The time doesn't really matter, but do not apply any translation
-					anode.mPositionKeys.emplace_back(position_key{0.0, glm::vec3{0.f}});
-				}
-				if (anode.mRotationKeys.empty()) {
-					// The time doesn't really matter, but do not apply any rotation
-					anode.mRotationKeys.emplace_back(rotation_key{0.0, glm::quat(1.f, 0.f, 0.f, 0.f)});
-				}
-				if (anode.mScalingKeys.empty()) {
-					// The time doesn't really matter, but do not apply any scaling
-					anode.mScalingKeys.emplace_back(scaling_key{0.0, glm::vec3{1.f}});
-				}
-			}
-
-			// Some lil' optimization flags:
-			anode.mSameRotationAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mRotationKeys);
-			anode.mSameScalingAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mScalingKeys);
+		auto addAnimatedNode = [&](size_t bNode, std::optional<size_t> bAnimatedParentIndex, const glm::mat4& bUnanimatedParentTransform){
+			auto& anode = result->mNodes.emplace_back();
+			result->mModelNodeIndices.push_back(bNode);
+			mapNodeToAniNodeIndex[bNode] = result->mNodes.size() - 1;
 
 			anode.mAnimatedParentIndex = bAnimatedParentIndex;
 			anode.mParentTransform = bUnanimatedParentTransform;
 			if (anode.mAnimatedParentIndex.has_value()) {
 				assert(!(
-					result.mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform[0][0] == 0.0f &&
-					result.mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform[1][1] == 0.0f &&
-					result.mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform[2][2] == 0.0f &&
-					result.mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform[3][3] == 0.0f
+					result->mNodes[anode.mAnimatedParentIndex.value()].mRestGlobalTransform[0][0] == 0.0f &&
+					result->mNodes[anode.mAnimatedParentIndex.value()].mRestGlobalTransform[1][1] == 0.0f &&
+					result->mNodes[anode.mAnimatedParentIndex.value()].mRestGlobalTransform[2][2] == 0.0f &&
+					result->mNodes[anode.mAnimatedParentIndex.value()].mRestGlobalTransform[3][3] == 0.0f
 				));
-				anode.mGlobalTransform = result.mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform * anode.mParentTransform;
+				anode.mRestGlobalTransform = result->mNodes[anode.mAnimatedParentIndex.value()].mRestGlobalTransform * anode.mParentTransform;
 			}
 			else {
-				anode.mGlobalTransform = anode.mParentTransform;
+				anode.mRestGlobalTransform = anode.mParentTransform;
 			}
 
-			anode.mLocalTransform = to_mat4(bNode->mTransformation);
+			anode.mLocalTransform = mNodeLocalTransforms[bNode];
 
 			// See if we have an inverse bind pose matrix for this node:
-			assert(nullptr == bChannel || mapNameToNode.find(to_string(bChannel->mNodeName))->second == bNode);
 			for (size_t i = 0; i < mapsBoneToMatrixInfo.size(); ++i) {
 				auto it = mapsBoneToMatrixInfo[i].find(bNode);
 				if (std::end(mapsBoneToMatrixInfo[i]) != it) {
@@ -996,8 +1930,7 @@ namespace gvk
 				}
 			}
 			// Is this node, by chance, one of the mesh roots? 
-			for (uint32_t x = 0u; x < bNode->mNumMeshes; ++x) {
-				const auto mi = bNode->mMeshes[x];
+			for (const auto mi : mNodeMeshIndices[bNode]) {
 				// find its index:
 				assert (fakeBoneToMatrixInfos.size() == aMeshIndices.size());
 				for (size_t i = 0; i < aMeshIndices.size(); ++i) {
@@ -1014,40 +1947,6 @@ namespace gvk
 		};
 		// -----------------------------------------------------------------------------------
 
-		// Evaluate the data from the animation and fill mapNodeToBoneAnimation.
-		assert(aAnimationIndex >= 0u && aAnimationIndex <= mScene->mNumAnimations);
-		auto* ani = mScene->mAnimations[aAnimationIndex];
-		for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
-			auto* channel = ani->mChannels[i];
-
-			auto it = mapNameToNode.find(to_string(channel->mNodeName));
-			if (it == std::end(mapNameToNode)) {
-				LOG_ERROR(fmt::format("Node name '{}', referenced from channel[{}], could not be found in the nodeMap.", to_string(channel->mNodeName), i));
-				continue;
-			}
-
-			//if (channel->mNumPositionKeys + channel->mNumRotationKeys + channel->mNumScalingKeys > 0) {
-			//requiredForAnimation.insert(it->second);
-			mapNodeToBoneAnimation[it->second] = channel;
-			//// Also mark all its parent nodes as required for animation (but not modified by bones!):
-			//auto* parent = it->second->mParent;
-			//while (nullptr != parent) {
-			//	requiredForAnimation.insert(parent);
-			//	parent = parent->mParent;
-			//}
-			//}
-		}
-
-		//// Checks whether the given node is required for this animation (by searching it in requiredForAnimation)
-		//auto isNodeRequiredForAnimation = [&](aiNode* bNode) {
-		//	const auto it = requiredForAnimation.find(bNode);
-		//	if (std::end(requiredForAnimation) != it) {
-		//		assert( *it == bNode );
-		//		return true;
-		//	}
-		//	return false;
-		//};
-
 		for (size_t i = 0; i < aMeshIndices.size(); ++i) {
 			auto& bmi = mapsBoneToMatrixInfo.emplace_back();
 			auto& fkb = fakeBoneToMatrixInfos.emplace_back();
@@ -1055,25 +1954,24 @@ namespace gvk
 
 			glm::mat4 inverseMeshRootMatrix = glm::inverse(transformation_matrix_for_mesh(mi));
 
-			assert(mi >= 0u && mi < mScene->mNumMeshes);
+			assert(mi >= 0u && mi < num_meshes());
 			flagsBonesAddedAsAniNodes.emplace_back(static_cast<size_t>(num_bone_matrices(mi)), false); // Note: num_bone_matrices(mi) here, but num_actual_bones(mi) down there in the loop!
 			// Vector with a flag for each bone
 
 			// For each bone, create boneMatrixInfo:
 			const auto nb = num_bone_matrices(mi);
 			for (uint32_t bi = 0; bi < nb; ++bi) {
-				if (bi < mScene->mMeshes[mi]->mNumBones) {
-					auto* bone = mScene->mMeshes[mi]->mBones[bi];
-
-					auto it = mapNameToNode.find(to_string(bone->mName));
-					if (it == std::end(mapNameToNode)) {
-						LOG_ERROR(fmt::format("Bone named '{}' could not be found in the nodeMap.", to_string(bone->mName)));
+				if (bi < num_actual_bones(mi)) {
+					const auto boneName = name_of_bone(mi, bi);
+					auto boneNode = last_node_index_by_name(boneName);
+					if (!boneNode.has_value()) {
+						LOG_ERROR(fmt::format("Bone named '{}' could not be found in the model's nodes.", boneName));
 						continue;
 					}
 
-					assert(!bmi.contains(it->second));
-					bmi[it->second] = bone_mesh_data{
-						to_mat4(bone->mOffsetMatrix),
+					assert(!bmi.contains(boneNode.value()));
+					bmi[boneNode.value()] = bone_mesh_data{
+						offset_matrix_of_bone(mi, bi),
 						inverseMeshRootMatrix,
 						mesh_bone_info{i, mi, bi, boneIndexOffsetsPerMesh[mi]}
 					};
@@ -1090,62 +1988,34 @@ namespace gvk
 
 		// ---------------------------------------------
 		// AND NOW: Construct the animated_nodes "tree"
-#ifdef _DEBUG
-		{
-			std::vector<aiNode*> sanityCheck;
-			for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
-				auto* channel = ani->mChannels[i];
-				auto it = mapNameToNode.find(to_string(channel->mNodeName));
-				if (it == std::end(mapNameToNode)) {
-					sanityCheck.push_back(it->second);
-				}
-			}
-			std::sort(std::begin(sanityCheck), std::end(sanityCheck));
-			auto uniqueEnd = std::unique(std::begin(sanityCheck), std::end(sanityCheck));
-			if (uniqueEnd != std::end(sanityCheck)) {
-				LOG_WARNING(
-					fmt::format(
-						"Some nodes are contained multiple times in the animation channels of animation[{}]. Don't know if that's going to lead to correct results."
-						, aAnimationIndex));
-			}
-		}
-#endif
-
-		// Let's go:
-		for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
-			auto* channel = ani->mChannels[i];
-
-			auto it = mapNameToNode.find(to_string(channel->mNodeName));
-			if (it == std::end(mapNameToNode)) {
-				LOG_ERROR(fmt::format("Node name '{}', referenced from channel[{}], could not be found in the nodeMap.", to_string(channel->mNodeName), i));
+		for (const auto node : aAnimatedNodes) {
+			if (isNodeAlreadyAdded(node).has_value()) {
 				continue;
 			}
 
-			auto* node = it->second;
-			std::stack<aiNode*> boneAnimatedParents;
-			auto* parent = node->mParent;
-			while (nullptr != parent) {
-				if (isNodeModifiedByBones(parent) && !isNodeAlreadyAdded(parent).has_value()) {
-					boneAnimatedParents.push(parent);
-					LOG_DEBUG(fmt::format("Interesting: Node '{}' in parent-hierarchy of node '{}' is also bone-animated, but not encountered them while iterating through channels yet.", parent->mName.C_Str(), node->mName.C_Str()));
+			std::stack<size_t> boneAnimatedParents;
+			auto parent = mNodeParentIndices[node];
+			while (parent.has_value()) {
+				if (isNodeModifiedByBones(parent.value()) && !isNodeAlreadyAdded(parent.value()).has_value()) {
+					boneAnimatedParents.push(parent.value());
+					LOG_DEBUG(fmt::format("Interesting: Node '{}' in parent-hierarchy of node '{}' is also bone-animated, but not encountered them while iterating through channels yet.", mNodeNames[parent.value()], mNodeNames[node]));
 				}
-				parent = parent->mParent;
+				parent = mNodeParentIndices[parent.value()];
 			}
 
 			// First, add the stack of parents, then add the node itself
 			while (!boneAnimatedParents.empty()) {
 				auto parentToBeAdded = boneAnimatedParents.top();
-				assert(mapNodeToBoneAnimation.contains(parentToBeAdded));
-				addAnimatedNode(mapNodeToBoneAnimation[parentToBeAdded], parentToBeAdded, getAnimatedParentIndex(parentToBeAdded), getUnanimatedParentTransform(parentToBeAdded));
+				addAnimatedNode(parentToBeAdded, getAnimatedParentIndex(parentToBeAdded), getUnanimatedParentTransform(parentToBeAdded));
 				boneAnimatedParents.pop();
 			}
-			addAnimatedNode(mapNodeToBoneAnimation[node], node, getAnimatedParentIndex(node), getUnanimatedParentTransform(node));
+			addAnimatedNode(node, getAnimatedParentIndex(node), getUnanimatedParentTransform(node));
 		}
 
 		// It could be that there are still bones for which we have not set up an animated_node entry and hence,
 		// no bone matrix will be written for them.
-		// This happened for all bones which are not affected by the given animation. We must write a bone matrix
-		// for them as well => Find them and add them as animated_node entry (but without any position/rotation/scaling keys).
+		// This happened for all bones which are not affected by the given animation(s). We must write a bone matrix
+		// for them as well => Find them and add them as animated_node entry (which will not have any keys).
 		assert(flagsBonesAddedAsAniNodes.size() == aMeshIndices.size());
 		for (size_t i = 0; i < aMeshIndices.size(); ++i) {
 			const auto mi = aMeshIndices[i];
@@ -1158,23 +2028,17 @@ namespace gvk
 					continue;
 				}
 
-				if (bi < mScene->mMeshes[mi]->mNumBones) {
-					auto* bone = mScene->mMeshes[mi]->mBones[bi];
-					auto it = mapNameToNode.find(to_string(bone->mName));
-					assert(std::end(mapNameToNode) != it);
-
-					addAnimatedNode(
-						nullptr, // <-- This is fine. This node is just not affected by animation but still needs to receive bone matrix updates
-						it->second, getAnimatedParentIndex(it->second), getUnanimatedParentTransform(it->second)
-					);
+				if (bi < num_actual_bones(mi)) {
+					auto boneNode = last_node_index_by_name(name_of_bone(mi, bi));
+					assert(boneNode.has_value());
+					// This node is just not affected by animation but still needs to receive bone matrix updates:
+					addAnimatedNode(boneNode.value(), getAnimatedParentIndex(boneNode.value()), getUnanimatedParentTransform(boneNode.value()));
 				}
 				else {
-					auto* meshRootNode = find_mesh_root_node(mi);
-					assert(nullptr != meshRootNode);
-					addAnimatedNode(
-						nullptr, // <-- This is fine. This node is just not affected by animation but still needs to receive bone matrix updates
-						meshRootNode, getAnimatedParentIndex(meshRootNode), getUnanimatedParentTransform(meshRootNode)
-					);
+					auto meshRootNode = node_index_for_mesh(mi);
+					assert(meshRootNode.has_value());
+					// This node is just not affected by animation but still needs to receive bone matrix updates:
+					addAnimatedNode(meshRootNode.value(), getAnimatedParentIndex(meshRootNode.value()), getUnanimatedParentTransform(meshRootNode.value()));
 				}
 			}
 		}
@@ -1182,28 +2046,153 @@ namespace gvk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const
+	animation_track_set model_t::build_animation_track_set(const animation_skeleton& aSkeleton, uint32_t aAnimationIndex, const std::optional<keyframe_reduction_config>& aKeyframeReduction, keyframe_reduction_result& aStatistics) const
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aCamera->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
+		if (aAnimationIndex >= mAnimationTracks.size()) {
+			throw gvk::runtime_error(fmt::format("Requested animation index {} is out of bounds for model '{}' with {} animations.", aAnimationIndex, mModelPath, mAnimationTracks.size()));
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_camera(aCamera, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
+		animation_track_set result;
+		result.mAnimationIndex = aAnimationIndex;
+		result.mNodeKeys.resize(aSkeleton.mNodes.size());
+
+		std::unordered_map<size_t, size_t> mapNodeToAniNodeIndex;
+		for (size_t i = 0; i < aSkeleton.mModelNodeIndices.size(); ++i) {
+			mapNodeToAniNodeIndex[aSkeleton.mModelNodeIndices[i]] = i;
+		}
+
+		std::vector<bool> nodesWithChannel(aSkeleton.mNodes.size(), false);
+		for (const auto& channel : mAnimationTracks[aAnimationIndex].mChannels) {
+			auto channelNode = last_node_index_by_name(channel.mNodeName);
+			if (!channelNode.has_value()) {
+				continue; // has been reported by nodes_animated_by
+			}
+			auto it = mapNodeToAniNodeIndex.find(channelNode.value());
+			if (std::end(mapNodeToAniNodeIndex) == it) {
+				throw gvk::logic_error(fmt::format("Node '{}', which is animated by animation {}, is not contained in the skeleton. Was the skeleton prepared by a different model or for a different animation?", channel.mNodeName, aAnimationIndex));
+			}
+			if (nodesWithChannel[it->second]) {
+				continue;
+			}
+			nodesWithChannel[it->second] = true;
+
+			auto& anode = result.mNodeKeys[it->second];
+			anode.mPositionKeys = channel.mPositionKeys;
+			anode.mRotationKeys = channel.mRotationKeys;
+			anode.mScalingKeys = channel.mScalingKeys;
+			if (aKeyframeReduction.has_value()) {
+				aStatistics += reduce_keyframes(anode, aKeyframeReduction.value());
+			}
+
+			// Tidy-up the keys:
+			//
+			// There is one special case which will occur (probably often) in practice. That is, that there
+			// are no keys at all (position + rotation + scaling == 0), because the animation does not modify a
+			// given node. That is always the case for the nodes of the skeleton which this animation has no
+			// channel for, e.g. bones which need to receive a proper bone matrix nevertheless.
+			//
+			// If it is not the special case, then assure that there ARE keys in each of the keys-collections,
+			// that will (hopefully) make animation more performant because it requires fewer ifs.
+			if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() > 0) {
+				if (anode.mPositionKeys.empty()) {
+					// The time doesn't really matter, but do not apply any translation
+					anode.mPositionKeys.emplace_back(position_key{0.0, glm::vec3{0.f}});
+				}
+				if (anode.mRotationKeys.empty()) {
+					// The time doesn't really matter, but do not apply any rotation
+					anode.mRotationKeys.emplace_back(rotation_key{0.0, glm::quat(1.f, 0.f, 0.f, 0.f)});
+				}
+				if (anode.mScalingKeys.empty()) {
+					// The time doesn't really matter, but do not apply any scaling
+					anode.mScalingKeys.emplace_back(scaling_key{0.0, glm::vec3{1.f}});
+				}
 			}
+
+			// Some lil' optimization flags:
+			anode.mSameRotationAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mRotationKeys);
+			anode.mSameScalingAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mScalingKeys);
 		}
-		return {};
+
+		return result;
 	}
 
-	void model_t::add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode)
+	void model_t::log_keyframe_reduction(std::string_view aAnimations, const keyframe_reduction_result& aStatistics) const
 	{
-		aNodeMap[to_string(aNode->mName)] = aNode;
-		for (unsigned int i = 0; i < aNode->mNumChildren; ++i) {
-			add_all_to_node_map(aNodeMap, aNode->mChildren[i]);
+		LOG_INFO(fmt::format("Keyframe reduction of {} of model '{}' kept {} of {} keys, i.e. {} of {} bytes. Max. errors: position {}, rotation {} rad, scaling {}.",
+			aAnimations, mModelPath, aStatistics.mNumKeysAfter, aStatistics.mNumKeysBefore, aStatistics.mBytesAfter, aStatistics.mBytesBefore,
+			aStatistics.mMaxPositionError, aStatistics.mMaxRotationError, aStatistics.mMaxScalingError));
+	}
+
+	animation model_t::prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices, std::optional<keyframe_reduction_config> aKeyframeReduction) const
+	{
+		// The skeleton contains only the nodes which are animated by this animation (and the bones):
+		return prepare_animation(aAnimationIndex, build_animation_skeleton(nodes_animated_by(aAnimationIndex), aMeshIndices), std::move(aKeyframeReduction));
+	}
+
+	std::shared_ptr<const animation_skeleton> model_t::prepare_animation_skeleton(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		std::vector<size_t> animatedNodes;
+		for (uint32_t ai = 0; ai < num_animations(); ++ai) {
+			auto nodes = nodes_animated_by(ai);
+			animatedNodes.insert(std::end(animatedNodes), std::begin(nodes), std::end(nodes));
 		}
+		return build_animation_skeleton(animatedNodes, aMeshIndices);
+	}
+
+	animation model_t::prepare_animation(uint32_t aAnimationIndex, std::shared_ptr<const animation_skeleton> aSkeleton, std::optional<keyframe_reduction_config> aKeyframeReduction) const
+	{
+		if (!aSkeleton) {
+			throw gvk::logic_error("prepare_animation requires a skeleton.");
+		}
+		keyframe_reduction_result keyframeReduction;
+		auto tracks = std::make_shared<const animation_track_set>(build_animation_track_set(*aSkeleton, aAnimationIndex, aKeyframeReduction, keyframeReduction));
+		if (aKeyframeReduction.has_value()) {
+			log_keyframe_reduction(fmt::format("animation {}", aAnimationIndex), keyframeReduction);
+		}
+		return animation(std::move(aSkeleton), std::move(tracks));
+	}
+
+	std::vector<animation> model_t::prepare_all_animations(const std::vector<mesh_index_t>& aMeshIndices, std::optional<keyframe_reduction_config> aKeyframeReduction) const
+	{
+		auto skeleton = prepare_animation_skeleton(aMeshIndices);
+
+		const auto numAnimations = num_animations();
+		std::vector<std::shared_ptr<const animation_track_set>> tracks(numAnimations);
+		std::vector<keyframe_reduction_result> keyframeReductions(numAnimations);
+		std::vector<uint32_t> indices(numAnimations);
+		std::iota(std::begin(indices), std::end(indices), 0u);
+		// Invalid channels or tick rates throw; the first exception is rethrown after the parallel loop instead of escaping it:
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		std::for_each(std::execution::par, std::begin(indices), std::end(indices), [&](uint32_t ai) {
+			try {
+				tracks[ai] = std::make_shared<const animation_track_set>(build_animation_track_set(*skeleton, ai, aKeyframeReduction, keyframeReductions[ai]));
+			}
+			catch (...) {
+				std::scoped_lock lock(exceptionMutex);
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		});
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+
+		std::vector<animation> result;
+		result.reserve(numAnimations);
+		size_t trackBytes = 0;
+		keyframe_reduction_result keyframeReduction;
+		for (uint32_t ai = 0; ai < numAnimations; ++ai) {
+			trackBytes += tracks[ai]->size_in_bytes();
+			keyframeReduction += keyframeReductions[ai];
+			result.emplace_back(skeleton, std::move(tracks[ai]));
+		}
+
+		if (aKeyframeReduction.has_value()) {
+			log_keyframe_reduction(fmt::format("all {} animations", numAnimations), keyframeReduction);
+		}
+		LOG_INFO(fmt::format("Prepared {} animations of model '{}' with one shared skeleton of {} nodes: {} bytes for the skeleton and {} bytes for the keys.",
+			numAnimations, mModelPath, skeleton->mNodes.size(), skeleton->size_in_bytes(), trackBytes));
+		return result;
 	}
 }
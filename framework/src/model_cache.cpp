@@ -0,0 +1,119 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	model_cache::model_cache()
+		: mData{ std::make_shared<cache_data>() }
+	{ }
+
+	std::string model_cache::make_key(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags)
+	{
+		return fmt::format("{}|{:x}", avk::clean_up_path(aPath), aAssimpFlags);
+	}
+
+	std::shared_ptr<const model_t> model_cache::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, const load_progress_callback& aProgressCallback)
+	{
+		const auto key = make_key(aPath, aAssimpFlags);
+
+		std::promise<std::shared_ptr<const model_t>> import;
+		std::shared_ptr<const model_t> cached;
+		while (!cached) {
+			std::shared_future<std::shared_ptr<const model_t>> otherImport;
+			{
+				std::scoped_lock guard(mData->mMutex);
+				auto& e = mData->mEntries[key];
+				cached = e.mModel.lock();
+				if (!cached) {
+					if (e.mImport.valid()) {
+						otherImport = e.mImport;
+					}
+					else {
+						// This request is going to import the model, all others have to wait for it:
+						e.mImport = import.get_future().share();
+					}
+				}
+			}
+			if (!otherImport.valid()) {
+				break;
+			}
+			// Yields nullptr if the other request has cancelled its import => try again, which might make this request the importing one:
+			cached = otherImport.get();
+		}
+		if (cached) {
+			if (aProgressCallback) {
+				aProgressCallback(1.0f);
+			}
+			return cached;
+		}
+
+		// Cancellation is only a matter of this request => tell it apart from failed imports:
+		bool cancelled = false;
+		load_progress_callback progressCallback;
+		if (aProgressCallback) {
+			progressCallback = [&aProgressCallback, &cancelled](float bProgress) {
+				cancelled = !aProgressCallback(bProgress);
+				return !cancelled;
+			};
+		}
+
+		std::shared_ptr<const model_t> result;
+		try {
+			auto loaded = model_t::load_from_file(aPath, aAssimpFlags, false, progressCallback);
+			result = std::shared_ptr<const model_t>(new model_t(std::move(*loaded)), [lData = std::weak_ptr<cache_data>(mData), key](const model_t* bModel) {
+				// Evict the model, unless it is being imported anew already:
+				if (auto data = lData.lock()) {
+					std::scoped_lock guard(data->mMutex);
+					auto it = data->mEntries.find(key);
+					if (it != std::end(data->mEntries) && !it->second.mImport.valid() && it->second.mModel.expired()) {
+						data->mEntries.erase(it);
+					}
+				}
+				delete bModel;
+			});
+		}
+		catch (...) {
+			{
+				std::scoped_lock guard(mData->mMutex);
+				mData->mEntries.erase(key);
+			}
+			if (cancelled) {
+				import.set_value(nullptr);
+			}
+			else {
+				import.set_exception(std::current_exception());
+			}
+			throw;
+		}
+
+		{
+			std::scoped_lock guard(mData->mMutex);
+			auto& e = mData->mEntries[key];
+			e.mModel = result;
+			e.mImport = {};
+		}
+		import.set_value(result);
+		return result;
+	}
+
+	std::shared_ptr<const model_t> model_cache::find(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags) const
+	{
+		std::scoped_lock guard(mData->mMutex);
+		auto it = mData->mEntries.find(make_key(aPath, aAssimpFlags));
+		if (it == std::end(mData->mEntries)) {
+			return nullptr;
+		}
+		return it->second.mModel.lock();
+	}
+
+	size_t model_cache::size() const
+	{
+		std::scoped_lock guard(mData->mMutex);
+		return mData->mEntries.size();
+	}
+
+	model_cache& model_cache::shared()
+	{
+		static model_cache sCache;
+		return sCache;
+	}
+}
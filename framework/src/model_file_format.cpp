@@ -0,0 +1,516 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Values of these types are written to and read from the metadata section as they are in memory:
+	template <typename T> inline constexpr bool is_raw_model_file_value = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+	template <glm::length_t L, typename T, glm::qualifier Q> inline constexpr bool is_raw_model_file_value<glm::vec<L, T, Q>> = true;
+	template <glm::length_t C, glm::length_t R, typename T, glm::qualifier Q> inline constexpr bool is_raw_model_file_value<glm::mat<C, R, T, Q>> = true;
+	template <typename T, glm::qualifier Q> inline constexpr bool is_raw_model_file_value<glm::qua<T, Q>> = true;
+	template <> inline constexpr bool is_raw_model_file_value<avk::cfg::color_blending_config> = true;
+
+	/** Appends values to a metadata section. Types which are not raw values are handled by the transfer functions below. */
+	class model_file_writer
+	{
+	public:
+		template <typename T>
+		void operator()(const T& aValue)
+		{
+			if constexpr (is_raw_model_file_value<T>) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				const auto* bytes = reinterpret_cast<const std::byte*>(&aValue);
+				mData.insert(std::end(mData), bytes, bytes + sizeof(T));
+			}
+			else {
+				// Transfer functions are shared between writing and reading, therefore they take non-const references:
+				transfer(*this, const_cast<T&>(aValue));
+			}
+		}
+
+		void operator()(const std::string& aValue)
+		{
+			(*this)(static_cast<uint64_t>(aValue.size()));
+			const auto* bytes = reinterpret_cast<const std::byte*>(aValue.data());
+			mData.insert(std::end(mData), bytes, bytes + aValue.size());
+		}
+
+		template <typename T>
+		void operator()(const std::vector<T>& aValues)
+		{
+			(*this)(static_cast<uint64_t>(aValues.size()));
+			for (const auto& value : aValues) {
+				(*this)(value);
+			}
+		}
+
+		const std::vector<std::byte>& data() const { return mData; }
+
+	private:
+		std::vector<std::byte> mData;
+	};
+
+	/** Reads values from a metadata section, and throws if the section ends prematurely. */
+	class model_file_reader
+	{
+	public:
+		model_file_reader(std::span<const std::byte> aData) : mData{ aData } {}
+
+		template <typename T>
+		void operator()(T& aValue)
+		{
+			if constexpr (is_raw_model_file_value<T>) {
+				std::memcpy(&aValue, take(sizeof(T)), sizeof(T));
+			}
+			else {
+				transfer(*this, aValue);
+			}
+		}
+
+		void operator()(std::string& aValue)
+		{
+			const auto size = read_size(1);
+			const auto* bytes = take(size);
+			aValue.assign(reinterpret_cast<const char*>(bytes), size);
+		}
+
+		template <typename T>
+		void operator()(std::vector<T>& aValues)
+		{
+			// Every element occupies at least one byte => prevent huge allocations for corrupted sizes:
+			aValues.resize(read_size(1));
+			for (auto& value : aValues) {
+				(*this)(value);
+			}
+		}
+
+	private:
+		size_t read_size(size_t aMinBytesPerElement)
+		{
+			uint64_t size;
+			(*this)(size);
+			if (size > (mData.size() - mPosition) / aMinBytesPerElement) {
+				throw gvk::runtime_error("Invalid size in the metadata section of a binary model file.");
+			}
+			return static_cast<size_t>(size);
+		}
+
+		const std::byte* take(size_t aNumBytes)
+		{
+			if (aNumBytes > mData.size() - mPosition) {
+				throw gvk::runtime_error("Unexpected end of the metadata section of a binary model file.");
+			}
+			const auto* result = mData.data() + mPosition;
+			mPosition += aNumBytes;
+			return result;
+		}
+
+		std::span<const std::byte> mData;
+		size_t mPosition = 0;
+	};
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, mesh_store_stream& aValue)
+	{
+		aArchive(aValue.mOffset);
+		aArchive(aValue.mNumComponents);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, mesh_store_mesh& aValue)
+	{
+		aArchive(aValue.mName);
+		aArchive(aValue.mMaterialIndex);
+		aArchive(aValue.mPrimitiveTypes);
+		aArchive(aValue.mNumVertices);
+		aArchive(aValue.mIndicesOffset);
+		aArchive(aValue.mNumIndices);
+		aArchive(aValue.mPositions);
+		aArchive(aValue.mNormals);
+		aArchive(aValue.mTangents);
+		aArchive(aValue.mBitangents);
+		for (auto& stream : aValue.mColors) {
+			aArchive(stream);
+		}
+		for (auto& stream : aValue.mTextureCoordinates) {
+			aArchive(stream);
+		}
+		aArchive(aValue.mBonesOffset);
+		aArchive(aValue.mNumBones);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, mesh_store_bone& aValue)
+	{
+		aArchive(aValue.mName);
+		aArchive(aValue.mOffsetMatrix);
+		aArchive(aValue.mWeightsOffset);
+		aArchive(aValue.mNumWeights);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, position_key& aValue)
+	{
+		aArchive(aValue.mTime);
+		aArchive(aValue.mValue);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, rotation_key& aValue)
+	{
+		aArchive(aValue.mTime);
+		aArchive(aValue.mValue);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, scaling_key& aValue)
+	{
+		aArchive(aValue.mTime);
+		aArchive(aValue.mValue);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, animation_channel& aValue)
+	{
+		aArchive(aValue.mNodeName);
+		aArchive(aValue.mPositionKeys);
+		aArchive(aValue.mRotationKeys);
+		aArchive(aValue.mScalingKeys);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, animation_tracks& aValue)
+	{
+		aArchive(aValue.mName);
+		aArchive(aValue.mTicksPerSecond);
+		aArchive(aValue.mDurationTicks);
+		aArchive(aValue.mChannels);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, morph_target& aValue)
+	{
+		aArchive(aValue.mName);
+		aArchive(aValue.mVertexIndices);
+		aArchive(aValue.mPositionDeltas);
+		aArchive(aValue.mNormalDeltas);
+		aArchive(aValue.mDefaultWeight);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, morph_target_set& aValue)
+	{
+		aArchive(aValue.mNumVertices);
+		aArchive(aValue.mTargets);
+	}
+
+	template <typename Archive>
+	void transfer(Archive& aArchive, material_config& aValue)
+	{
+		aArchive(aValue.mName);
+		aArchive(aValue.mIgnoreCpuOnlyDataForEquality);
+		aArchive(aValue.mShadingModel);
+		aArchive(aValue.mWireframeMode);
+		aArchive(aValue.mTwosided);
+		aArchive(aValue.mBlendMode);
+		aArchive(aValue.mDiffuseReflectivity);
+		aArchive(aValue.mAmbientReflectivity);
+		aArchive(aValue.mSpecularReflectivity);
+		aArchive(aValue.mEmissiveColor);
+		aArchive(aValue.mTransparentColor);
+		aArchive(aValue.mReflectiveColor);
+		aArchive(aValue.mAlbedo);
+		aArchive(aValue.mOpacity);
+		aArchive(aValue.mBumpScaling);
+		aArchive(aValue.mShininess);
+		aArchive(aValue.mShininessStrength);
+		aArchive(aValue.mRefractionIndex);
+		aArchive(aValue.mReflectivity);
+		aArchive(aValue.mMetallic);
+		aArchive(aValue.mSmoothness);
+		aArchive(aValue.mSheen);
+		aArchive(aValue.mThickness);
+		aArchive(aValue.mRoughness);
+		aArchive(aValue.mAnisotropy);
+		aArchive(aValue.mAnisotropyRotation);
+		aArchive(aValue.mCustomData);
+		aArchive(aValue.mDiffuseTex);
+		aArchive(aValue.mSpecularTex);
+		aArchive(aValue.mAmbientTex);
+		aArchive(aValue.mEmissiveTex);
+		aArchive(aValue.mHeightTex);
+		aArchive(aValue.mNormalsTex);
+		aArchive(aValue.mShininessTex);
+		aArchive(aValue.mOpacityTex);
+		aArchive(aValue.mDisplacementTex);
+		aArchive(aValue.mReflectionTex);
+		aArchive(aValue.mLightmapTex);
+		aArchive(aValue.mExtraTex);
+		aArchive(aValue.mDiffuseTexOffsetTiling);
+		aArchive(aValue.mSpecularTexOffsetTiling);
+		aArchive(aValue.mAmbientTexOffsetTiling);
+		aArchive(aValue.mEmissiveTexOffsetTiling);
+		aArchive(aValue.mHeightTexOffsetTiling);
+		aArchive(aValue.mNormalsTexOffsetTiling);
+		aArchive(aValue.mShininessTexOffsetTiling);
+		aArchive(aValue.mOpacityTexOffsetTiling);
+		aArchive(aValue.mDisplacementTexOffsetTiling);
+		aArchive(aValue.mReflectionTexOffsetTiling);
+		aArchive(aValue.mLightmapTexOffsetTiling);
+		aArchive(aValue.mExtraTexOffsetTiling);
+	}
+
+	/** Reinterprets a section of a mapped binary model file as an array of the given type */
+	template <typename T>
+	static std::span<T> section_as(std::span<std::byte> aSection, const std::string& aPath)
+	{
+		if (aSection.size() % sizeof(T) != 0 || reinterpret_cast<uintptr_t>(aSection.data()) % alignof(T) != 0) {
+			throw gvk::runtime_error(fmt::format("A section of the binary model file '{}' has an invalid size or alignment.", aPath));
+		}
+		return std::span<T>(reinterpret_cast<T*>(aSection.data()), aSection.size() / sizeof(T));
+	}
+
+	void model_t::save_to_binary_file(const std::string& aPath) const
+	{
+		const auto n = num_meshes();
+
+		// Material configs are created lazily from Assimp's materials => make sure that all of them exist:
+		for (mesh_index_t i = 0; i < n; ++i) {
+			material_config_for_mesh(i);
+		}
+
+		// While the scene is available, it is the source of truth (it might have been modified by optimize_meshes):
+		std::optional<mesh_store> converted;
+		const mesh_store& store = has_scene() ? converted.emplace(mesh_store::create_from_scene(mScene)) : mMeshStore.value();
+
+		std::vector<std::string> materialNames;
+		if (has_scene()) {
+			for (unsigned int i = 0; i < mScene->mNumMaterials; ++i) {
+				materialNames.push_back(name_of_material(i));
+			}
+		}
+		else {
+			materialNames = mMaterialNames;
+		}
+
+		std::vector<int64_t> nodeParentIndices;
+		nodeParentIndices.reserve(mNodeParentIndices.size());
+		for (const auto& parentIndex : mNodeParentIndices) {
+			nodeParentIndices.push_back(parentIndex.has_value() ? static_cast<int64_t>(parentIndex.value()) : int64_t{ -1 });
+		}
+
+		model_file_writer metadata;
+		metadata(store.mMeshes);
+		metadata(store.mBones);
+		metadata(mNodeNames);
+		metadata(mNodeLocalTransforms);
+		metadata(nodeParentIndices);
+		metadata(mNodeMeshIndices);
+		metadata(materialNames);
+		for (mesh_index_t i = 0; i < n; ++i) {
+			metadata(mMaterialConfigPerMesh[i].value());
+		}
+		metadata(mAnimationTracks);
+		metadata(mMorphTargetsPerMesh);
+
+		const std::array<std::tuple<model_file_section_type, const std::byte*, uint64_t>, 4> payloads{{
+			{ model_file_section_type::metadata,     metadata.data().data(),                                   metadata.data().size() },
+			{ model_file_section_type::vertex_data,  reinterpret_cast<const std::byte*>(store.mVertexData.data()),  store.mVertexData.size_bytes() },
+			{ model_file_section_type::indices,      reinterpret_cast<const std::byte*>(store.mIndices.data()),     store.mIndices.size_bytes() },
+			{ model_file_section_type::bone_weights, reinterpret_cast<const std::byte*>(store.mBoneWeights.data()), store.mBoneWeights.size_bytes() }
+		}};
+
+		auto alignToPage = [](uint64_t bOffset) {
+			return (bOffset + model_file_page_size - 1) / model_file_page_size * model_file_page_size;
+		};
+
+		model_file_header header{};
+		header.mMagic = model_file_magic;
+		header.mVersion = model_file_version;
+		header.mNumSections = static_cast<uint32_t>(payloads.size());
+		header.mSectionEntrySize = static_cast<uint32_t>(sizeof(model_file_section));
+		header.mBoneWeightSize = static_cast<uint32_t>(sizeof(mesh_store_bone_weight));
+		header.mBlendConfigSize = static_cast<uint32_t>(sizeof(avk::cfg::color_blending_config));
+
+		std::vector<model_file_section> sections;
+		uint64_t offset = alignToPage(sizeof(model_file_header) + payloads.size() * sizeof(model_file_section));
+		for (const auto& [type, data, size] : payloads) {
+			sections.push_back(model_file_section{ type, 0u, offset, size });
+			offset = alignToPage(offset + size);
+		}
+
+		std::ofstream stream(aPath, std::ios::binary | std::ios::trunc);
+		if (!stream) {
+			throw gvk::runtime_error(fmt::format("Could not open '{}' for writing a binary model file.", aPath));
+		}
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		stream.write(reinterpret_cast<const char*>(sections.data()), static_cast<std::streamsize>(sections.size() * sizeof(model_file_section)));
+		for (size_t i = 0; i < payloads.size(); ++i) {
+			const auto& [type, data, size] = payloads[i];
+			// Pad with zeros up to the section's page-aligned offset:
+			const auto padding = static_cast<size_t>(sections[i].mOffset - static_cast<uint64_t>(stream.tellp()));
+			const std::vector<char> zeros(padding, 0);
+			stream.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+			stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+		}
+		if (!stream) {
+			throw gvk::runtime_error(fmt::format("Writing the binary model file '{}' failed.", aPath));
+		}
+		LOG_INFO(fmt::format("Wrote binary model file '{}' with {} meshes, {} nodes, and {} animations ({:.1f} MiB).", aPath, n, mNodeNames.size(), mAnimationTracks.size(), static_cast<double>(offset) / (1024.0 * 1024.0)));
+	}
+
+	avk::owning_resource<model_t> model_t::load_from_binary_file(const std::string& aPath)
+	{
+		auto file = std::make_shared<mapped_file>(mapped_file::map(aPath));
+
+		model_file_header header;
+		if (file->size() < sizeof(header)) {
+			throw gvk::runtime_error(fmt::format("'{}' is not a binary model file.", aPath));
+		}
+		std::memcpy(&header, file->data(), sizeof(header));
+		if (header.mMagic != model_file_magic) {
+			throw gvk::runtime_error(fmt::format("'{}' is not a binary model file.", aPath));
+		}
+		if (header.mVersion != model_file_version) {
+			throw gvk::runtime_error(fmt::format("The binary model file '{}' has version {}, but version {} is required. Please convert it again.", aPath, header.mVersion, model_file_version));
+		}
+		if (header.mSectionEntrySize != sizeof(model_file_section) || header.mBoneWeightSize != sizeof(mesh_store_bone_weight) || header.mBlendConfigSize != sizeof(avk::cfg::color_blending_config)) {
+			throw gvk::runtime_error(fmt::format("The binary model file '{}' has been written by an incompatible build. Please convert it again.", aPath));
+		}
+		if (file->size() < sizeof(header) + static_cast<size_t>(header.mNumSections) * sizeof(model_file_section)) {
+			throw gvk::runtime_error(fmt::format("The binary model file '{}' is truncated.", aPath));
+		}
+
+		std::unordered_map<model_file_section_type, std::span<std::byte>> sections;
+		for (uint32_t i = 0; i < header.mNumSections; ++i) {
+			model_file_section section;
+			std::memcpy(&section, file->data() + sizeof(header) + i * sizeof(model_file_section), sizeof(section));
+			if (section.mOffset % model_file_page_size != 0 || section.mOffset > file->size() || section.mSize > file->size() - section.mOffset) {
+				throw gvk::runtime_error(fmt::format("Section {} of the binary model file '{}' is out of bounds.", i, aPath));
+			}
+			sections[section.mType] = std::span<std::byte>(file->data() + section.mOffset, static_cast<size_t>(section.mSize));
+		}
+
+		auto section = [&](model_file_section_type bType) {
+			const auto it = sections.find(bType);
+			if (std::end(sections) == it) {
+				throw gvk::runtime_error(fmt::format("The binary model file '{}' lacks section {}.", aPath, static_cast<uint32_t>(bType)));
+			}
+			return it->second;
+		};
+
+		model_t result;
+		result.mModelPath = avk::clean_up_path(aPath);
+
+		// Bulk data is served straight from the mapped pages:
+		mesh_store store;
+		store.mVertexData = section_as<float>(section(model_file_section_type::vertex_data), aPath);
+		store.mIndices = section_as<uint32_t>(section(model_file_section_type::indices), aPath);
+		store.mBoneWeights = section_as<mesh_store_bone_weight>(section(model_file_section_type::bone_weights), aPath);
+
+		model_file_reader metadata{ section(model_file_section_type::metadata) };
+		metadata(store.mMeshes);
+		metadata(store.mBones);
+
+		std::vector<int64_t> nodeParentIndices;
+		metadata(result.mNodeNames);
+		metadata(result.mNodeLocalTransforms);
+		metadata(nodeParentIndices);
+		metadata(result.mNodeMeshIndices);
+		const auto numNodes = result.mNodeNames.size();
+		if (result.mNodeLocalTransforms.size() != numNodes || nodeParentIndices.size() != numNodes || result.mNodeMeshIndices.size() != numNodes) {
+			throw gvk::runtime_error(fmt::format("The node table of the binary model file '{}' is inconsistent.", aPath));
+		}
+		for (size_t i = 0; i < numNodes; ++i) {
+			// Parents must come before their children:
+			if (nodeParentIndices[i] >= static_cast<int64_t>(i)) {
+				throw gvk::runtime_error(fmt::format("The node table of the binary model file '{}' is not topologically ordered.", aPath));
+			}
+			result.mNodeParentIndices.push_back(nodeParentIndices[i] < 0 ? std::optional<size_t>{} : static_cast<size_t>(nodeParentIndices[i]));
+		}
+		const auto n = store.mMeshes.size();
+		for (const auto& meshIndices : result.mNodeMeshIndices) {
+			if (std::any_of(std::begin(meshIndices), std::end(meshIndices), [n](mesh_index_t bMeshIndex) { return bMeshIndex >= n; })) {
+				throw gvk::runtime_error(fmt::format("A node of the binary model file '{}' refers to a mesh which does not exist.", aPath));
+			}
+		}
+
+		metadata(result.mMaterialNames);
+		result.mMaterialConfigPerMesh.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			material_config config;
+			metadata(config);
+			result.mMaterialConfigPerMesh[i] = std::move(config);
+		}
+		metadata(result.mAnimationTracks);
+		metadata(result.mMorphTargetsPerMesh);
+		if (result.mMorphTargetsPerMesh.size() != n) {
+			throw gvk::runtime_error(fmt::format("The binary model file '{}' has morph targets for {} meshes, but contains {} meshes.", aPath, result.mMorphTargetsPerMesh.size(), n));
+		}
+
+		// Make sure that all the meshes only refer to valid ranges (the values within them are checked further below):
+		for (const auto& mesh : store.mMeshes) {
+			// The getters read fixed numbers of components per attribute, hence only accept those:
+			auto isWidth = [](const mesh_store_stream& bStream, std::initializer_list<uint32_t> bAllowed) {
+				return std::find(std::begin(bAllowed), std::end(bAllowed), bStream.mNumComponents) != std::end(bAllowed);
+			};
+			bool widthsValid = (0 == mesh.mNumVertices || 3 == mesh.mPositions.mNumComponents)
+				&& isWidth(mesh.mNormals, { 0, 3 }) && isWidth(mesh.mTangents, { 0, 3 }) && isWidth(mesh.mBitangents, { 0, 3 })
+				&& std::all_of(std::begin(mesh.mColors), std::end(mesh.mColors), [&](const mesh_store_stream& bStream) { return isWidth(bStream, { 0, 4 }); })
+				&& std::all_of(std::begin(mesh.mTextureCoordinates), std::end(mesh.mTextureCoordinates), [&](const mesh_store_stream& bStream) { return isWidth(bStream, { 0, 1, 2, 3 }); });
+			if (!widthsValid) {
+				throw gvk::runtime_error(fmt::format("Mesh '{}' of the binary model file '{}' has vertex attributes with unsupported numbers of components.", mesh.mName, aPath));
+			}
+			auto isValid = [&](uint64_t bOffset, uint64_t bCount, size_t bSize) { return bOffset <= bSize && bCount <= bSize - bOffset; };
+			bool valid = isValid(mesh.mIndicesOffset, mesh.mNumIndices, store.mIndices.size()) && isValid(mesh.mBonesOffset, mesh.mNumBones, store.mBones.size());
+			auto checkStream = [&](const mesh_store_stream& bStream) {
+				valid = valid && isValid(bStream.mOffset, static_cast<uint64_t>(mesh.mNumVertices) * bStream.mNumComponents, store.mVertexData.size());
+			};
+			checkStream(mesh.mPositions);
+			checkStream(mesh.mNormals);
+			checkStream(mesh.mTangents);
+			checkStream(mesh.mBitangents);
+			std::for_each(std::begin(mesh.mColors), std::end(mesh.mColors), checkStream);
+			std::for_each(std::begin(mesh.mTextureCoordinates), std::end(mesh.mTextureCoordinates), checkStream);
+			if (!valid) {
+				throw gvk::runtime_error(fmt::format("Mesh '{}' of the binary model file '{}' refers to data out of bounds.", mesh.mName, aPath));
+			}
+		}
+		for (size_t i = 0; i < n; ++i) {
+			const auto& targets = result.mMorphTargetsPerMesh[i];
+			bool valid = targets.empty() || targets.mNumVertices == store.mMeshes[i].mNumVertices;
+			for (const auto& target : targets.mTargets) {
+				valid = valid && target.mPositionDeltas.size() == target.mVertexIndices.size()
+					&& (target.mNormalDeltas.empty() || target.mNormalDeltas.size() == target.mVertexIndices.size())
+					&& std::all_of(std::begin(target.mVertexIndices), std::end(target.mVertexIndices), [&targets](uint32_t bIndex) { return bIndex < targets.mNumVertices; });
+			}
+			if (!valid) {
+				throw gvk::runtime_error(fmt::format("The morph targets of mesh '{}' of the binary model file '{}' are inconsistent.", store.mMeshes[i].mName, aPath));
+			}
+		}
+		for (const auto& bone : store.mBones) {
+			if (bone.mWeightsOffset > store.mBoneWeights.size() || bone.mNumWeights > store.mBoneWeights.size() - bone.mWeightsOffset) {
+				throw gvk::runtime_error(fmt::format("Bone '{}' of the binary model file '{}' refers to data out of bounds.", bone.mName, aPath));
+			}
+		}
+		// With all ranges valid, make sure that the indices and the bone weights only refer to vertices of their mesh:
+		for (const auto& mesh : store.mMeshes) {
+			const auto indices = store.mIndices.subspan(mesh.mIndicesOffset, mesh.mNumIndices);
+			if (std::any_of(std::begin(indices), std::end(indices), [&mesh](uint32_t bIndex) { return bIndex >= mesh.mNumVertices; })) {
+				throw gvk::runtime_error(fmt::format("Mesh '{}' of the binary model file '{}' contains indices of vertices which do not exist.", mesh.mName, aPath));
+			}
+			for (uint64_t b = mesh.mBonesOffset; b < mesh.mBonesOffset + mesh.mNumBones; ++b) {
+				const auto& bone = store.mBones[b];
+				const auto weights = store.mBoneWeights.subspan(bone.mWeightsOffset, bone.mNumWeights);
+				if (std::any_of(std::begin(weights), std::end(weights), [&mesh](const mesh_store_bone_weight& bWeight) { return bWeight.mVertexId >= mesh.mNumVertices; })) {
+					throw gvk::runtime_error(fmt::format("Bone '{}' of mesh '{}' of the binary model file '{}' weights vertices which do not exist.", bone.mName, mesh.mName, aPath));
+				}
+			}
+		}
+
+		store.mStorage = std::move(file);
+		result.mMeshStore = std::move(store);
+		result.initialize_node_lookups();
+		result.initialize_caches();
+		return result;
+	}
+}
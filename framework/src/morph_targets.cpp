@@ -0,0 +1,186 @@
+#include <gvk.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GVK_MORPH_TARGETS_SSE2
+#endif
+
+namespace gvk
+{
+	morph_target_set morph_target_set::create_from_mesh(const aiMesh* aMesh, float aThreshold)
+	{
+		morph_target_set result;
+		result.mNumVertices = aMesh->mNumVertices;
+		result.mTargets.reserve(aMesh->mNumAnimMeshes);
+
+		auto exceedsThreshold = [aThreshold](const glm::vec3& bDelta) {
+			return glm::any(glm::greaterThan(glm::abs(bDelta), glm::vec3{ aThreshold }));
+		};
+
+		for (unsigned int a = 0; a < aMesh->mNumAnimMeshes; ++a) {
+			const aiAnimMesh* paiAnimMesh = aMesh->mAnimMeshes[a];
+			auto& target = result.mTargets.emplace_back();
+			target.mName = paiAnimMesh->mName.C_Str();
+			target.mDefaultWeight = paiAnimMesh->mWeight;
+			if (paiAnimMesh->mNumVertices != aMesh->mNumVertices) {
+				LOG_WARNING(fmt::format("Morph target '{}' of mesh '{}' has {} vertices instead of {}. It is ignored.", target.mName, aMesh->mName.C_Str(), paiAnimMesh->mNumVertices, aMesh->mNumVertices));
+				continue;
+			}
+
+			const bool hasPositions = nullptr != paiAnimMesh->mVertices && nullptr != aMesh->mVertices;
+			const bool hasNormals = nullptr != paiAnimMesh->mNormals && nullptr != aMesh->mNormals;
+			bool anyNormalDelta = false;
+			for (unsigned int v = 0; v < aMesh->mNumVertices; ++v) {
+				const auto dp = hasPositions ? to_vec3(paiAnimMesh->mVertices[v]) - to_vec3(aMesh->mVertices[v]) : glm::vec3{ 0.0f };
+				const auto dn = hasNormals ? to_vec3(paiAnimMesh->mNormals[v]) - to_vec3(aMesh->mNormals[v]) : glm::vec3{ 0.0f };
+				const bool normalChanged = exceedsThreshold(dn);
+				if (!normalChanged && !exceedsThreshold(dp)) {
+					continue;
+				}
+				anyNormalDelta = anyNormalDelta || normalChanged;
+				target.mVertexIndices.push_back(v);
+				target.mPositionDeltas.push_back(dp);
+				target.mNormalDeltas.push_back(dn);
+			}
+			if (!anyNormalDelta) {
+				target.mNormalDeltas.clear();
+			}
+			target.mVertexIndices.shrink_to_fit();
+			target.mPositionDeltas.shrink_to_fit();
+			target.mNormalDeltas.shrink_to_fit();
+		}
+		return result;
+	}
+
+	size_t morph_target_set::num_deltas() const
+	{
+		size_t result = 0;
+		for (const auto& target : mTargets) {
+			result += target.mVertexIndices.size();
+		}
+		return result;
+	}
+
+	size_t morph_target_set::size_in_bytes() const
+	{
+		size_t result = 0;
+		for (const auto& target : mTargets) {
+			result += target.mVertexIndices.size() * sizeof(uint32_t)
+				+ target.mPositionDeltas.size() * sizeof(glm::vec3)
+				+ target.mNormalDeltas.size() * sizeof(glm::vec3);
+		}
+		return result;
+	}
+
+	void morph_target_set::remap_vertices(const std::vector<uint32_t>& aRemap)
+	{
+		for (auto& target : mTargets) {
+			const auto n = target.mVertexIndices.size();
+			// Keep the vertex indices in ascending order, i.e. sort the entries by their new vertex index:
+			std::vector<size_t> order(n);
+			std::iota(std::begin(order), std::end(order), size_t{ 0 });
+			std::sort(std::begin(order), std::end(order), [&](size_t bA, size_t bB) {
+				return aRemap[target.mVertexIndices[bA]] < aRemap[target.mVertexIndices[bB]];
+			});
+
+			std::vector<uint32_t> vertexIndices(n);
+			std::vector<glm::vec3> positionDeltas(n);
+			std::vector<glm::vec3> normalDeltas(target.mNormalDeltas.size());
+			for (size_t i = 0; i < n; ++i) {
+				vertexIndices[i] = aRemap[target.mVertexIndices[order[i]]];
+				positionDeltas[i] = target.mPositionDeltas[order[i]];
+				if (!normalDeltas.empty()) {
+					normalDeltas[i] = target.mNormalDeltas[order[i]];
+				}
+			}
+			target.mVertexIndices = std::move(vertexIndices);
+			target.mPositionDeltas = std::move(positionDeltas);
+			target.mNormalDeltas = std::move(normalDeltas);
+		}
+	}
+
+	/** Adds aWeight times the given sparse deltas to the given vec3 values */
+	static void accumulate_deltas(const std::vector<uint32_t>& aVertexIndices, const std::vector<glm::vec3>& aDeltas, float aWeight, glm::vec3* aValues)
+	{
+		const auto n = aVertexIndices.size();
+		const uint32_t* indices = aVertexIndices.data();
+		const float* deltas = glm::value_ptr(aDeltas.front());
+		float* values = glm::value_ptr(*aValues);
+#if defined(GVK_MORPH_TARGETS_SSE2)
+		// Every vec3 is loaded as 8+4 bytes into one register, so that the last element can be read without overrunning the arrays:
+		auto load3 = [](const float* bSrc) {
+			return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(bSrc))), _mm_load_ss(bSrc + 2));
+		};
+		auto store3 = [](float* bDst, __m128 bValue) {
+			_mm_store_sd(reinterpret_cast<double*>(bDst), _mm_castps_pd(bValue));
+			_mm_store_ss(bDst + 2, _mm_movehl_ps(bValue, bValue));
+		};
+		const __m128 weight = _mm_set1_ps(aWeight);
+		for (size_t i = 0; i < n; ++i) {
+			float* dst = values + static_cast<size_t>(indices[i]) * 3;
+			store3(dst, _mm_add_ps(load3(dst), _mm_mul_ps(weight, load3(deltas + i * 3))));
+		}
+#else
+		for (size_t i = 0; i < n; ++i) {
+			float* dst = values + static_cast<size_t>(indices[i]) * 3;
+			dst[0] += aWeight * deltas[i * 3];
+			dst[1] += aWeight * deltas[i * 3 + 1];
+			dst[2] += aWeight * deltas[i * 3 + 2];
+		}
+#endif
+	}
+
+	static void check_morph_target_arguments(const morph_target_set& aTargets, std::span<const float> aWeights, size_t aNumBase, size_t aNumResult)
+	{
+		if (aWeights.size() != aTargets.mTargets.size()) {
+			throw gvk::logic_error(fmt::format("{} weights have been passed for {} morph targets.", aWeights.size(), aTargets.mTargets.size()));
+		}
+		if (aNumBase != aTargets.mNumVertices || aNumResult != aTargets.mNumVertices) {
+			throw gvk::logic_error(fmt::format("The morph targets refer to {} vertices, but {} base and {} result vertices have been passed.", aTargets.mNumVertices, aNumBase, aNumResult));
+		}
+	}
+
+	void apply_morph_targets(const morph_target_set& aTargets, std::span<const float> aWeights, std::span<const glm::vec3> aBasePositions, std::span<glm::vec3> aPositions)
+	{
+		check_morph_target_arguments(aTargets, aWeights, aBasePositions.size(), aPositions.size());
+		if (aPositions.data() != aBasePositions.data()) {
+			std::copy(std::begin(aBasePositions), std::end(aBasePositions), std::begin(aPositions));
+		}
+		for (size_t t = 0; t < aTargets.mTargets.size(); ++t) {
+			const auto& target = aTargets.mTargets[t];
+			if (0.0f == aWeights[t] || target.mVertexIndices.empty()) {
+				continue;
+			}
+			accumulate_deltas(target.mVertexIndices, target.mPositionDeltas, aWeights[t], aPositions.data());
+		}
+	}
+
+	void apply_morph_targets(const morph_target_set& aTargets, std::span<const float> aWeights, std::span<const glm::vec3> aBasePositions, std::span<glm::vec3> aPositions, std::span<const glm::vec3> aBaseNormals, std::span<glm::vec3> aNormals)
+	{
+		apply_morph_targets(aTargets, aWeights, aBasePositions, aPositions);
+		check_morph_target_arguments(aTargets, aWeights, aBaseNormals.size(), aNormals.size());
+		if (aNormals.data() != aBaseNormals.data()) {
+			std::copy(std::begin(aBaseNormals), std::end(aBaseNormals), std::begin(aNormals));
+		}
+		for (size_t t = 0; t < aTargets.mTargets.size(); ++t) {
+			const auto& target = aTargets.mTargets[t];
+			if (0.0f == aWeights[t] || target.mNormalDeltas.empty()) {
+				continue;
+			}
+			accumulate_deltas(target.mVertexIndices, target.mNormalDeltas, aWeights[t], aNormals.data());
+		}
+		// Normalize only the affected normals (normalizing a vertex multiple times does not hurt):
+		for (size_t t = 0; t < aTargets.mTargets.size(); ++t) {
+			const auto& target = aTargets.mTargets[t];
+			if (0.0f == aWeights[t] || target.mNormalDeltas.empty()) {
+				continue;
+			}
+			for (auto v : target.mVertexIndices) {
+				const auto length = glm::length(aNormals[v]);
+				if (length > 0.0f) {
+					aNormals[v] /= length;
+				}
+			}
+		}
+	}
+}
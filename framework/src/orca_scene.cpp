@@ -4,26 +4,42 @@ namespace gvk
 {
 	std::unordered_map<material_config, std::vector<model_and_mesh_indices>> orca_scene_t::distinct_material_configs_for_all_models(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials)
 	{
-		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> result;
-
+		// Intern every model's distinct configs into one table, so that equal configs of different models are merged by comparing IDs:
+		material_config_table table;
+		std::vector<material_id> ids;
+		std::vector<model_and_mesh_indices> entries;
 		for (size_t i = 0; i < mModelData.size(); ++i) {
 			auto modelMaterials = mModelData[i].mLoadedModel->distinct_material_configs(aAlsoConsiderCpuOnlyDataForDistinctMaterials);
 			for (auto& pair : modelMaterials) {
-				result[pair.first].push_back({ static_cast<model_index_t>(i), pair.second });
+				ids.push_back(table.intern(pair.first));
+				entries.push_back({ static_cast<model_index_t>(i), std::move(pair.second) });
+			}
+		}
+
+		const auto groups = group_by_material_id(ids, table.size());
+		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> result;
+		result.reserve(groups.size());
+		for (size_t id = 0; id < groups.size(); ++id) {
+			auto& modelsAndMeshes = result[table.config(static_cast<material_id>(id))];
+			modelsAndMeshes.reserve(groups[id].size());
+			for (auto e : groups[id]) {
+				modelsAndMeshes.push_back(std::move(entries[e]));
 			}
 		}
 
 		return result;
 	}
 
-	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags)
+	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, const load_progress_callback& aProgressCallback)
 	{
-		std::ifstream stream(aPath, std::ifstream::in);
-		if (!stream.good() || !stream || stream.fail())
-		{
+		vfs_file file;
+		try {
+			file = virtual_file_system::shared().open(aPath);
+		}
+		catch (gvk::runtime_error&) {
 			throw gvk::runtime_error(fmt::format("Unable to load scene from path[{}]", aPath));
 		}
-		std::string filecontents = std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		std::string filecontents(reinterpret_cast<const char*>(file.data().data()), file.size());
 		if (filecontents.empty())
 		{
 			throw gvk::runtime_error(fmt::format("Filecontents empty when loading scene from path[{}]", aPath));
@@ -149,16 +165,59 @@ namespace gvk
 			result.mPathsData.push_back(p);
 		}
 
-		// Load the models into memory:
+		// Load the models into memory, in parallel:
 		auto fsceneBasePath = avk::extract_base_path(result.mLoadPath);
-		for (auto& modelData : result.mModelData) {
+		const auto numModels = result.mModelData.size();
+		std::vector<size_t> modelIndices(numModels);
+		std::iota(std::begin(modelIndices), std::end(modelIndices), size_t{ 0 });
+		std::vector<float> progressPerModel(numModels, 0.0f);
+		std::mutex progressMutex;
+		std::exception_ptr firstError;
+		std::atomic<bool> failed{ false };
+		std::for_each(std::execution::par, std::begin(modelIndices), std::end(modelIndices), [&](size_t bModelIndex) {
+			if (failed) {
+				return;
+			}
+			auto& modelData = result.mModelData[bModelIndex];
 			modelData.mFullPathName = avk::combine_paths(fsceneBasePath, modelData.mFileName);
-			modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags);
+			load_progress_callback progressCallback;
+			if (aProgressCallback) {
+				// Combine the progress of all models, and report it from one thread at a time:
+				progressCallback = [&, bModelIndex](float bProgress) {
+					std::scoped_lock guard(progressMutex);
+					progressPerModel[bModelIndex] = bProgress;
+					return !failed && aProgressCallback(std::accumulate(std::begin(progressPerModel), std::end(progressPerModel), 0.0f) / static_cast<float>(numModels));
+				};
+			}
+			try {
+				modelData.mLoadedModel = model_cache::shared().load_from_file(modelData.mFullPathName, aAssimpFlags, progressCallback);
+			}
+			catch (...) {
+				// Exceptions must not escape parallel algorithms => rethrow the first one afterwards
+				std::scoped_lock guard(progressMutex);
+				if (!firstError) {
+					firstError = std::current_exception();
+				}
+				failed = true;
+			}
+		});
+		if (firstError) {
+			std::rethrow_exception(firstError);
 		}
 		
 		return result;
 	}
 
+	async_load<avk::owning_resource<orca_scene_t>> orca_scene_t::load_from_file_async(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, std::function<void(float)> aOnProgress)
+	{
+		return async_load<avk::owning_resource<orca_scene_t>>::launch(
+			[aPath, aAssimpFlags](const load_progress_callback& bProgressCallback) {
+				return load_from_file(aPath, aAssimpFlags, bProgressCallback);
+			},
+			std::move(aOnProgress)
+		);
+	}
+
 	glm::vec3 convert_json_to_vec3(nlohmann::json& j)
 	{
 		std::vector<float> v = j;
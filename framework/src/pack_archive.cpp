@@ -0,0 +1,317 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	namespace
+	{
+		constexpr size_t lz4_min_match = 4;
+		// The last match must start at least 12 bytes before the end of the block, and the last 5 bytes are always literals:
+		constexpr size_t lz4_match_find_limit = 12;
+		constexpr size_t lz4_last_literals = 5;
+		constexpr uint32_t lz4_hash_bits = 16;
+		constexpr size_t lz4_max_offset = 65535;
+
+		uint32_t read_u32(const std::byte* aPtr)
+		{
+			uint32_t result;
+			std::memcpy(&result, aPtr, sizeof(result));
+			return result;
+		}
+
+		uint32_t lz4_hash(uint32_t aSequence)
+		{
+			return (aSequence * 2654435761u) >> (32 - lz4_hash_bits);
+		}
+
+		void lz4_write_length(std::vector<std::byte>& aOut, size_t aLength)
+		{
+			while (aLength >= 255) {
+				aOut.push_back(std::byte{ 255 });
+				aLength -= 255;
+			}
+			aOut.push_back(static_cast<std::byte>(aLength));
+		}
+
+		void lz4_write_sequence(std::vector<std::byte>& aOut, const std::byte* aLiterals, size_t aNumLiterals, std::optional<std::tuple<size_t, size_t>> aOffsetAndMatchLength)
+		{
+			const size_t matchCode = aOffsetAndMatchLength.has_value() ? std::get<1>(*aOffsetAndMatchLength) - lz4_min_match : 0;
+			aOut.push_back(static_cast<std::byte>((std::min<size_t>(aNumLiterals, 15) << 4) | std::min<size_t>(matchCode, 15)));
+			if (aNumLiterals >= 15) {
+				lz4_write_length(aOut, aNumLiterals - 15);
+			}
+			aOut.insert(std::end(aOut), aLiterals, aLiterals + aNumLiterals);
+			if (aOffsetAndMatchLength.has_value()) {
+				const auto offset = std::get<0>(*aOffsetAndMatchLength);
+				aOut.push_back(static_cast<std::byte>(offset & 0xFF));
+				aOut.push_back(static_cast<std::byte>(offset >> 8));
+				if (matchCode >= 15) {
+					lz4_write_length(aOut, matchCode - 15);
+				}
+			}
+		}
+
+		size_t lz4_read_length(std::span<const std::byte> aIn, size_t& aPos)
+		{
+			size_t result = 0;
+			uint8_t value;
+			do {
+				if (aPos >= aIn.size()) {
+					throw gvk::runtime_error("Malformed LZ4 block: unexpected end of data while reading a length.");
+				}
+				value = static_cast<uint8_t>(aIn[aPos++]);
+				result += value;
+			} while (255 == value);
+			return result;
+		}
+	}
+
+	std::vector<std::byte> lz4_block_compress(std::span<const std::byte> aData)
+	{
+		std::vector<std::byte> result;
+		result.reserve(aData.size() / 2 + 16);
+		const auto* src = aData.data();
+		const size_t n = aData.size();
+
+		size_t anchor = 0;
+		if (n > lz4_match_find_limit) {
+			// Positions are stored +1, s.t. 0 means "no position":
+			std::vector<uint32_t> table(size_t{ 1 } << lz4_hash_bits, 0u);
+			const size_t matchStartLimit = n - lz4_match_find_limit;
+			const size_t matchEndLimit = n - lz4_last_literals;
+			size_t pos = 0;
+			while (pos < matchStartLimit) {
+				const auto sequence = read_u32(src + pos);
+				auto& slot = table[lz4_hash(sequence)];
+				const size_t candidate = slot;
+				slot = static_cast<uint32_t>(pos + 1);
+				if (0 == candidate || pos - (candidate - 1) > lz4_max_offset || read_u32(src + candidate - 1) != sequence) {
+					++pos;
+					continue;
+				}
+				const size_t matchPos = candidate - 1;
+				size_t matchLength = lz4_min_match;
+				while (pos + matchLength < matchEndLimit && src[matchPos + matchLength] == src[pos + matchLength]) {
+					++matchLength;
+				}
+				lz4_write_sequence(result, src + anchor, pos - anchor, std::make_tuple(pos - matchPos, matchLength));
+				pos += matchLength;
+				anchor = pos;
+			}
+		}
+		lz4_write_sequence(result, src + anchor, n - anchor, {});
+		return result;
+	}
+
+	void lz4_block_decompress(std::span<const std::byte> aCompressed, std::span<std::byte> aDestination)
+	{
+		size_t in = 0;
+		size_t out = 0;
+		while (in < aCompressed.size()) {
+			const auto token = static_cast<uint8_t>(aCompressed[in++]);
+
+			size_t numLiterals = token >> 4;
+			if (15 == numLiterals) {
+				numLiterals += lz4_read_length(aCompressed, in);
+			}
+			if (numLiterals > aCompressed.size() - in || numLiterals > aDestination.size() - out) {
+				throw gvk::runtime_error("Malformed LZ4 block: literals exceed the data.");
+			}
+			std::memcpy(aDestination.data() + out, aCompressed.data() + in, numLiterals);
+			in += numLiterals;
+			out += numLiterals;
+			if (in == aCompressed.size()) {
+				break; // The last sequence consists of literals only
+			}
+
+			if (aCompressed.size() - in < 2) {
+				throw gvk::runtime_error("Malformed LZ4 block: unexpected end of data while reading an offset.");
+			}
+			const size_t offset = static_cast<size_t>(aCompressed[in]) | (static_cast<size_t>(aCompressed[in + 1]) << 8);
+			in += 2;
+			if (0 == offset || offset > out) {
+				throw gvk::runtime_error("Malformed LZ4 block: invalid match offset.");
+			}
+			size_t matchLength = token & 0x0F;
+			if (15 == matchLength) {
+				matchLength += lz4_read_length(aCompressed, in);
+			}
+			matchLength += lz4_min_match;
+			if (matchLength > aDestination.size() - out) {
+				throw gvk::runtime_error("Malformed LZ4 block: match exceeds the destination.");
+			}
+			// Matches may overlap with the data they produce, therefore copy byte by byte:
+			for (size_t i = 0; i < matchLength; ++i, ++out) {
+				aDestination[out] = aDestination[out - offset];
+			}
+		}
+		if (out != aDestination.size()) {
+			throw gvk::runtime_error(fmt::format("Malformed LZ4 block: decompressed {} bytes instead of {}.", out, aDestination.size()));
+		}
+	}
+
+	std::string pack_archive::normalize_path(const std::string& aPath)
+	{
+		// Asset files often contain Windows-style paths, treat backslashes as separators on every platform:
+		auto path = aPath;
+		std::replace(std::begin(path), std::end(path), '\\', '/');
+		auto result = std::filesystem::path(path).lexically_normal().generic_string();
+#ifdef _WIN32
+		std::transform(std::begin(result), std::end(result), std::begin(result), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+#endif
+		return result;
+	}
+
+	std::shared_ptr<pack_archive> pack_archive::open(const std::string& aPath)
+	{
+		auto result = std::make_shared<pack_archive>();
+		result->mFile = mapped_file::map(aPath);
+		const auto* data = result->mFile.data();
+		const auto fileSize = result->mFile.size();
+
+		pack_archive_header header;
+		if (fileSize < sizeof(header)) {
+			throw gvk::runtime_error(fmt::format("'{}' is not a pack archive, it is too small.", aPath));
+		}
+		std::memcpy(&header, data, sizeof(header));
+		if (header.mMagic != pack_archive_magic) {
+			throw gvk::runtime_error(fmt::format("'{}' is not a pack archive.", aPath));
+		}
+		if (header.mVersion != pack_archive_version) {
+			throw gvk::runtime_error(fmt::format("Pack archive '{}' has version {}, but version {} is required.", aPath, header.mVersion, pack_archive_version));
+		}
+		if (header.mIndexOffset > fileSize || header.mIndexSize > fileSize - header.mIndexOffset) {
+			throw gvk::runtime_error(fmt::format("The index of pack archive '{}' exceeds the file.", aPath));
+		}
+
+		const auto* index = data + header.mIndexOffset;
+		const auto indexSize = static_cast<size_t>(header.mIndexSize);
+		size_t pos = 0;
+		result->mEntries.reserve(header.mNumEntries);
+		for (uint32_t i = 0; i < header.mNumEntries; ++i) {
+			pack_archive_index_entry entry;
+			if (indexSize - pos < sizeof(entry)) {
+				throw gvk::runtime_error(fmt::format("The index of pack archive '{}' is truncated.", aPath));
+			}
+			std::memcpy(&entry, index + pos, sizeof(entry));
+			pos += sizeof(entry);
+			if (indexSize - pos < entry.mPathLength) {
+				throw gvk::runtime_error(fmt::format("The index of pack archive '{}' is truncated.", aPath));
+			}
+			std::string entryPath(reinterpret_cast<const char*>(index + pos), entry.mPathLength);
+			pos += entry.mPathLength;
+			if (entry.mOffset > fileSize || entry.mStoredSize > fileSize - entry.mOffset) {
+				throw gvk::runtime_error(fmt::format("Entry '{}' of pack archive '{}' exceeds the file.", entryPath, aPath));
+			}
+			if (pack_entry_compression::none == entry.mCompression ? entry.mStoredSize != entry.mSize : pack_entry_compression::lz4_block != entry.mCompression) {
+				throw gvk::runtime_error(fmt::format("Entry '{}' of pack archive '{}' is invalid.", entryPath, aPath));
+			}
+			// Normalize again, since archives which have been created on another platform might differ in case:
+			result->mEntries.emplace(normalize_path(entryPath), entry);
+		}
+
+		LOG_INFO(fmt::format("Opened pack archive '{}' with {} entries.", aPath, result->mEntries.size()));
+		return result;
+	}
+
+	bool pack_archive::contains(const std::string& aPath) const
+	{
+		return mEntries.contains(normalize_path(aPath));
+	}
+
+	std::optional<vfs_file> pack_archive::open_entry(const std::string& aPath) const
+	{
+		auto normalizedPath = normalize_path(aPath);
+		auto it = mEntries.find(normalizedPath);
+		if (it == std::end(mEntries)) {
+			return {};
+		}
+		const auto& entry = it->second;
+		std::span<const std::byte> stored{ mFile.data() + entry.mOffset, static_cast<size_t>(entry.mStoredSize) };
+		if (pack_entry_compression::none == entry.mCompression) {
+			return vfs_file{ std::move(normalizedPath), stored, shared_from_this() };
+		}
+
+		auto decompressed = std::make_shared<std::vector<std::byte>>(static_cast<size_t>(entry.mSize));
+		try {
+			lz4_block_decompress(stored, *decompressed);
+		}
+		catch (gvk::runtime_error& e) {
+			throw gvk::runtime_error(fmt::format("Could not decompress entry '{}' of pack archive '{}': {}", normalizedPath, path(), e.what()));
+		}
+		std::span<const std::byte> data{ *decompressed };
+		return vfs_file{ std::move(normalizedPath), data, std::move(decompressed) };
+	}
+
+	void pack_archive::create(const std::string& aArchivePath, const std::vector<std::string>& aFilePaths, bool aCompress)
+	{
+		std::ofstream stream(aArchivePath, std::ios::binary | std::ios::trunc);
+		if (!stream.good()) {
+			throw gvk::runtime_error(fmt::format("Could not open '{}' for writing a pack archive.", aArchivePath));
+		}
+
+		uint64_t offset = 0;
+		auto writeBytes = [&stream, &offset](const void* bData, size_t bSize) {
+			stream.write(static_cast<const char*>(bData), static_cast<std::streamsize>(bSize));
+			offset += bSize;
+		};
+		auto padToPage = [&]() {
+			static const std::array<char, pack_archive_page_size> sZeros{};
+			const auto padding = (pack_archive_page_size - offset % pack_archive_page_size) % pack_archive_page_size;
+			writeBytes(sZeros.data(), static_cast<size_t>(padding));
+		};
+
+		// The header is written again at the end, once the index' location is known:
+		pack_archive_header header{};
+		header.mMagic = pack_archive_magic;
+		header.mVersion = pack_archive_version;
+		writeBytes(&header, sizeof(header));
+
+		std::vector<std::byte> index;
+		std::unordered_set<std::string> storedPaths;
+		uint64_t totalSize = 0;
+		uint64_t totalStoredSize = 0;
+		for (const auto& filePath : aFilePaths) {
+			auto entryPath = normalize_path(filePath);
+			if (!storedPaths.insert(entryPath).second) {
+				continue;
+			}
+			auto file = mapped_file::map(filePath);
+			std::span<const std::byte> contents{ file.data(), file.size() };
+
+			pack_archive_index_entry entry{};
+			entry.mSize = contents.size();
+			entry.mCompression = pack_entry_compression::none;
+			std::vector<std::byte> compressed;
+			if (aCompress && !contents.empty()) {
+				compressed = lz4_block_compress(contents);
+				if (compressed.size() <= contents.size() - contents.size() / 8) {
+					entry.mCompression = pack_entry_compression::lz4_block;
+					contents = compressed;
+				}
+			}
+			padToPage();
+			entry.mOffset = offset;
+			entry.mStoredSize = contents.size();
+			entry.mPathLength = static_cast<uint32_t>(entryPath.size());
+			writeBytes(contents.data(), contents.size());
+
+			const auto* entryBytes = reinterpret_cast<const std::byte*>(&entry);
+			index.insert(std::end(index), entryBytes, entryBytes + sizeof(entry));
+			const auto* pathBytes = reinterpret_cast<const std::byte*>(entryPath.data());
+			index.insert(std::end(index), pathBytes, pathBytes + entryPath.size());
+			++header.mNumEntries;
+			totalSize += entry.mSize;
+			totalStoredSize += entry.mStoredSize;
+		}
+
+		header.mIndexOffset = offset;
+		header.mIndexSize = index.size();
+		writeBytes(index.data(), index.size());
+		stream.seekp(0);
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		if (!stream.good()) {
+			throw gvk::runtime_error(fmt::format("Writing pack archive '{}' failed.", aArchivePath));
+		}
+		LOG_INFO(fmt::format("Wrote pack archive '{}' with {} entries, storing {:.1f} MiB in {:.1f} MiB.", aArchivePath, header.mNumEntries, static_cast<double>(totalSize) / (1024.0 * 1024.0), static_cast<double>(totalStoredSize) / (1024.0 * 1024.0)));
+	}
+}
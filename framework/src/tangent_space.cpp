@@ -0,0 +1,128 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Contribution of one triangle corner to its vertex' tangent frame, already weighted by the corner's angle */
+	struct tangent_space_corner
+	{
+		glm::vec3 mTangent;
+		/** Corner angle, negative if the triangle's texture mapping is mirrored, zero if the triangle does not contribute */
+		float mSignedWeight;
+	};
+
+	/** Projects the given vector into the plane with the given (unit) normal and normalizes it, returns zero if that is not possible */
+	static glm::vec3 project_and_normalize(const glm::vec3& aVector, const glm::vec3& aNormal)
+	{
+		const auto projected = aVector - aNormal * glm::dot(aNormal, aVector);
+		const auto length = glm::length(projected);
+		return length > std::numeric_limits<float>::min() ? projected / length : glm::vec3{ 0.0f };
+	}
+
+	/** Returns some unit vector which is orthogonal to the given unit vector */
+	static glm::vec3 any_orthogonal(const glm::vec3& aNormal)
+	{
+		const auto helper = glm::abs(aNormal.x) < 0.9f ? glm::vec3{ 1.0f, 0.0f, 0.0f } : glm::vec3{ 0.0f, 1.0f, 0.0f };
+		return glm::normalize(helper - aNormal * glm::dot(aNormal, helper));
+	}
+
+	tangent_space generate_tangent_space(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords)
+	{
+		assert(aIndices.size() % 3 == 0);
+		if (aNormals.size() != aPositions.size() || aTexCoords.size() != aPositions.size()) {
+			throw gvk::logic_error(fmt::format("Generating a tangent space requires as many normals ({}) and texture coordinates ({}) as positions ({}).", aNormals.size(), aTexCoords.size(), aPositions.size()));
+		}
+		const auto numVertices = aPositions.size();
+		const auto numTriangles = aIndices.size() / 3;
+
+		auto normalOf = [&aNormals](uint32_t bVertex) {
+			const auto length = glm::length(aNormals[bVertex]);
+			return length > std::numeric_limits<float>::min() ? aNormals[bVertex] / length : glm::vec3{ 0.0f, 0.0f, 1.0f };
+		};
+
+		// 1st pass, concurrently over all triangles: compute every corner's contribution
+		std::vector<tangent_space_corner> corners(aIndices.size());
+		std::vector<size_t> triangles(numTriangles);
+		std::iota(std::begin(triangles), std::end(triangles), size_t{ 0 });
+		std::for_each(std::execution::par, std::begin(triangles), std::end(triangles), [&](size_t f) {
+			const uint32_t* tri = aIndices.data() + f * 3;
+			if (tri[0] >= numVertices || tri[1] >= numVertices || tri[2] >= numVertices) {
+				corners[f * 3] = corners[f * 3 + 1] = corners[f * 3 + 2] = tangent_space_corner{ {}, 0.0f };
+				return;
+			}
+
+			// Texture space derivative of the triangle, i.e. the direction of increasing u:
+			const auto d1 = aPositions[tri[1]] - aPositions[tri[0]];
+			const auto d2 = aPositions[tri[2]] - aPositions[tri[0]];
+			const auto t21 = aTexCoords[tri[1]] - aTexCoords[tri[0]];
+			const auto t31 = aTexCoords[tri[2]] - aTexCoords[tri[0]];
+			const float signedAreaTimes2 = t21.x * t31.y - t21.y * t31.x;
+			const float orientation = signedAreaTimes2 > 0.0f ? 1.0f : -1.0f;
+			const auto os = (t31.y * d1 - t21.y * d2) * orientation;
+			const bool valid = glm::abs(signedAreaTimes2) > std::numeric_limits<float>::min() && glm::length(os) > std::numeric_limits<float>::min();
+
+			for (size_t k = 0; k < 3; ++k) {
+				auto& corner = corners[f * 3 + k];
+				const auto v = tri[k];
+				const auto n = normalOf(v);
+				// Weight by the angle at this corner, measured within the tangent plane:
+				const auto e1 = project_and_normalize(aPositions[tri[(k + 1) % 3]] - aPositions[v], n);
+				const auto e2 = project_and_normalize(aPositions[tri[(k + 2) % 3]] - aPositions[v], n);
+				const float angle = glm::acos(glm::clamp(glm::dot(e1, e2), -1.0f, 1.0f));
+				if (!valid || angle <= 0.0f) {
+					corner = tangent_space_corner{ {}, 0.0f };
+					continue;
+				}
+				corner.mTangent = project_and_normalize(os, n) * angle;
+				corner.mSignedWeight = angle * orientation;
+			}
+		});
+
+		// Group the corners by vertex in a compressed sparse row layout: the corners of vertex v are [offsets[v], offsets[v+1])
+		std::vector<uint32_t> offsets(numVertices + 1, 0u);
+		for (size_t c = 0; c < aIndices.size(); ++c) {
+			if (aIndices[c] < numVertices) {
+				++offsets[aIndices[c] + 1];
+			}
+		}
+		std::partial_sum(std::begin(offsets), std::end(offsets), std::begin(offsets));
+		std::vector<uint32_t> cornersOfVertices(offsets.back());
+		{
+			std::vector<uint32_t> cursors(std::begin(offsets), std::end(offsets) - 1);
+			for (size_t c = 0; c < aIndices.size(); ++c) {
+				if (aIndices[c] < numVertices) {
+					cornersOfVertices[cursors[aIndices[c]]++] = static_cast<uint32_t>(c);
+				}
+			}
+		}
+
+		// 2nd pass, concurrently over all vertices: accumulate the corners of the prevailing orientation
+		tangent_space result;
+		result.mTangents.resize(numVertices);
+		result.mBitangents.resize(numVertices);
+		std::vector<size_t> vertices(numVertices);
+		std::iota(std::begin(vertices), std::end(vertices), size_t{ 0 });
+		std::for_each(std::execution::par, std::begin(vertices), std::end(vertices), [&](size_t v) {
+			const auto n = normalOf(static_cast<uint32_t>(v));
+			float orientationVote = 0.0f;
+			for (auto c = offsets[v]; c < offsets[v + 1]; ++c) {
+				orientationVote += corners[cornersOfVertices[c]].mSignedWeight;
+			}
+			const float sign = orientationVote < 0.0f ? -1.0f : 1.0f;
+
+			glm::vec3 tangentSum{ 0.0f };
+			for (auto c = offsets[v]; c < offsets[v + 1]; ++c) {
+				const auto& corner = corners[cornersOfVertices[c]];
+				if (corner.mSignedWeight * sign > 0.0f) {
+					tangentSum += corner.mTangent;
+				}
+			}
+			auto tangent = project_and_normalize(tangentSum, n);
+			if (glm::vec3{ 0.0f } == tangent) {
+				tangent = any_orthogonal(n);
+			}
+			result.mTangents[v] = tangent;
+			result.mBitangents[v] = sign * glm::cross(n, tangent);
+		});
+		return result;
+	}
+}
@@ -0,0 +1,260 @@
+#include <gvk.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GVK_QUANTIZATION_SSE2
+#endif
+
+namespace gvk
+{
+	quantization_transform compute_quantization_transform(const glm::vec3* aPositions, size_t aNumPositions)
+	{
+		quantization_transform result;
+		if (0 == aNumPositions) {
+			return result;
+		}
+		glm::vec3 minPos = aPositions[0];
+		glm::vec3 maxPos = aPositions[0];
+		for (size_t i = 1; i < aNumPositions; ++i) {
+			minPos = glm::min(minPos, aPositions[i]);
+			maxPos = glm::max(maxPos, aPositions[i]);
+		}
+		result.mOffset = minPos;
+		result.mScale = maxPos - minPos;
+		for (int c = 0; c < 3; ++c) {
+			if (result.mScale[c] <= 0.0f) {
+				// All values are the same => they are all quantized to 0, and any scale works:
+				result.mScale[c] = 1.0f;
+			}
+		}
+		return result;
+	}
+
+	static float sign_not_zero(float aValue)
+	{
+		return aValue >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	static int16_t to_snorm16(float aValue)
+	{
+		return static_cast<int16_t>(std::round(glm::clamp(aValue, -1.0f, 1.0f) * 32767.0f));
+	}
+
+	glm::i16vec2 encode_octahedral_snorm16(const glm::vec3& aUnitVector)
+	{
+		const float l1 = std::abs(aUnitVector.x) + std::abs(aUnitVector.y) + std::abs(aUnitVector.z);
+		if (l1 <= 0.0f) {
+			return glm::i16vec2{ 0, 0 }; // decodes to (0,0,1)
+		}
+		glm::vec2 p = glm::vec2{ aUnitVector.x, aUnitVector.y } / l1;
+		if (aUnitVector.z < 0.0f) {
+			// Fold the lower hemisphere over the diagonals:
+			p = glm::vec2{
+				(1.0f - std::abs(p.y)) * sign_not_zero(p.x),
+				(1.0f - std::abs(p.x)) * sign_not_zero(p.y)
+			};
+		}
+		return glm::i16vec2{ to_snorm16(p.x), to_snorm16(p.y) };
+	}
+
+	glm::vec3 decode_octahedral_snorm16(const glm::i16vec2& aEncoded)
+	{
+		const glm::vec2 p = glm::max(glm::vec2{ aEncoded } / 32767.0f, glm::vec2{ -1.0f });
+		glm::vec3 n{ p.x, p.y, 1.0f - std::abs(p.x) - std::abs(p.y) };
+		const float t = std::max(-n.z, 0.0f);
+		n.x += n.x >= 0.0f ? -t : t;
+		n.y += n.y >= 0.0f ? -t : t;
+		return glm::normalize(n);
+	}
+
+#if defined(GVK_QUANTIZATION_SSE2)
+	// SSE2 variant of encode_octahedral_snorm16 for four unit vectors at once, given as x, y, and z components.
+	// Writes the four results as int32 values, i.e. x0, x1, x2, x3 into aEncodedX and y0, y1, y2, y3 into aEncodedY.
+	static void encode_octahedral_snorm16_sse2(__m128 aX, __m128 aY, __m128 aZ, __m128i& aEncodedX, __m128i& aEncodedY)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+		const __m128 absX = _mm_andnot_ps(signMask, aX);
+		const __m128 absY = _mm_andnot_ps(signMask, aY);
+		const __m128 l1 = _mm_add_ps(_mm_add_ps(absX, absY), _mm_andnot_ps(signMask, aZ));
+		const __m128 isZeroLength = _mm_cmple_ps(l1, zero);
+		const __m128 px = _mm_div_ps(aX, l1);
+		const __m128 py = _mm_div_ps(aY, l1);
+
+		// Fold the lower hemisphere over the diagonals:
+		auto signNotZero = [&](__m128 bValue) {
+			const __m128 isPositive = _mm_cmpge_ps(bValue, zero);
+			return _mm_or_ps(_mm_and_ps(isPositive, one), _mm_andnot_ps(isPositive, minusOne));
+		};
+		const __m128 foldedX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, py)), signNotZero(px));
+		const __m128 foldedY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, px)), signNotZero(py));
+		const __m128 isLower = _mm_cmplt_ps(aZ, zero);
+
+		// Round half away from zero, like std::round does: truncate, then step away from zero if the fraction is at least one half.
+		// All values are within [-32767, 32767] => the fraction is computed exactly.
+		auto toSnorm16 = [&](__m128 bValue) {
+			const __m128 v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(bValue, minusOne), one), _mm_set1_ps(32767.0f));
+			const __m128i truncated = _mm_cvttps_epi32(v);
+			const __m128 fraction = _mm_andnot_ps(signMask, _mm_sub_ps(v, _mm_cvtepi32_ps(truncated)));
+			const __m128i roundAway = _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)));
+			const __m128i awayFromZero = _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(v), 31), _mm_set1_epi32(1));
+			const __m128i rounded = _mm_add_epi32(truncated, _mm_and_si128(roundAway, awayFromZero));
+			// Vectors of zero length are encoded as (0,0):
+			return _mm_andnot_si128(_mm_castps_si128(isZeroLength), rounded);
+		};
+		aEncodedX = toSnorm16(_mm_or_ps(_mm_and_ps(isLower, foldedX), _mm_andnot_ps(isLower, px)));
+		aEncodedY = toSnorm16(_mm_or_ps(_mm_and_ps(isLower, foldedY), _mm_andnot_ps(isLower, py)));
+	}
+#endif
+
+	void encode_octahedral_snorm16(const glm::vec3* aSource, glm::i16vec2* aDestination, size_t aCount)
+	{
+		size_t i = 0;
+#if defined(GVK_QUANTIZATION_SSE2)
+		for (; i + 4 <= aCount; i += 4) {
+			const glm::vec3* s = aSource + i;
+			__m128i x, y;
+			encode_octahedral_snorm16_sse2(
+				_mm_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x),
+				_mm_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y),
+				_mm_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z),
+				x, y
+			);
+			// All values are in int16 range => packing does not saturate. Interleaving yields x0, y0, x1, y1, ...:
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(aDestination + i), _mm_unpacklo_epi16(_mm_packs_epi32(x, x), _mm_packs_epi32(y, y)));
+		}
+#endif
+		for (; i < aCount; ++i) {
+			aDestination[i] = encode_octahedral_snorm16(aSource[i]);
+		}
+	}
+
+	void quantize_unorm16(const float* aSource, uint16_t* aDestination, size_t aNumVectors, size_t aNumComponents, const float* aOffsets, const float* aScales)
+	{
+		assert(aNumComponents >= 1 && aNumComponents <= 4);
+		const size_t numValues = aNumVectors * aNumComponents;
+		size_t i = 0;
+
+#if defined(GVK_QUANTIZATION_SSE2)
+		// 12 is a multiple of every possible number of components => offsets and scales repeat every 12 floats, i.e. every three registers.
+		alignas(16) float offsets[12];
+		alignas(16) float scales[12];
+		for (size_t k = 0; k < 12; ++k) {
+			offsets[k] = aOffsets[k % aNumComponents];
+			scales[k] = aScales[k % aNumComponents] * 65535.0f;
+		}
+		const __m128 offset0 = _mm_load_ps(offsets), offset1 = _mm_load_ps(offsets + 4), offset2 = _mm_load_ps(offsets + 8);
+		const __m128 scale0 = _mm_load_ps(scales), scale1 = _mm_load_ps(scales + 4), scale2 = _mm_load_ps(scales + 8);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 max = _mm_set1_ps(65535.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128i bias32 = _mm_set1_epi32(32768);
+		const __m128i bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+
+		auto quantize4 = [&](const float* bSource, const __m128& bOffset, const __m128& bScale) {
+			__m128 v = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(bSource), bOffset), bScale);
+			v = _mm_min_ps(_mm_max_ps(v, zero), max);
+			// Values are non-negative => truncation after adding 0.5 rounds to nearest. Bias into the signed range for packing:
+			return _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(v, half)), bias32);
+		};
+
+		for (; i + 12 <= numValues; i += 12) {
+			const __m128i q0 = quantize4(aSource + i, offset0, scale0);
+			const __m128i q1 = quantize4(aSource + i + 4, offset1, scale1);
+			const __m128i q2 = quantize4(aSource + i + 8, offset2, scale2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(aDestination + i), _mm_xor_si128(_mm_packs_epi32(q0, q1), bias16));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(aDestination + i + 8), _mm_xor_si128(_mm_packs_epi32(q2, q2), bias16));
+		}
+#endif
+
+		for (; i < numValues; ++i) {
+			const auto c = i % aNumComponents;
+			const float v = glm::clamp((aSource[i] - aOffsets[c]) * aScales[c], 0.0f, 1.0f);
+			aDestination[i] = static_cast<uint16_t>(v * 65535.0f + 0.5f);
+		}
+	}
+
+	// Fabian Giesen's float to half conversion with round-to-nearest-even:
+	static uint16_t float_to_half(float aValue)
+	{
+		uint32_t f;
+		std::memcpy(&f, &aValue, sizeof(f));
+		const uint32_t sign = f & 0x80000000u;
+		f ^= sign;
+
+		uint32_t result;
+		if (f >= ((127u + 16u) << 23)) {
+			// Infinity or NaN:
+			result = f > 0x7f800000u ? 0x7e00u : 0x7c00u;
+		}
+		else if (f < ((127u - 14u) << 23)) {
+			// Subnormal or zero => let the FPU do the rounding via adding a magic number:
+			constexpr uint32_t subnormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+			float magic, tmp;
+			std::memcpy(&magic, &subnormalMagic, sizeof(magic));
+			std::memcpy(&tmp, &f, sizeof(tmp));
+			tmp += magic;
+			std::memcpy(&f, &tmp, sizeof(f));
+			result = f - subnormalMagic;
+		}
+		else {
+			const uint32_t mantissaOdd = (f >> 13) & 1u;
+			f += static_cast<uint32_t>((15 - 127) << 23) + 0xfffu + mantissaOdd;
+			result = f >> 13;
+		}
+		return static_cast<uint16_t>(result | (sign >> 16));
+	}
+
+#if defined(GVK_QUANTIZATION_SSE2)
+	// Branchless SSE2 variant of float_to_half for four values at once:
+	static __m128i float_to_half_sse2(__m128 aValues)
+	{
+		const __m128i maskSign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+		const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);          // All values >= this round to infinity
+		const __m128i nanBit = _mm_set1_epi32(0x200);
+		const __m128i infinityAsF16 = _mm_set1_epi32(0x7c00);
+		const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);       // Smallest value which yields a normalized half
+		const __m128i subnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i normalBias = _mm_set1_epi32(0xfff - ((127 - 15) << 23));
+
+		const __m128 justSign = _mm_and_ps(_mm_castsi128_ps(maskSign), aValues);
+		const __m128 absValues = _mm_xor_ps(aValues, justSign);
+		const __m128i absInt = _mm_castps_si128(absValues);
+		const __m128 isNan = _mm_cmpunord_ps(absValues, absValues);
+		const __m128i isRegular = _mm_cmpgt_epi32(f16Max, absInt);
+		const __m128i infOrNan = _mm_or_si128(_mm_and_si128(_mm_castps_si128(isNan), nanBit), infinityAsF16);
+		const __m128i isSubnormal = _mm_cmpgt_epi32(minNormal, absInt);
+
+		// Result is subnormal:
+		const __m128 subnormal1 = _mm_add_ps(absValues, _mm_castsi128_ps(subnormalMagic));
+		const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(subnormal1), subnormalMagic);
+
+		// Result is normal:
+		const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absInt, 31 - 13), 31);
+		const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absInt, normalBias), mantissaOdd), 13);
+
+		const __m128i nonSpecial = _mm_or_si128(_mm_and_si128(subnormal, isSubnormal), _mm_andnot_si128(isSubnormal, normal));
+		const __m128i joined = _mm_or_si128(_mm_and_si128(nonSpecial, isRegular), _mm_andnot_si128(isRegular, infOrNan));
+		return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(justSign), 16));
+	}
+#endif
+
+	void convert_to_half(const float* aSource, uint16_t* aDestination, size_t aNumValues)
+	{
+		size_t i = 0;
+#if defined(GVK_QUANTIZATION_SSE2)
+		for (; i + 8 <= aNumValues; i += 8) {
+			const __m128i h0 = float_to_half_sse2(_mm_loadu_ps(aSource + i));
+			const __m128i h1 = float_to_half_sse2(_mm_loadu_ps(aSource + i + 4));
+			// The sign has been smeared into the upper 16 bits => all values are in int16 range and packing does not saturate:
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(aDestination + i), _mm_packs_epi32(h0, h1));
+		}
+#endif
+		for (; i < aNumValues; ++i) {
+			aDestination[i] = float_to_half(aSource[i]);
+		}
+	}
+}
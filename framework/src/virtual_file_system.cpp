@@ -0,0 +1,126 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	void virtual_file_system::mount(const std::string& aArchivePath)
+	{
+		mount(pack_archive::open(aArchivePath));
+	}
+
+	void virtual_file_system::mount(std::shared_ptr<pack_archive> aArchive)
+	{
+		std::scoped_lock guard(mMutex);
+		mArchives.push_back(std::move(aArchive));
+	}
+
+	void virtual_file_system::unmount_all()
+	{
+		std::scoped_lock guard(mMutex);
+		mArchives.clear();
+	}
+
+	std::vector<std::shared_ptr<pack_archive>> virtual_file_system::archives() const
+	{
+		std::scoped_lock guard(mMutex);
+		return mArchives;
+	}
+
+	bool virtual_file_system::exists(const std::string& aPath) const
+	{
+		const auto mounted = archives();
+		if (std::any_of(std::begin(mounted), std::end(mounted), [&aPath](const auto& bArchive) { return bArchive->contains(aPath); })) {
+			return true;
+		}
+		std::error_code ec;
+		return std::filesystem::is_regular_file(aPath, ec);
+	}
+
+	vfs_file virtual_file_system::open(const std::string& aPath) const
+	{
+		const auto mounted = archives();
+		for (auto it = mounted.rbegin(); it != mounted.rend(); ++it) {
+			auto file = (*it)->open_entry(aPath);
+			if (file.has_value()) {
+				return std::move(file.value());
+			}
+		}
+
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(aPath, ec)) {
+			throw gvk::runtime_error(fmt::format("File '{}' is neither contained in a mounted pack archive nor does it exist.", aPath));
+		}
+		auto mapped = std::make_shared<mapped_file>(mapped_file::map(aPath));
+		std::span<const std::byte> data{ mapped->data(), mapped->size() };
+		return vfs_file{ pack_archive::normalize_path(aPath), data, std::move(mapped) };
+	}
+
+	virtual_file_system& virtual_file_system::shared()
+	{
+		static virtual_file_system sFileSystem;
+		return sFileSystem;
+	}
+
+	bool vfs_io_system::Exists(const char* pFile) const
+	{
+		return mFileSystem->exists(pFile);
+	}
+
+	Assimp::IOStream* vfs_io_system::Open(const char* pFile, const char* pMode)
+	{
+		if (nullptr != std::strpbrk(pMode, "wa+")) {
+			LOG_WARNING(fmt::format("Can not open '{}' for writing through the virtual file system.", pFile));
+			return nullptr;
+		}
+		try {
+			return new vfs_io_stream(mFileSystem->open(pFile));
+		}
+		catch (gvk::runtime_error&) {
+			// Assimp probes for files which might not exist, e.g. material libraries => not an error
+			return nullptr;
+		}
+	}
+
+	void vfs_io_system::Close(Assimp::IOStream* pFile)
+	{
+		delete pFile;
+	}
+
+	size_t vfs_io_stream::Read(void* pvBuffer, size_t pSize, size_t pCount)
+	{
+		if (0 == pSize || 0 == pCount) {
+			return 0;
+		}
+		const size_t available = mFile.size() - mPosition;
+		const size_t count = std::min(pCount, available / pSize);
+		std::memcpy(pvBuffer, mFile.data().data() + mPosition, count * pSize);
+		mPosition += count * pSize;
+		return count;
+	}
+
+	aiReturn vfs_io_stream::Seek(size_t pOffset, aiOrigin pOrigin)
+	{
+		size_t target;
+		switch (pOrigin) {
+		case aiOrigin_SET:
+			target = pOffset;
+			break;
+		case aiOrigin_CUR:
+			target = mPosition + pOffset;
+			break;
+		case aiOrigin_END:
+			// Assimp passes the (positive) distance from the end:
+			if (pOffset > mFile.size()) {
+				return aiReturn_FAILURE;
+			}
+			target = mFile.size() - pOffset;
+			break;
+		default:
+			return aiReturn_FAILURE;
+		}
+		if (target > mFile.size()) {
+			return aiReturn_FAILURE;
+		}
+		mPosition = target;
+		return aiReturn_SUCCESS;
+	}
+}
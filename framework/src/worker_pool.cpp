@@ -0,0 +1,66 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	worker_pool::worker_pool(size_t aNumThreads)
+	{
+		aNumThreads = std::max(aNumThreads, size_t{ 1 });
+		mThreads.reserve(aNumThreads);
+		for (size_t i = 0; i < aNumThreads; ++i) {
+			mThreads.emplace_back([this]() { work(); });
+		}
+	}
+
+	worker_pool::~worker_pool()
+	{
+		{
+			std::scoped_lock guard(mMutex);
+			mStopping = true;
+			mTasks.clear();
+		}
+		mTaskAvailable.notify_all();
+		for (auto& thread : mThreads) {
+			thread.join();
+		}
+	}
+
+	void worker_pool::submit(std::function<void()> aTask)
+	{
+		{
+			std::scoped_lock guard(mMutex);
+			mTasks.push_back(std::move(aTask));
+		}
+		mTaskAvailable.notify_one();
+	}
+
+	worker_pool& worker_pool::shared()
+	{
+		static worker_pool sPool(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
+		return sPool;
+	}
+
+	void worker_pool::work()
+	{
+		for (;;) {
+			std::function<void()> task;
+			{
+				std::unique_lock lock(mMutex);
+				mTaskAvailable.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+				if (mStopping) {
+					return;
+				}
+				task = std::move(mTasks.front());
+				mTasks.pop_front();
+			}
+			try {
+				task();
+			}
+			catch (std::exception& e) {
+				LOG_ERROR(fmt::format("Uncaught exception in a worker_pool task: {}", e.what()));
+			}
+			catch (...) {
+				LOG_ERROR("Uncaught exception of unknown type in a worker_pool task.");
+			}
+		}
+	}
+}